@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2017, 2020 IBM Corp. and others
+ * Copyright (c) 2017, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -77,8 +77,11 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
+	/**
+	 * Update the root table, the object table and the saved thread objects to the new locations of the objects they refer to.
+	 */
 	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
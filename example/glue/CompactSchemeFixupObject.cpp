@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -24,20 +24,27 @@
 
 #include "CompactSchemeFixupObject.hpp"
 #include "EnvironmentStandard.hpp"
+#include "MixedObjectScanner.hpp"
+#include "SlotObject.hpp"
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 void
 MM_CompactSchemeFixupObject::fixupObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
-#error provide an implementation to fix objects during a compact
+	uintptr_t scannerSpace[sizeof(GC_MixedObjectScanner) / sizeof(uintptr_t)];
+	GC_MixedObjectScanner *objectScanner = GC_MixedObjectScanner::newInstance(env, objectPtr, scannerSpace, 0);
+	GC_SlotObject *slotObject = NULL;
+	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		_compactScheme->fixupObjectSlot(slotObject);
+	}
 }
 
 
 void
 MM_CompactSchemeFixupObject::verifyForwardingPtr(omrobjectptr_t objectPtr, omrobjectptr_t forwardingPtr)
 {
-#error provide an implementation to verify objects after a compact is complete
+	/* forwarding pointers of the example objects carry no extra state to verify */
 }
 
 #endif /* OMR_GC_MODRON_COMPACTION */
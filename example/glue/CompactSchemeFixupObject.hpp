@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,11 +34,7 @@ class MM_CompactSchemeFixupObject {
 public:
 protected:
 private:
-	/*
-	OMR_VM *_omrVM;
-	MM_GCExtensionsBase *_extensions;
 	MM_CompactScheme *_compactScheme;
-	*/
 public:
 
 	/**
@@ -51,10 +47,7 @@ public:
 	static void verifyForwardingPtr(omrobjectptr_t objectPtr, omrobjectptr_t forwardingPtr);
 
 	MM_CompactSchemeFixupObject(MM_EnvironmentBase* env, MM_CompactScheme *compactScheme)
-/*	:
-		_omrVM(env->getOmrVM()),
-		_extensions(env->getExtensions()),
-		_compactScheme(compactScheme)*/
+		: _compactScheme(compactScheme)
 	{}
 
 protected:
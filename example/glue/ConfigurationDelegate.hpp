@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2017, 2017 IBM Corp. and others
+ * Copyright (c) 2017, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -41,6 +41,9 @@ class MM_ConfigurationDelegate
  */
 private:
 	const MM_GCPolicy _gcPolicy;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	OMR_SizeClasses _segregatedSizeClasses; /**< Storage for the size classes, filled in by MM_SizeClasses::initialize() */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 protected:
 public:
@@ -134,7 +137,7 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	OMR_SizeClasses *getSegregatedSizeClasses(MM_EnvironmentBase *env)
 	{
-		return NULL;
+		return &_segregatedSizeClasses;
 	}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
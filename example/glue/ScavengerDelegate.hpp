@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2019, 2021 IBM Corp. and others
+ * Copyright (c) 2019, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -211,6 +211,35 @@ public:
 	 */
 	void reverseForwardedObject(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedObject);
 
+	/**
+	 * When the scavenger learns hot fields (-Xgc:scavengerLearnHotFields), it counts the slots through which
+	 * young objects are copied for each class, and later depth copies the hottest slots of each object with it.
+	 * This method returns the key identifying the class of an object for this purpose. All objects with the
+	 * same key must hold object references at the same slot indexes.
+	 *
+	 * @param[in] env The environment for the calling thread.
+	 * @param[in] objectPtr An object that has been copied or is not in evacuate space
+	 * @return a non-zero key for the class of the object, or 0 if hot fields are not to be learned for it
+	 */
+	MMINLINE uintptr_t
+	getHotFieldClassKey(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		/* Example objects have no class and all of their slots are references, so any key is safe. Objects of the same
+		 * size are told apart by the slots among their first few which are not NULL, so that list nodes, tree nodes and
+		 * other objects of the same size learn their own hot fields.
+		 */
+		uintptr_t sizeInBytes = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		fomrobject_t *slot = (fomrobject_t *)objectPtr + 1;
+		fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)objectPtr + sizeInBytes);
+		uintptr_t shape = 0;
+		for (uintptr_t i = 0; (i < 12) && (slot < endSlot); i++, slot++) {
+			if (0 != *slot) {
+				shape |= (uintptr_t)1 << i;
+			}
+		}
+		return sizeInBytes ^ (shape << 16);
+	}
+
 #if defined (OMR_GC_COMPRESSED_POINTERS)
 	/**
 	 * This method is similar to reverseForwardedObject() but is called from a different context. The implementation
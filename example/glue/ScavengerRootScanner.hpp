@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2019 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -125,8 +125,8 @@ public:
 					}
 					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
 				}
+				env->_currentTask->releaseSynchronizedGCThreads(env);
 			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
 		}
 	}
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2015 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -223,6 +223,37 @@ TEST_P(HashtableTest, NoForce)
 
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, HashtableTest, ::testing::ValuesIn(hastableParams));
 
+class OpenAddressingHashtableTest: public ::testing::TestWithParam<HashtableInputData>
+{
+};
+
+TEST_P(OpenAddressingHashtableTest, Force)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(OpenAddressingHashtableTest, NoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, OpenAddressingHashtableTest, ::testing::ValuesIn(hastableParams));
+
+TEST(OmrAlgoTest, OpenAddressingHashtableGrowAndRehash)
+{
+	ASSERT_EQ(0, verifyOpenAddressingHashtable(omrTestEnv->getPortLibrary(), 100000));
+}
+
 class CollisionResilientHashtableTest: public ::testing::TestWithParam< ::testing::tuple<HashtableInputData, uint32_t> >
 {
 };
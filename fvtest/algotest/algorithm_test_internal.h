@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -50,6 +50,7 @@ typedef struct HashtableInputData {
 	uint32_t listToTreeThreshold;
 	BOOLEAN forceCollisions;
 	BOOLEAN collisionResistant;
+	BOOLEAN openAddressing;
 } HashtableInputData;
 
 /* ---------------- avltest.c ---------------- */
@@ -110,6 +111,15 @@ verifyHashtable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCo
 int32_t
 buildAndVerifyHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
 
+/**
+* @brief Exercise growth, hashTableForEachDo() removal, hashTableRehash() and deleted slot reuse of an open addressing hash table
+* @param *portLib
+* @param count number of entries to add
+* @return int32_t 0 on success
+*/
+int32_t
+verifyOpenAddressingHashtable(OMRPortLibrary *portLib, uintptr_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2009, 2016 IBM Corp. and others
+ * Copyright (c) 2009, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -33,6 +33,7 @@
  * 		hashTableStartDo()
  * 		hashTableNextDo()
  * 		hashTableRemove()
+ * and, for open addressing tables, hashTableForEachDo() and hashTableRehash()
  */
 
 static uintptr_t hashFn(void *key, void *userData);
@@ -216,12 +217,17 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 				NULL,
 				userData);
 	} else {
+		if (TRUE == inputData->openAddressing) {
+			flags |= J9HASH_TABLE_OPEN_ADDRESSING;
+		} else {
+			flags |= J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION;
+		}
 		hashtable = hashTableNew(portLib,
 				tableName,
 				tableSize,
 				entrySize,
 				sizeof(char *),
-				flags | J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION,
+				flags,
 				OMRMEM_CATEGORY_VM,
 				hashFn,
 				hashEqualFn,
@@ -259,3 +265,105 @@ fail:
 	hashTableFree(table);
 	return result;
 }
+
+static uintptr_t
+removeOddEntry(void *entry, void *userData)
+{
+	return (*(uintptr_t *)entry) & 1;
+}
+
+static BOOLEAN
+findEntries(J9HashTable *table, uintptr_t start, uintptr_t count, uintptr_t step)
+{
+	uintptr_t i = 0;
+	for (i = start; i < count; i += step) {
+		uintptr_t entry = i;
+		uintptr_t *node = hashTableFind(table, &entry);
+		if ((NULL == node) || (*node != entry)) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+int32_t
+verifyOpenAddressingHashtable(OMRPortLibrary *portLib, uintptr_t count)
+{
+	J9HashTable *table = NULL;
+	uintptr_t i = 0;
+	uintptr_t entry = 0;
+	uint32_t tableSize = 0;
+	int32_t result = 0;
+
+	table = hashTableNew(portLib, OMR_GET_CALLSITE(), 0, sizeof(uintptr_t), sizeof(char *), J9HASH_TABLE_OPEN_ADDRESSING, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, (void *)(uintptr_t)FALSE);
+	if (NULL == table) {
+		result = -1;
+		goto fail;
+	}
+
+	/* grow from the minimum size */
+	for (i = 0; i < count; i++) {
+		entry = i;
+		if (NULL == hashTableAdd(table, &entry)) {
+			result = -2;
+			goto fail;
+		}
+	}
+	if ((count != hashTableGetCount(table)) || !findEntries(table, 0, count, 1)) {
+		result = -3;
+		goto fail;
+	}
+
+	/* remove the odd entries while iterating */
+	hashTableForEachDo(table, removeOddEntry, NULL);
+	entry = 1;
+	if (((count / 2) != hashTableGetCount(table)) || !findEntries(table, 0, count, 2) || (NULL != hashTableFind(table, &entry))) {
+		result = -4;
+		goto fail;
+	}
+
+	hashTableRehash(table);
+	if (((count / 2) != hashTableGetCount(table)) || !findEntries(table, 0, count, 2)) {
+		result = -5;
+		goto fail;
+	}
+
+	/* churn through deleted slots without growing the table */
+	tableSize = table->tableSize;
+	for (i = 0; i < (8 * count); i++) {
+		entry = count + i;
+		if ((NULL == hashTableAdd(table, &entry)) || (0 != hashTableRemove(table, &entry))) {
+			result = -6;
+			goto fail;
+		}
+	}
+	if ((tableSize != table->tableSize) || ((count / 2) != hashTableGetCount(table)) || !findEntries(table, 0, count, 2)) {
+		result = -7;
+		goto fail;
+	}
+	hashTableFree(table);
+
+	/* a table that may not grow fills every slot, then fails */
+	table = hashTableNew(portLib, OMR_GET_CALLSITE(), 0, sizeof(uintptr_t), sizeof(char *), J9HASH_TABLE_OPEN_ADDRESSING | J9HASH_TABLE_DO_NOT_GROW, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, (void *)(uintptr_t)FALSE);
+	if (NULL == table) {
+		result = -8;
+		goto fail;
+	}
+	tableSize = table->tableSize;
+	for (i = 0; i < tableSize; i++) {
+		entry = i;
+		if (NULL == hashTableAdd(table, &entry)) {
+			result = -9;
+			goto fail;
+		}
+	}
+	entry = tableSize;
+	if ((NULL != hashTableAdd(table, &entry)) || (tableSize != table->tableSize) || !findEntries(table, 0, tableSize, 1)) {
+		result = -10;
+		goto fail;
+	}
+
+fail:
+	hashTableFree(table);
+	return result;
+}
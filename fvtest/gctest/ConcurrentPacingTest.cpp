@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include <stdio.h>
+#include <vector>
+
+#include "ConcurrentPacingController.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#define PACING_TRACE_UNIT 1024
+#define PACING_TRACE_STEP_MICROS 1000
+
+/**
+ * Allocation trace for replaying concurrent mark pacing without a heap. See
+ * fvtest/gctest/configuration/concurrentPacing_bursty.trace for the format.
+ */
+struct PacingTrace {
+	uintptr_t freeAfterGC;
+	uintptr_t traceTarget;
+	uintptr_t kickoffThreshold;
+	uintptr_t kickoffBuffer;
+	float allocToTraceRate;
+	uintptr_t mutatorTraceCapacity;
+	uintptr_t backgroundTrace;
+	std::vector<std::pair<uintptr_t, uintptr_t> > phases; /**< steps, bytes allocated per step */
+};
+
+struct PacingResult {
+	uintptr_t cycles;
+	uintptr_t lateCycles; /**< cycles which ran out of free space before tracing completed */
+	uintptr_t lateCyclesAfterWarmup;
+	uint64_t untracedBytes; /**< trace work left to the stop-the-world collections */
+	uint64_t untracedBytesAfterWarmup;
+	uintptr_t pacedKickoffs; /**< kickoffs made by the controller ahead of the threshold */
+	std::vector<uint64_t> kickoffSteps;
+};
+
+static bool
+loadPacingTrace(const char *fileName, PacingTrace *trace)
+{
+	FILE *file = fopen(fileName, "r");
+	if (NULL == file) {
+		return false;
+	}
+
+	bool haveHeap = false;
+	bool haveTracer = false;
+	char line[256];
+	while (NULL != fgets(line, sizeof(line), file)) {
+		unsigned long a = 0;
+		unsigned long b = 0;
+		unsigned long c = 0;
+		unsigned long d = 0;
+		float rate = 0.0f;
+		if (4 == sscanf(line, "heap %lu %lu %lu %lu", &a, &b, &c, &d)) {
+			trace->freeAfterGC = a * PACING_TRACE_UNIT;
+			trace->traceTarget = b * PACING_TRACE_UNIT;
+			trace->kickoffThreshold = c * PACING_TRACE_UNIT;
+			trace->kickoffBuffer = d * PACING_TRACE_UNIT;
+			haveHeap = true;
+		} else if (3 == sscanf(line, "tracer %f %lu %lu", &rate, &a, &b)) {
+			trace->allocToTraceRate = rate;
+			trace->mutatorTraceCapacity = a * PACING_TRACE_UNIT;
+			trace->backgroundTrace = b * PACING_TRACE_UNIT;
+			haveTracer = true;
+		} else if (2 == sscanf(line, "phase %lu %lu", &a, &b)) {
+			trace->phases.push_back(std::make_pair((uintptr_t)a, (uintptr_t)(b * PACING_TRACE_UNIT)));
+		}
+	}
+	fclose(file);
+
+	return haveHeap && haveTracer && !trace->phases.empty();
+}
+
+/**
+ * Replay the trace. Kickoff happens at the fixed threshold, or earlier when a controller is given and
+ * asks for it. Mutators trace at the rate MM_ConcurrentGC::calculateTraceSize() would ask for, limited by
+ * how much they can trace per step, and a background thread traces at a constant rate. A cycle which
+ * finishes tracing collects at once; running out of free space leaves the rest of the trace target
+ * to the collection.
+ */
+static void
+replayPacingTrace(const PacingTrace *trace, MM_ConcurrentPacingController *controller, uintptr_t warmupCycles, PacingResult *result)
+{
+	uintptr_t freeBytes = trace->freeAfterGC;
+	uintptr_t work = 0;
+	bool active = false;
+	uint64_t step = 0;
+
+	*result = PacingResult();
+
+	for (size_t p = 0; p < trace->phases.size(); p++) {
+		for (uintptr_t s = 0; s < trace->phases[p].first; s++) {
+			uint64_t time = step * PACING_TRACE_STEP_MICROS;
+			uintptr_t allocated = OMR_MIN(trace->phases[p].second, freeBytes);
+			step += 1;
+
+			if (!active) {
+				bool pacingKickoff = false;
+				if (NULL != controller) {
+					if (controller->sampleNeeded(freeBytes)) {
+						controller->sample(time, freeBytes, 0);
+					}
+					pacingKickoff = controller->shouldKickoff(freeBytes, trace->traceTarget);
+				}
+				if ((freeBytes < trace->kickoffThreshold) || pacingKickoff) {
+					active = true;
+					work = 0;
+					result->kickoffSteps.push_back(step);
+					if (freeBytes >= trace->kickoffThreshold) {
+						result->pacedKickoffs += 1;
+					}
+					if (NULL != controller) {
+						controller->cycleStart(time, freeBytes, trace->traceTarget, trace->kickoffBuffer);
+					}
+				}
+			}
+
+			freeBytes -= allocated;
+
+			if (active) {
+				if ((NULL != controller) && controller->sampleNeeded(freeBytes)) {
+					controller->sample(time + PACING_TRACE_STEP_MICROS, freeBytes, work);
+				}
+				float rate = trace->allocToTraceRate * 2.0f;
+				if ((freeBytes > trace->kickoffBuffer) && (work < trace->traceTarget)) {
+					float required = (float)(trace->traceTarget - work) / (float)(freeBytes - trace->kickoffBuffer);
+					rate = OMR_MAX(OMR_MIN(required, trace->allocToTraceRate * 2.0f), trace->allocToTraceRate * 0.5f);
+				}
+				if (NULL != controller) {
+					rate = controller->adjustTraceRate(rate);
+				}
+				work += OMR_MIN((uintptr_t)((float)allocated * rate), trace->mutatorTraceCapacity) + trace->backgroundTrace;
+
+				if (work >= trace->traceTarget) {
+					if (NULL != controller) {
+						controller->cycleEnd(true, freeBytes, work);
+					}
+					result->cycles += 1;
+					active = false;
+					freeBytes = trace->freeAfterGC;
+					continue;
+				}
+			}
+
+			if (0 == freeBytes) {
+				/* A cycle which was never started leaves the whole trace target to the collection */
+				uintptr_t untraced = trace->traceTarget;
+				if (active) {
+					untraced -= work;
+					if (NULL != controller) {
+						controller->cycleEnd(false, freeBytes, work);
+					}
+				}
+				result->cycles += 1;
+				result->lateCycles += 1;
+				result->untracedBytes += untraced;
+				if (result->cycles > warmupCycles) {
+					result->lateCyclesAfterWarmup += 1;
+					result->untracedBytesAfterWarmup += untraced;
+				}
+				active = false;
+				freeBytes = trace->freeAfterGC;
+			}
+		}
+	}
+}
+
+TEST(gcFunctionalTestConcurrentPacing, burstyTraceReplay)
+{
+	const char *traceFile = "fvtest/gctest/configuration/concurrentPacing_bursty.trace";
+	const uintptr_t warmupCycles = 3;
+	PacingTrace trace;
+	ASSERT_TRUE(loadPacingTrace(traceFile, &trace)) << "unable to load " << traceFile;
+
+	PacingResult threshold;
+	replayPacingTrace(&trace, NULL, warmupCycles, &threshold);
+
+	MM_ConcurrentPacingController controller;
+	PacingResult paced;
+	replayPacingTrace(&trace, &controller, warmupCycles, &paced);
+
+	gcTestEnv->log(LEVEL_INFO, "threshold: cycles %zu late %zu untraced %llu KB\n",
+		threshold.cycles, threshold.lateCycles, (unsigned long long)(threshold.untracedBytes / PACING_TRACE_UNIT));
+	gcTestEnv->log(LEVEL_INFO, "paced:     cycles %zu late %zu untraced %llu KB paced kickoffs %zu kickoff scale %.3f\n",
+		paced.cycles, paced.lateCycles, (unsigned long long)(paced.untracedBytes / PACING_TRACE_UNIT), paced.pacedKickoffs, controller.getKickoffScale());
+
+	/* The trace is built so that the fixed threshold kicks off too late in the bursts */
+	ASSERT_LT(0u, threshold.lateCyclesAfterWarmup);
+	ASSERT_LT(0u, paced.pacedKickoffs);
+	ASSERT_LT(paced.lateCyclesAfterWarmup, threshold.lateCyclesAfterWarmup);
+	ASSERT_LT(paced.untracedBytesAfterWarmup, threshold.untracedBytesAfterWarmup);
+
+	/* Replaying with a fresh controller reproduces the same decisions */
+	MM_ConcurrentPacingController replayController;
+	PacingResult replay;
+	replayPacingTrace(&trace, &replayController, warmupCycles, &replay);
+	ASSERT_TRUE(paced.kickoffSteps == replay.kickoffSteps);
+	ASSERT_EQ(paced.untracedBytes, replay.untracedBytes);
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2018 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -28,7 +28,11 @@
 #include "omrgc.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryDecoder.hpp"
 #include "VerboseWriterChain.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SegregatedWriteBarrier.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 //#define OMRGCTEST_PRINTFILE
 
@@ -43,21 +47,46 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/workPacketDeques_GC_config.xml"
+                        , "fvtest/gctest/configuration/heapPreTouch_GC_config.xml"
+                        , "fvtest/gctest/configuration/heapUncommit_GC_config.xml"
+                        , "fvtest/gctest/configuration/asyncLogging_GC_config.xml"
+                        , "fvtest/gctest/configuration/binaryLogging_GC_config.xml"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregatedGenerational_GC_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/partitionedCardCleaning_GC_config.xml"
+                        , "fvtest/gctest/configuration/markMapClear_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/spinSync_GC_config.xml"
+                        , "fvtest/gctest/configuration/numaScavenger_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavengerHotFields_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavengerRememberedSet_GC_config.xml"
+                        , "fvtest/gctest/configuration/taskThreadCount_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/tlhAdaptive_GC_config.xml"
+                        , "fvtest/gctest/configuration/freeListSizeIndex_GC_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/markScaling_1threads_lists.xml",
+								"perftest/gctest/configuration/markScaling_4threads_lists.xml",
+								"perftest/gctest/configuration/markScaling_16threads_lists.xml",
+								"perftest/gctest/configuration/markScaling_64threads_lists.xml",
+								"perftest/gctest/configuration/markScaling_1threads_deques.xml",
+								"perftest/gctest/configuration/markScaling_4threads_deques.xml",
+								"perftest/gctest/configuration/markScaling_16threads_deques.xml",
+								"perftest/gctest/configuration/markScaling_64threads_deques.xml"};
 void
 GCConfigTest::SetUp()
 {
@@ -76,10 +105,6 @@ GCConfigTest::SetUp()
 	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
 	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
 
-	/* Kick off the dispatcher threads */
-	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
-	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
-
 	/* Instantiate collector interface */
 	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
 	cli = startupManager.createCollectorLanguageInterface(env);
@@ -116,6 +141,10 @@ GCConfigTest::SetUp()
 	verboseManager->enableVerboseGC();
 	verboseManager->setInitializedTime(omrtime_hires_clock());
 
+	/* Kick off the dispatcher threads once verbose GC is enabled, so that startup work such as heap pre-touch is reported */
+	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
 			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
@@ -617,7 +646,14 @@ GCConfigTest::attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry
 
 	if ((uint32_t)parentEntry->numOfRef < slotCount) {
 		fomrobject_t *childSlot = firstSlot + parentEntry->numOfRef;
-		standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		if (extensions->isSegregatedHeap()) {
+			segregatedWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+		} else
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+		{
+			standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+		}
 		gcTestEnv->log(LEVEL_VERBOSE, "\tadd child %s(%p[0x%llx]) to parent %s(%p[0x%llx]) slot %p[%llx].\n", 
 		               childEntry->name, childEntry->objPtr, childEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), childSlot, (uintptr_t)*childSlot);
 		parentEntry->numOfRef += 1;
@@ -809,6 +845,39 @@ printFile(const char *name)
 }
 #endif
 
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document *verboseDoc, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	if (!MM_VerboseBinaryDecoder::isBinaryLog(gcTestEnv->portLib, fileName)) {
+		return verboseDoc->load_file(fileName);
+	}
+
+	/* binary logs are verified through their conversion to XML */
+	pugi::xml_parse_result result;
+	result.status = pugi::status_io_error;
+	char xmlFile[MAX_NAME_LENGTH];
+	omrstr_printf(xmlFile, MAX_NAME_LENGTH, "%s.xml", fileName);
+	MM_VerboseBinaryDecoder *decoder = MM_VerboseBinaryDecoder::newInstance(gcTestEnv->portLib);
+	if (NULL != decoder) {
+		intptr_t xmlFileDescriptor = omrfile_open(xmlFile, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 != xmlFileDescriptor) {
+			bool converted = decoder->open(fileName) && decoder->writeXML(xmlFileDescriptor);
+			omrfile_close(xmlFileDescriptor);
+			if (converted) {
+				result = verboseDoc->load_file(xmlFile);
+			} else {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to convert binary verbose log %s to XML.\n", __FILE__, __LINE__, fileName);
+			}
+			if (false == gcTestEnv->keepLog) {
+				omrfile_unlink(xmlFile);
+			}
+		}
+		decoder->kill();
+	}
+	return result;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -830,7 +899,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseLog(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +907,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseLog(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -1044,6 +1113,8 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
+			/* the log may still be written out by a background thread */
+			verboseManager->flushStreams(env);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "omrExampleVM.hpp"
+#include "SlotObject.hpp"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#define MAX_NAME_LENGTH 512
+
+/**
+ * Runs with -Xgc:compactIncremental against a heap that is fragmented on purpose, so that global collections
+ * evacuate the most fragmented window of old space, and checks that every reference survives the moves.
+ */
+class IncrementalCompactionTest : public GCConfigTest
+{
+protected:
+	static const int32_t anchorCount = 64;
+	static const uintptr_t objectSize = 512;
+	/* large enough for the holes to be free entries rather than dark matter, too small to be reused as pages */
+	static const uintptr_t holeSize = 2048;
+
+	char *
+	nameOf(char *buffer, const char *namePrefix, int32_t nthInRow)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		omrstr_printf(buffer, MAX_NAME_LENGTH, "%s_0_%d", namePrefix, nthInRow);
+		return buffer;
+	}
+
+	int32_t
+	addToRootTable(const char *name)
+	{
+		ObjectEntry *objectEntry = find(name);
+		if (NULL == objectEntry) {
+			return 1;
+		}
+		RootEntry rootEntry;
+		rootEntry.name = objectEntry->name;
+		rootEntry.rootPtr = objectEntry->objPtr;
+		return (NULL == hashTableAdd(exampleVM->rootTable, &rootEntry)) ? 1 : 0;
+	}
+
+	omrobjectptr_t
+	readSlot(ObjectEntry *objectEntry, int32_t slotIndex)
+	{
+		GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)objectEntry->objPtr + 1 + slotIndex);
+		return slotObject.readReferenceFromSlot();
+	}
+
+	/**
+	 * Allocate the kept objects of a chain, each one referenced by its predecessor and by an anchor,
+	 * with a garbage object after each of them.
+	 */
+	int32_t
+	allocateFragmentedChain(int32_t keptCount)
+	{
+		char name[MAX_NAME_LENGTH];
+		char otherName[MAX_NAME_LENGTH];
+		for (int32_t i = 0; i < keptCount; i++) {
+			if (NULL == createObject("kept", NORMAL, 0, i, objectSize)) {
+				return 1;
+			}
+			if (0 != attachChildEntry(find(nameOf(otherName, "anchor", i % anchorCount)), find(nameOf(name, "kept", i)))) {
+				return 1;
+			}
+			if ((0 < i) && (0 != attachChildEntry(find(nameOf(otherName, "kept", i - 1)), find(name)))) {
+				return 1;
+			}
+			if (NULL == createObject("dropped", GARBAGE_TOP, 0, i, holeSize)) {
+				return 1;
+			}
+		}
+		return 0;
+	}
+
+	/**
+	 * Check that every slot of the chain and of the anchors, and every root, refers to the current location of its object.
+	 */
+	int32_t
+	verifyFragmentedChain(int32_t keptCount)
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		char name[MAX_NAME_LENGTH];
+		char otherName[MAX_NAME_LENGTH];
+		uintptr_t expectedSize = extensions->objectModel.adjustSizeInBytes(objectSize);
+		for (int32_t i = 0; i < keptCount; i++) {
+			ObjectEntry *kept = find(nameOf(name, "kept", i));
+			if ((NULL == kept) || (expectedSize != extensions->objectModel.getConsumedSizeInBytesWithHeader(kept->objPtr))) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %s is missing or corrupt.\n", __FILE__, __LINE__, name);
+				return 1;
+			}
+			if (i + 1 < keptCount) {
+				ObjectEntry *next = find(nameOf(otherName, "kept", i + 1));
+				if ((NULL == next) || (next->objPtr != readSlot(find(name), 0))) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Slot of %s does not refer to %s.\n", __FILE__, __LINE__, name, otherName);
+					return 1;
+				}
+			}
+			ObjectEntry *anchor = find(nameOf(otherName, "anchor", i % anchorCount));
+			if ((NULL == anchor) || (find(name)->objPtr != readSlot(anchor, i / anchorCount))) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Slot of %s does not refer to %s.\n", __FILE__, __LINE__, otherName, name);
+				return 1;
+			}
+		}
+		for (int32_t i = 0; i < anchorCount; i++) {
+			RootEntry searchEntry;
+			searchEntry.name = nameOf(name, "anchor", i);
+			RootEntry *rootEntry = (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
+			if ((NULL == rootEntry) || (find(name)->objPtr != rootEntry->rootPtr)) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Root %s does not refer to its object.\n", __FILE__, __LINE__, name);
+				return 1;
+			}
+		}
+		return 0;
+	}
+
+	int32_t
+	verifyConfiguredVerboseGC()
+	{
+		pugi::xpath_node_set verboseGCs = doc.select_nodes("/gc-config/verification/verboseGC");
+		/* the log may still be written out by a background thread */
+		verboseManager->flushStreams(env);
+		return verifyVerboseGC(verboseGCs);
+	}
+};
+
+TEST_P(IncrementalCompactionTest, fragmentedWindowIsEvacuatedWithoutLosingReferences)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->compactIncremental);
+
+	/* fill three quarters of the heap, leaving one small hole after each live object */
+	int32_t keptCount = (int32_t)(((extensions->heap->getActiveMemorySize() / 4) * 3) / (objectSize + holeSize));
+	uintptr_t anchorSize = ((keptCount / anchorCount) + 1) * sizeof(fomrobject_t) + sizeof(uintptr_t);
+	char name[MAX_NAME_LENGTH];
+	for (int32_t i = 0; i < anchorCount; i++) {
+		ASSERT_TRUE(NULL != createObject("anchor", ROOT, 0, i, anchorSize));
+		ASSERT_EQ(0, addToRootTable(nameOf(name, "anchor", i)));
+	}
+	ASSERT_EQ(0, allocateFragmentedChain(keptCount));
+
+	/* the first collection frees the holes and selects the window, later ones evacuate it */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	ASSERT_EQ(0, verifyFragmentedChain(keptCount));
+
+	/* allocate garbage until global collections, concurrent ones if enabled, have run on their own */
+	uintptr_t globalCount = extensions->globalGCStats.gcCount;
+	for (int32_t i = 0; extensions->globalGCStats.gcCount < globalCount + 3; i++) {
+		ASSERT_TRUE(NULL != createObject("garbage", GARBAGE_TOP, 0, i, objectSize));
+	}
+	ASSERT_EQ(0, verifyFragmentedChain(keptCount));
+
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	ASSERT_EQ(0, verifyFragmentedChain(keptCount));
+
+	ASSERT_EQ(0, verifyConfiguredVerboseGC()) << "Failed in verbose GC verification.";
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, IncrementalCompactionTest,
+        ::testing::Values("fvtest/gctest/configuration/incrementalCompaction_GC_config.xml"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                        , "fvtest/gctest/configuration/incrementalCompactionConcurrent_GC_config.xml"
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+                        ));
+
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
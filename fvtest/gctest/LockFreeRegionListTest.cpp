@@ -0,0 +1,211 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrgc.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCConfigTest.hpp"
+#include "omrExampleVM.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "FreeHeapRegionList.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "LockFreeRegionStack.hpp"
+#include "RegionPoolSegregated.hpp"
+
+#define STACK_INDICES 1024
+#define STACK_THREADS 4
+#define STACK_ROUNDS 20000
+#define STACK_INDICES_HELD 8
+
+typedef struct StackThreadData {
+	MM_LockFreeRegionStack *stack;
+	volatile uintptr_t *owned; /**< 1 for each index some thread has popped and not pushed back yet */
+	uintptr_t duplicates;
+	uintptr_t pops;
+} StackThreadData;
+
+/**
+ * Pop up to STACK_INDICES_HELD indices at a time, claim each one, then release and push them back.
+ * An index that is already claimed when it is popped was handed out twice.
+ */
+static int J9THREAD_PROC
+stackThread(void *entryArg)
+{
+	StackThreadData *data = (StackThreadData *)entryArg;
+	uintptr_t held[STACK_INDICES_HELD];
+
+	for (uintptr_t round = 0; round < STACK_ROUNDS; round++) {
+		uintptr_t heldCount = 0;
+		uintptr_t wanted = 1 + (round % STACK_INDICES_HELD);
+		while ((heldCount < wanted) && data->stack->pop(&held[heldCount])) {
+			if (0 != MM_AtomicOperations::lockCompareExchange(&data->owned[held[heldCount]], 0, 1)) {
+				data->duplicates += 1;
+			}
+			heldCount += 1;
+		}
+		data->pops += heldCount;
+		while (0 < heldCount) {
+			heldCount -= 1;
+			data->owned[held[heldCount]] = 0;
+			data->stack->push(held[heldCount]);
+		}
+	}
+	return 0;
+}
+
+TEST(gcFunctionalTestLockFreeRegionStack, concurrentPushPopKeepsEveryIndex)
+{
+	volatile uint32_t links[STACK_INDICES];
+	volatile uintptr_t owned[STACK_INDICES];
+	MM_LockFreeRegionStack stack;
+	stack.initialize(links);
+
+	for (uintptr_t i = 0; i < STACK_INDICES; i++) {
+		owned[i] = 0;
+		stack.push(i);
+	}
+	ASSERT_EQ((uintptr_t)STACK_INDICES, stack.getCount());
+
+	omrthread_t handles[STACK_THREADS];
+	StackThreadData data[STACK_THREADS];
+	omrthread_attr_t attr = NULL;
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	for (uintptr_t t = 0; t < STACK_THREADS; t++) {
+		data[t].stack = &stack;
+		data[t].owned = owned;
+		data[t].duplicates = 0;
+		data[t].pops = 0;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&handles[t], &attr, 0, stackThread, &data[t]));
+	}
+	for (uintptr_t t = 0; t < STACK_THREADS; t++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(handles[t]));
+		EXPECT_EQ((uintptr_t)0, data[t].duplicates) << "thread " << t << " popped an index another thread held";
+		EXPECT_LT((uintptr_t)0, data[t].pops);
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+
+	/* once the threads are done the count is exact, and every index is on the stack exactly once */
+	ASSERT_EQ((uintptr_t)STACK_INDICES, stack.getCount());
+	bool seen[STACK_INDICES];
+	for (uintptr_t i = 0; i < STACK_INDICES; i++) {
+		seen[i] = false;
+	}
+	uintptr_t index = 0;
+	uintptr_t popped = 0;
+	while (stack.pop(&index)) {
+		ASSERT_GT((uintptr_t)STACK_INDICES, index);
+		ASSERT_FALSE(seen[index]) << "index " << index << " was on the stack twice";
+		seen[index] = true;
+		popped += 1;
+	}
+	EXPECT_EQ((uintptr_t)STACK_INDICES, popped);
+	EXPECT_TRUE(stack.isEmpty());
+	EXPECT_EQ((uintptr_t)0, stack.getCount());
+}
+
+/**
+ * Runs against a segregated heap, whose region pool keeps its single free regions on a lock-free list.
+ */
+class LockFreeRegionListTest : public GCConfigTest
+{
+protected:
+	MM_RegionPoolSegregated *
+	getRegionPool()
+	{
+		return ((MM_GlobalAllocationManagerSegregated *)env->getExtensions()->globalAllocationManager)->getRegionPool();
+	}
+};
+
+TEST_P(LockFreeRegionListTest, refillCarvesOneBatchOfSingleRegions)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_HeapRegionManager *regionManager = extensions->heapRegionManager;
+	MM_RegionPoolSegregated *regionPool = getRegionPool();
+	MM_FreeHeapRegionList *singleFreeList = regionPool->getSingleFreeList();
+	const uintptr_t batch = 6;
+	uintptr_t savedBatch = extensions->segregatedRegionRefillBatch;
+	ASSERT_TRUE(singleFreeList->isLockFree());
+
+	/* set the single free regions aside, so the refill starts from an empty list */
+	MM_HeapRegionDescriptorSegregated *setAside[STACK_INDICES];
+	uintptr_t setAsideCount = 0;
+	while ((setAsideCount < STACK_INDICES) && (NULL != (setAside[setAsideCount] = singleFreeList->pop()))) {
+		setAsideCount += 1;
+	}
+	ASSERT_TRUE(singleFreeList->isEmpty());
+	ASSERT_EQ((uintptr_t)0, singleFreeList->getTotalRegions());
+
+	uintptr_t singleFree = 0;
+	uintptr_t multiFree = 0;
+	uintptr_t coalesceFree = 0;
+	regionPool->countFreeRegions(&singleFree, &multiFree, &coalesceFree);
+	ASSERT_LE(batch, multiFree);
+
+	extensions->segregatedRegionRefillBatch = batch;
+	bool refilled = regionPool->refillSingleFreeList(env);
+	extensions->segregatedRegionRefillBatch = savedBatch;
+	ASSERT_TRUE(refilled);
+
+	uintptr_t multiFreeAfter = 0;
+	regionPool->countFreeRegions(&singleFree, &multiFreeAfter, &coalesceFree);
+	EXPECT_EQ(batch, singleFree);
+	EXPECT_EQ(multiFree - batch, multiFreeAfter);
+
+	/* the batch is one range of consecutive regions, each now a free region of its own */
+	MM_HeapRegionDescriptorSegregated *refill[batch];
+	uintptr_t lowestIndex = UDATA_MAX;
+	for (uintptr_t i = 0; i < batch; i++) {
+		refill[i] = singleFreeList->pop();
+		ASSERT_TRUE(NULL != refill[i]);
+		EXPECT_TRUE(refill[i]->isFree());
+		EXPECT_EQ((uintptr_t)1, refill[i]->getRange());
+		lowestIndex = OMR_MIN(lowestIndex, regionManager->mapDescriptorToRegionTableIndex(refill[i]));
+	}
+	EXPECT_TRUE(singleFreeList->isEmpty());
+	for (uintptr_t i = 0; i < batch; i++) {
+		EXPECT_EQ((void *)refill[batch - 1 - i], (void *)regionManager->mapRegionTableIndexToDescriptor(lowestIndex + i)) << "refill " << i << " is not the next region of the range";
+	}
+
+	/* return every region, as single free regions */
+	for (uintptr_t i = 0; i < batch; i++) {
+		regionPool->addFreeRegion(env, refill[i], true);
+	}
+	while (0 < setAsideCount) {
+		setAsideCount -= 1;
+		regionPool->addFreeRegion(env, setAside[setAsideCount], true);
+	}
+	regionPool->countFreeRegions(&singleFree, &multiFreeAfter, &coalesceFree);
+	EXPECT_EQ(multiFree - batch, multiFreeAfter);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, LockFreeRegionListTest,
+        ::testing::Values("fvtest/gctest/configuration/segregatedGenerational_GC_config.xml"));
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
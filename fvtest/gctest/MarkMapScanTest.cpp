@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+
+#include "MarkMapScan.hpp"
+
+#include "gcTestHelpers.hpp"
+
+/**
+ * Fill a synthetic mark map in which each slot is non-empty with probability 1/oneIn (0 means all slots empty).
+ */
+static void
+fillMarkMap(uintptr_t *map, uintptr_t slotCount, uintptr_t oneIn, uintptr_t seed)
+{
+	uintptr_t state = seed;
+	for (uintptr_t i = 0; i < slotCount; i++) {
+		state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+		map[i] = ((0 != oneIn) && (0 == ((state >> 16) % oneIn))) ? ((uintptr_t)1 << ((state >> 8) % (sizeof(uintptr_t) * 8))) : 0;
+	}
+}
+
+/**
+ * Walk the map the way sweep does: skip an empty run, step over the live slot, repeat.
+ * @return the number of non-empty slots found
+ */
+static uintptr_t
+walkMarkMap(MM_MarkMapScan::FindNonEmptySlot kernel, uintptr_t *map, uintptr_t slotCount)
+{
+	uintptr_t *current = map;
+	uintptr_t *top = map + slotCount;
+	uintptr_t found = 0;
+	while (current < top) {
+		current = MM_MarkMapScan::findNonEmptySlot(kernel, current, top);
+		if (current < top) {
+			found += 1;
+			current += 1;
+		}
+	}
+	return found;
+}
+
+TEST(gcFunctionalTestMarkMapScan, kernelsMatchScalar)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	const uintptr_t slotCount = 4096;
+	const uintptr_t densities[] = { 0, 2, 7, 64, 1000 };
+	uintptr_t *map = (uintptr_t *)omrmem_allocate_memory(slotCount * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != map);
+
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillMarkMap(map, slotCount, densities[d], d + 1);
+		for (uintptr_t k = MM_MarkMapScan::kernel_scalar; k < MM_MarkMapScan::kernel_count; k++) {
+			MM_MarkMapScan::FindNonEmptySlot kernel = MM_MarkMapScan::getKernel((MM_MarkMapScan::Kernel)k);
+			if ((NULL == kernel) || (k > (uintptr_t)MM_MarkMapScan::selectKernel(gcTestEnv->portLib))) {
+				continue;
+			}
+			/* every start slot and a spread of range ends, to cover alignment prologues and tails */
+			for (uintptr_t start = 0; start < 67; start++) {
+				for (uintptr_t end = start; end < slotCount; end += 61) {
+					uintptr_t *expected = MM_MarkMapScan::findNonEmptySlotScalar(map + start, map + end);
+					ASSERT_EQ(expected, kernel(map + start, map + end)) << MM_MarkMapScan::getKernelName((MM_MarkMapScan::Kernel)k)
+						<< " density 1/" << densities[d] << " range [" << start << ", " << end << ")";
+				}
+			}
+		}
+	}
+
+	omrmem_free_memory(map);
+}
+
+TEST(perfTestMarkMapScan, sweepWalk)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	/* 64MB of mark map covers a 4GB heap at 64 heap bytes per mark bit */
+	const uintptr_t slotCount = (64 * 1024 * 1024) / sizeof(uintptr_t);
+	const uintptr_t densities[] = { 0, 65536, 4096, 256, 16, 2 };
+	const uintptr_t iterations = 5;
+	uintptr_t *map = (uintptr_t *)omrmem_allocate_memory(slotCount * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != map);
+
+	MM_MarkMapScan::Kernel selected = MM_MarkMapScan::selectKernel(gcTestEnv->portLib);
+	gcTestEnv->log(LEVEL_INFO, "selected mark map scan kernel: %s\n", MM_MarkMapScan::getKernelName(selected));
+
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillMarkMap(map, slotCount, densities[d], d + 1);
+		uintptr_t expectedFound = walkMarkMap(MM_MarkMapScan::findNonEmptySlotScalar, map, slotCount);
+		for (uintptr_t k = MM_MarkMapScan::kernel_scalar; k <= (uintptr_t)selected; k++) {
+			MM_MarkMapScan::FindNonEmptySlot kernel = MM_MarkMapScan::getKernel((MM_MarkMapScan::Kernel)k);
+			if (NULL == kernel) {
+				continue;
+			}
+			uint64_t bestMicros = UINT64_MAX;
+			for (uintptr_t i = 0; i < iterations; i++) {
+				uint64_t start = omrtime_hires_clock();
+				uintptr_t found = walkMarkMap(kernel, map, slotCount);
+				uint64_t micros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+				ASSERT_EQ(expectedFound, found);
+				if (micros < bestMicros) {
+					bestMicros = micros;
+				}
+			}
+			double gbPerSecond = (0 == bestMicros) ? 0.0 : ((double)(slotCount * sizeof(uintptr_t)) / (double)bestMicros) / 1000.0;
+			gcTestEnv->log(LEVEL_INFO, "density 1/%-6zu kernel %-6s best %8llu us  %6.2f GB/s\n",
+				densities[d], MM_MarkMapScan::getKernelName((MM_MarkMapScan::Kernel)k), (unsigned long long)bestMicros, gbPerSecond);
+		}
+	}
+
+	omrmem_free_memory(map);
+}
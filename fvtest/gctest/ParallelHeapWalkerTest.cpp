@@ -0,0 +1,243 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCConfigTest.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "MarkMap.hpp"
+#include "omrExampleVM.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#define MAX_NAME_LENGTH 512
+/* objects are binned by the log2 of their size, which covers every size the test allocates */
+#define CENSUS_SIZE_CLASSES 32
+
+/**
+ * A heap census: how many objects of each size class there are, with a checksum of their addresses.
+ */
+typedef struct HeapCensus {
+	uintptr_t objectCount;
+	uintptr_t objectBytes;
+	uintptr_t addressSum;
+	uintptr_t sizeClassCounts[CENSUS_SIZE_CLASSES];
+} HeapCensus;
+
+/**
+ * The censuses taken at the end of the sweep of a global collection, when the mark map is still valid.
+ */
+typedef struct HeapWalkCensuses {
+	bool taken;
+	/* serial walks of the parsed heap, of every object and of the marked ones only */
+	HeapCensus serialAll;
+	HeapCensus serialMarked;
+	/* parallel walks of the marked objects and, with the mark map set aside, of the parsed heap */
+	HeapCensus parallelMarked;
+	HeapCensus parallelAll;
+} HeapWalkCensuses;
+
+static void
+countObject(OMR_VMThread *omrVMThread, omrobjectptr_t object, HeapCensus *census)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	uintptr_t sizeClass = 0;
+	while (((uintptr_t)2 << sizeClass) <= size) {
+		sizeClass += 1;
+	}
+	census->objectCount += 1;
+	census->objectBytes += size;
+	census->addressSum += (uintptr_t)object;
+	census->sizeClassCounts[OMR_MIN(sizeClass, CENSUS_SIZE_CLASSES - 1)] += 1;
+}
+
+static void
+censusObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	countObject(omrVMThread, object, (HeapCensus *)userData);
+}
+
+static void
+censusMarkedObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkCensuses *censuses = (HeapWalkCensuses *)userData;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+	countObject(omrVMThread, object, &censuses->serialAll);
+	if (globalCollector->getParallelHeapWalker()->getMarkMap()->isBitSet(object)) {
+		countObject(omrVMThread, object, &censuses->serialMarked);
+	}
+}
+
+static void
+mergeCensus(OMR_VMThread *omrVMThread, void *accumulator, void *userData)
+{
+	HeapCensus *threadCensus = (HeapCensus *)accumulator;
+	HeapCensus *census = (HeapCensus *)userData;
+	census->objectCount += threadCensus->objectCount;
+	census->objectBytes += threadCensus->objectBytes;
+	census->addressSum += threadCensus->addressSum;
+	for (uintptr_t i = 0; i < CENSUS_SIZE_CLASSES; i++) {
+		census->sizeClassCounts[i] += threadCensus->sizeClassCounts[i];
+	}
+}
+
+/**
+ * Take a census of the live objects in parallel, with a census per thread merged at the end.
+ */
+static bool
+parallelCensus(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, HeapCensus *census)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t accumulatorCount = heapWalker->getAccumulatorCount(env);
+	HeapCensus *threadCensuses = (HeapCensus *)omrmem_allocate_memory(accumulatorCount * (sizeof(HeapCensus) + sizeof(void *)), OMRMEM_CATEGORY_MM);
+	if (NULL == threadCensuses) {
+		return false;
+	}
+	void **accumulators = (void **)(threadCensuses + accumulatorCount);
+	memset(threadCensuses, 0, accumulatorCount * sizeof(HeapCensus));
+	for (uintptr_t i = 0; i < accumulatorCount; i++) {
+		accumulators[i] = &threadCensuses[i];
+	}
+	heapWalker->allLiveObjectsDo(env, censusObject, accumulators, mergeCensus, census, MEMORY_TYPE_RAM, false);
+	omrmem_free_memory(threadCensuses);
+	return true;
+}
+
+/**
+ * Once the first global sweep has completed, take every census of the heap while the mark map is valid.
+ */
+static void
+hookSweepEndCensus(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_SweepEndEvent *event = (MM_SweepEndEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+	MM_ParallelHeapWalker *heapWalker = globalCollector->getParallelHeapWalker();
+	MM_MarkMap *markMap = heapWalker->getMarkMap();
+	HeapWalkCensuses *censuses = (HeapWalkCensuses *)userData;
+
+	if (censuses->taken || !markMap->isMarkMapValid()) {
+		return;
+	}
+	censuses->taken = true;
+
+	heapWalker->MM_HeapWalker::allObjectsDo(env, censusMarkedObject, censuses, MEMORY_TYPE_RAM, false, false);
+	if (!parallelCensus(env, heapWalker, &censuses->parallelMarked)) {
+		censuses->taken = false;
+		return;
+	}
+	/* without a valid mark map the walk parses the heap, which has just been swept and is walkable */
+	markMap->setMarkMapValid(false);
+	if (!parallelCensus(env, heapWalker, &censuses->parallelAll)) {
+		censuses->taken = false;
+	}
+	markMap->setMarkMapValid(true);
+}
+
+/**
+ * Runs a parallel census of the heap next to a serial walk of it, both with and without the mark map.
+ */
+class ParallelHeapWalkerTest : public GCConfigTest
+{
+protected:
+	int32_t
+	addToRootTable(const char *name)
+	{
+		ObjectEntry *objectEntry = find(name);
+		if (NULL == objectEntry) {
+			return 1;
+		}
+		RootEntry rootEntry;
+		rootEntry.name = objectEntry->name;
+		rootEntry.rootPtr = objectEntry->objPtr;
+		return (NULL == hashTableAdd(exampleVM->rootTable, &rootEntry)) ? 1 : 0;
+	}
+
+	void
+	expectSameCensus(HeapCensus *expected, HeapCensus *actual, const char *walk)
+	{
+		EXPECT_EQ(expected->objectCount, actual->objectCount) << walk;
+		EXPECT_EQ(expected->objectBytes, actual->objectBytes) << walk;
+		EXPECT_EQ(expected->addressSum, actual->addressSum) << walk;
+		for (uintptr_t i = 0; i < CENSUS_SIZE_CLASSES; i++) {
+			EXPECT_EQ(expected->sizeClassCounts[i], actual->sizeClassCounts[i]) << walk << " size class " << i;
+		}
+	}
+
+	int32_t
+	verifyConfiguredVerboseGC()
+	{
+		pugi::xpath_node_set verboseGCs = doc.select_nodes("/gc-config/verification/verboseGC");
+		/* the log may still be written out by a background thread */
+		verboseManager->flushStreams(env);
+		return verifyVerboseGC(verboseGCs);
+	}
+};
+
+TEST_P(ParallelHeapWalkerTest, parallelWalkVisitsTheObjectsOfSerialWalk)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	char name[MAX_NAME_LENGTH];
+
+	/* roots keeping objects of a spread of sizes alive, with garbage between them */
+	const uintptr_t sizes[] = { 24, 64, 200, 1024, 4096, 20000 };
+	const uintptr_t sizeCount = sizeof(sizes) / sizeof(sizes[0]);
+	uintptr_t liveBytes = extensions->heap->getMaximumMemorySize() / 4;
+	int32_t keptCount = 0;
+	for (uintptr_t allocated = 0; allocated < liveBytes; keptCount++) {
+		uintptr_t size = sizes[keptCount % sizeCount];
+		ASSERT_TRUE(NULL != createObject("kept", ROOT, 0, keptCount, size));
+		omrstr_printf(name, MAX_NAME_LENGTH, "kept_0_%d", keptCount);
+		ASSERT_EQ(0, addToRootTable(name));
+		ASSERT_TRUE(NULL != createObject("dropped", GARBAGE_TOP, 0, keptCount, sizes[(keptCount + 1) % sizeCount]));
+		allocated += size;
+	}
+
+	HeapWalkCensuses censuses;
+	memset(&censuses, 0, sizeof(censuses));
+	J9HookInterface **mmPrivateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+	ASSERT_EQ(0, (*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, hookSweepEndCensus, OMR_GET_CALLSITE(), &censuses));
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	(*mmPrivateHooks)->J9HookUnregister(mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, hookSweepEndCensus, &censuses);
+	ASSERT_TRUE(censuses.taken);
+
+	/* every root is marked, and the dead objects between them are still parsed by the serial walk */
+	ASSERT_LE((uintptr_t)keptCount, censuses.serialMarked.objectCount);
+	ASSERT_LT(censuses.serialMarked.objectCount, censuses.serialAll.objectCount);
+	expectSameCensus(&censuses.serialMarked, &censuses.parallelMarked, "parallel walk of the mark map");
+	expectSameCensus(&censuses.serialAll, &censuses.parallelAll, "parallel walk of the parsed heap");
+
+	ASSERT_EQ(0, verifyConfiguredVerboseGC()) << "Failed in verbose GC verification.";
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ParallelHeapWalkerTest,
+        ::testing::Values("fvtest/gctest/configuration/parallelHeapWalk_GC_config.xml"));
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCConfigTest.hpp"
+#include "omrExampleVM.hpp"
+#include "SlotObject.hpp"
+#include "StandardWriteBarrier.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "Scavenger.hpp"
+#include "ScavengerHotFieldTable.hpp"
+
+#define MAX_NAME_LENGTH 512
+
+/**
+ * Builds young linked lists whose nodes all have the same size, each list linking its nodes through a slot of
+ * its own, and lets scavenges learn the hot fields of the nodes. Nodes are allocated in rounds across the lists,
+ * in a shuffled order, so that consecutive nodes of a list are only adjacent once they are copied together.
+ */
+class ScavengerHotFieldTest : public GCConfigTest
+{
+protected:
+	struct ListShape {
+		const char *namePrefix;
+		int32_t nextSlot; /**< slot of a node which refers to the next node, the other slots are NULL */
+	};
+
+	static const int32_t nodeSlotCount = 4;
+	static const uintptr_t garbageSize = 1024;
+
+	char *
+	nameOf(char *buffer, const char *namePrefix, int32_t list, int32_t node)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		omrstr_printf(buffer, MAX_NAME_LENGTH, "%s_%d_%d", namePrefix, list, node);
+		return buffer;
+	}
+
+	int32_t
+	addToRootTable(const char *name)
+	{
+		ObjectEntry *objectEntry = find(name);
+		if (NULL == objectEntry) {
+			return 1;
+		}
+		RootEntry rootEntry;
+		rootEntry.name = objectEntry->name;
+		rootEntry.rootPtr = objectEntry->objPtr;
+		return (NULL == hashTableAdd(exampleVM->rootTable, &rootEntry)) ? 1 : 0;
+	}
+
+	omrobjectptr_t
+	readSlot(omrobjectptr_t objectPtr, int32_t slot)
+	{
+		GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)objectPtr + 1 + slot);
+		return slotObject.readReferenceFromSlot();
+	}
+
+	/**
+	 * Allocate listCount lists of nodeCount nodes for each shape, the heads of the lists being roots.
+	 */
+	int32_t
+	allocateLists(const ListShape *shapes, int32_t shapeCount, int32_t listCount, int32_t nodeCount)
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		int32_t *order = (int32_t *)omrmem_allocate_memory(listCount * sizeof(int32_t), OMRMEM_CATEGORY_MM);
+		if (NULL == order) {
+			return 1;
+		}
+		for (int32_t list = 0; list < listCount; list++) {
+			order[list] = list;
+		}
+		int32_t rc = 0;
+		uint64_t state = 1;
+		for (int32_t node = 0; (0 == rc) && (node < nodeCount); node++) {
+			for (int32_t i = listCount - 1; 0 < i; i--) {
+				state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+				int32_t j = (int32_t)((state >> 33) % (uint64_t)(i + 1));
+				int32_t swap = order[i];
+				order[i] = order[j];
+				order[j] = swap;
+			}
+			for (int32_t s = 0; (0 == rc) && (s < shapeCount); s++) {
+				for (int32_t i = 0; (0 == rc) && (i < listCount); i++) {
+					rc = allocateNode(&shapes[s], order[i], node);
+				}
+			}
+		}
+		omrmem_free_memory(order);
+		return rc;
+	}
+
+	/**
+	 * Allocate a node and link it from the previous node of its list, or add it to the roots if it is the head.
+	 */
+	int32_t
+	allocateNode(const ListShape *shape, int32_t list, int32_t node)
+	{
+		uintptr_t nodeSize = sizeof(uintptr_t) + (nodeSlotCount * sizeof(fomrobject_t));
+		char name[MAX_NAME_LENGTH];
+		char previousName[MAX_NAME_LENGTH];
+		if (NULL == createObject(shape->namePrefix, (0 == node) ? ROOT : NORMAL, list, node, nodeSize)) {
+			return 1;
+		}
+		nameOf(name, shape->namePrefix, list, node);
+		if (0 == node) {
+			return addToRootTable(name);
+		}
+		ObjectEntry *previous = find(nameOf(previousName, shape->namePrefix, list, node - 1));
+		if (NULL == previous) {
+			return 1;
+		}
+		fomrobject_t *nextSlot = (fomrobject_t *)previous->objPtr + 1 + shape->nextSlot;
+		standardWriteBarrierStore(exampleVM->_omrVMThread, previous->objPtr, nextSlot, find(name)->objPtr);
+		return 0;
+	}
+
+	/**
+	 * Allocate garbage until the given number of scavenges have completed.
+	 */
+	int32_t
+	scavenge(uintptr_t scavengeCount)
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t targetCount = extensions->scavengerStats._gcCount + scavengeCount;
+		for (int32_t i = 0; extensions->scavengerStats._gcCount < targetCount; i++) {
+			if (NULL == createObject("garbage", GARBAGE_TOP, 0, i, garbageSize)) {
+				return 1;
+			}
+		}
+		return 0;
+	}
+
+	omrobjectptr_t
+	findHead(const ListShape *shape, int32_t list)
+	{
+		char name[MAX_NAME_LENGTH];
+		RootEntry searchEntry;
+		searchEntry.name = nameOf(name, shape->namePrefix, list, 0);
+		RootEntry *rootEntry = (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
+		return (NULL == rootEntry) ? NULL : rootEntry->rootPtr;
+	}
+
+	/**
+	 * @return the number of nodes reached by following the next slot from the head of a list
+	 */
+	int32_t
+	countNodes(const ListShape *shape, int32_t list)
+	{
+		int32_t count = 0;
+		for (omrobjectptr_t node = findHead(shape, list); NULL != node; node = readSlot(node, shape->nextSlot)) {
+			count += 1;
+		}
+		return count;
+	}
+
+	int32_t
+	verifyConfiguredVerboseGC()
+	{
+		pugi::xpath_node_set verboseGCs = doc.select_nodes("/gc-config/verification/verboseGC");
+		/* the log may still be written out by a background thread */
+		verboseManager->flushStreams(env);
+		return verifyVerboseGC(verboseGCs);
+	}
+};
+
+class ScavengerHotFieldLocalityTest : public ScavengerHotFieldTest {};
+
+TEST_P(ScavengerHotFieldTest, learnedHotFieldsFollowNodeShape)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	ASSERT_TRUE(extensions->scavengerLearnHotFields);
+	MM_ScavengerHotFieldTable *hotFieldTable = extensions->scavenger->getHotFieldTable();
+	ASSERT_TRUE(NULL != hotFieldTable);
+
+	/* nodes of both shapes have the same size, so only their shape tells them apart */
+	const ListShape shapes[] = { { "firstSlotList", 0 }, { "thirdSlotList", 2 } };
+	const int32_t shapeCount = sizeof(shapes) / sizeof(shapes[0]);
+	const int32_t listCount = 16;
+	const int32_t nodeCount = 256;
+	ASSERT_EQ(0, allocateLists(shapes, shapeCount, listCount, nodeCount));
+
+	/* samples of the first scavenge are published for the second one, which depth copies the nodes */
+	ASSERT_EQ(0, scavenge(2));
+
+	uintptr_t classKeys[shapeCount];
+	for (int32_t s = 0; s < shapeCount; s++) {
+		for (int32_t list = 0; list < listCount; list++) {
+			ASSERT_EQ(nodeCount, countNodes(&shapes[s], list)) << "list " << list << " of " << shapes[s].namePrefix;
+		}
+		omrobjectptr_t node = findHead(&shapes[s], 0);
+		classKeys[s] = extensions->scavenger->getDelegate()->getHotFieldClassKey(env, node);
+		ASSERT_NE((uintptr_t)0, classKeys[s]);
+
+		/* learned offsets are slot indexes counted from the start of the object, the header taking index 0 */
+		const uint8_t *hotFieldOffsets = hotFieldTable->getHotFieldOffsets(classKeys[s]);
+		ASSERT_TRUE(NULL != hotFieldOffsets) << shapes[s].namePrefix;
+		ASSERT_EQ((uint8_t)(shapes[s].nextSlot + 1), hotFieldOffsets[0]) << shapes[s].namePrefix;
+		ASSERT_EQ((uint8_t)U_8_MAX, hotFieldOffsets[1]) << shapes[s].namePrefix;
+	}
+	ASSERT_NE(classKeys[0], classKeys[1]);
+
+	ASSERT_EQ(0, verifyConfiguredVerboseGC()) << "Failed in verbose GC verification.";
+}
+
+/**
+ * Pointer chasing benchmark: after a few scavenges, follow the lists and report how often the next node is the
+ * adjacent object and the time taken per hop. Run with learning enabled and disabled to compare.
+ */
+TEST_P(ScavengerHotFieldLocalityTest, pointerChasing)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	const ListShape shape = { "list", 1 };
+	const int32_t listCount = 256;
+	const int32_t nodeCount = 512;
+	const uintptr_t iterations = 5;
+	ASSERT_EQ(0, allocateLists(&shape, 1, listCount, nodeCount));
+	ASSERT_EQ(0, scavenge(3));
+
+	uintptr_t nodeSize = extensions->objectModel.getConsumedSizeInBytesWithHeader(findHead(&shape, 0));
+	uintptr_t hopCount = 0;
+	uintptr_t adjacentHopCount = 0;
+	uintptr_t youngNodeCount = 0;
+	for (int32_t list = 0; list < listCount; list++) {
+		omrobjectptr_t node = findHead(&shape, list);
+		while (NULL != node) {
+			if (extensions->scavenger->isObjectInNewSpace(node)) {
+				youngNodeCount += 1;
+			}
+			omrobjectptr_t next = readSlot(node, shape.nextSlot);
+			if (NULL != next) {
+				hopCount += 1;
+				if (((uintptr_t)node + nodeSize) == (uintptr_t)next) {
+					adjacentHopCount += 1;
+				}
+			}
+			node = next;
+		}
+	}
+	ASSERT_EQ((uintptr_t)(listCount * (nodeCount - 1)), hopCount);
+
+	uint64_t bestMicros = UINT64_MAX;
+	uintptr_t expectedSum = 0;
+	for (uintptr_t i = 0; i < iterations; i++) {
+		uintptr_t sum = 0;
+		uint64_t start = omrtime_hires_clock();
+		for (int32_t list = 0; list < listCount; list++) {
+			for (omrobjectptr_t node = findHead(&shape, list); NULL != node; node = readSlot(node, shape.nextSlot)) {
+				sum += (uintptr_t)node;
+			}
+		}
+		uint64_t micros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 == i) {
+			expectedSum = sum;
+		}
+		ASSERT_EQ(expectedSum, sum);
+		if (micros < bestMicros) {
+			bestMicros = micros;
+		}
+	}
+
+	gcTestEnv->log(LEVEL_INFO, "learn hot fields %-5s adjacent hops %6.2f%%  young nodes %6.2f%%  best %6llu us  %6.2f ns/hop\n",
+		extensions->scavengerLearnHotFields ? "true" : "false",
+		(100.0 * (double)adjacentHopCount) / (double)hopCount,
+		(100.0 * (double)youngNodeCount) / (double)(listCount * nodeCount),
+		(unsigned long long)bestMicros, (1000.0 * (double)bestMicros) / (double)hopCount);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, ScavengerHotFieldTest,
+        ::testing::Values("fvtest/gctest/configuration/scavengerHotFieldShapes_GC_config.xml"));
+
+INSTANTIATE_TEST_CASE_P(perfTest, ScavengerHotFieldLocalityTest,
+        ::testing::Values("perftest/gctest/configuration/scavengerHotFields_learned.xml",
+                        "perftest/gctest/configuration/scavengerHotFields_unlearned.xml"));
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrgc.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCConfigTest.hpp"
+#include "omrExampleVM.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * Runs against a generational segregated heap. Marks are sticky in this mode, so once a collection has
+ * finished an object is alive exactly when the global collector reports it as marked.
+ */
+class SegregatedGenerationalTest : public GCConfigTest
+{
+protected:
+	bool
+	isMarked(const char *name)
+	{
+		ObjectEntry *objectEntry = find(name);
+		return (NULL != objectEntry) && env->getExtensions()->getGlobalCollector()->isMarked(objectEntry->objPtr);
+	}
+
+	bool
+	isRemembered(const char *name)
+	{
+		ObjectEntry *objectEntry = find(name);
+		return (NULL != objectEntry) && env->getExtensions()->objectModel.isRemembered(objectEntry->objPtr);
+	}
+
+	int32_t
+	addToRootTable(const char *name)
+	{
+		ObjectEntry *objectEntry = find(name);
+		if (NULL == objectEntry) {
+			return 1;
+		}
+		RootEntry rootEntry;
+		rootEntry.name = objectEntry->name;
+		rootEntry.rootPtr = objectEntry->objPtr;
+		return (NULL == hashTableAdd(exampleVM->rootTable, &rootEntry)) ? 1 : 0;
+	}
+};
+
+TEST_P(SegregatedGenerationalTest, oldToYoungReferenceSurvivesMinorCollection)
+{
+	const uintptr_t size = 64;
+	ASSERT_TRUE(env->getExtensions()->segregatedGenerational);
+
+	/* tenure a parent, and an object that becomes garbage once it is old */
+	ASSERT_TRUE(NULL != createObject("old", ROOT, 0, 0, size));
+	ASSERT_EQ(0, addToRootTable("old_0_0"));
+	ASSERT_TRUE(NULL != createObject("oldDropped", ROOT, 0, 0, size));
+	ASSERT_EQ(0, addToRootTable("oldDropped_0_0"));
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	ASSERT_TRUE(isMarked("old_0_0"));
+	ASSERT_TRUE(isMarked("oldDropped_0_0"));
+	ASSERT_EQ(0, removeObjectFromRootTable("oldDropped_0_0"));
+
+	/* a young object referenced only from the old parent, and one referenced from nowhere */
+	ASSERT_TRUE(NULL != createObject("young", NORMAL, 0, 0, size));
+	ASSERT_TRUE(NULL != createObject("youngGarbage", NORMAL, 0, 0, size));
+	ASSERT_FALSE(isMarked("young_0_0"));
+	ASSERT_EQ(0, attachChildEntry(find("old_0_0"), find("young_0_0")));
+	ASSERT_TRUE(isRemembered("old_0_0")) << "storing a young reference into an old object did not remember it";
+
+	/* an implicit collection is a minor collection: it traces from the remembered set and leaves old objects alone */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT));
+	ASSERT_TRUE(isMarked("young_0_0")) << "young object referenced only from an old object did not survive a minor collection";
+	ASSERT_FALSE(isMarked("youngGarbage_0_0"));
+	ASSERT_TRUE(isMarked("oldDropped_0_0")) << "minor collection collected an old object";
+	ASSERT_FALSE(isRemembered("old_0_0"));
+
+	/* a full collection finds the dropped old object */
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+	ASSERT_TRUE(isMarked("young_0_0"));
+	ASSERT_FALSE(isMarked("oldDropped_0_0"));
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTest, SegregatedGenerationalTest,
+        ::testing::Values("fvtest/gctest/configuration/segregatedGenerational_GC_config.xml"));
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,271 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+#include "ObjectScanner.hpp"
+#include "SlotObject.hpp"
+#include "StartupManagerTestExample.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#define SLOT_SCAN_CONFIG "fvtest/gctest/configuration/global_GC_config.xml"
+
+/**
+ * Scanner presenting every slot of a plain slot array, so that the slot loops can be run without a heap of objects.
+ */
+class SlotArrayScanner : public GC_ObjectScanner
+{
+private:
+	fomrobject_t * const _endPtr;
+	fomrobject_t *_mapPtr;
+
+	MMINLINE uintptr_t
+	slotMapFor(intptr_t slotCount, bool *hasNextSlotMap)
+	{
+		*hasNextSlotMap = (slotCount > _bitsPerScanMap);
+		return (slotCount >= _bitsPerScanMap) ? ~(uintptr_t)0 : ((((uintptr_t)1) << slotCount) - 1);
+	}
+
+public:
+	SlotArrayScanner(MM_EnvironmentBase *env, fomrobject_t *slots, uintptr_t slotCount)
+		: GC_ObjectScanner(env, slots, 0, 0)
+		, _endPtr(GC_SlotObject::addToSlotAddress(slots, slotCount, env->compressObjectReferences()))
+		, _mapPtr(slots)
+	{
+		bool hasNextSlotMap = false;
+		_scanMap = slotMapFor(slotCount, &hasNextSlotMap);
+		if (!hasNextSlotMap) {
+			setNoMoreSlots();
+		}
+	}
+
+	virtual fomrobject_t *
+	getNextSlotMap(uintptr_t *slotMap, bool *hasNextSlotMap)
+	{
+		bool const compressed = compressObjectReferences();
+		_mapPtr = GC_SlotObject::addToSlotAddress(_mapPtr, _bitsPerScanMap, compressed);
+		*slotMap = slotMapFor(GC_SlotObject::subtractSlotAddresses(_endPtr, _mapPtr, compressed), hasNextSlotMap);
+		return _mapPtr;
+	}
+
+#if defined(OMR_GC_LEAF_BITS)
+	virtual fomrobject_t *
+	getNextSlotMap(uintptr_t *slotMap, uintptr_t *leafMap, bool *hasNextSlotMap)
+	{
+		*leafMap = 0;
+		return getNextSlotMap(slotMap, hasNextSlotMap);
+	}
+#endif /* OMR_GC_LEAF_BITS */
+};
+
+/**
+ * Starts a heap for the slot scanning tests, which only need an environment for the scanners.
+ */
+class SlotScanTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, SLOT_SCAN_CONFIG);
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	}
+
+	virtual void
+	TearDown()
+	{
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	/**
+	 * Fill slots with distinct references, leaving one slot in nullOneIn NULL.
+	 * @return the number of non-NULL slots
+	 */
+	uintptr_t
+	fillSlots(fomrobject_t *slots, uintptr_t slotCount, uintptr_t nullOneIn)
+	{
+		uintptr_t nonNullCount = 0;
+		GC_SlotObject slotObject(env->getOmrVM(), slots);
+		for (uintptr_t i = 0; i < slotCount; i++) {
+			omrobjectptr_t reference = NULL;
+			if (0 != (i % nullOneIn)) {
+				/* aligned well beyond any compressed shift and within 32 bits once shifted */
+				reference = (omrobjectptr_t)((i + 1) << 8);
+				nonNullCount += 1;
+			}
+			slotObject.writeReferenceToSlot(reference);
+			slotObject.addToSlotAddress(1);
+		}
+		return nonNullCount;
+	}
+};
+
+class gcFunctionalTestSlotScan : public SlotScanTest {};
+class perfTestSlotScan : public SlotScanTest {};
+
+/**
+ * Scan the slots of each object of objectSlotCount slots the way the collectors do before specialization.
+ * @return the sum of the references read, to keep the loop from being optimized away
+ */
+static uintptr_t
+scanSlotsGeneric(MM_EnvironmentBase *env, fomrobject_t *slots, uintptr_t objectCount, uintptr_t objectSlotCount, uintptr_t *slotsScanned)
+{
+	bool const compressed = env->compressObjectReferences();
+	uintptr_t sum = 0;
+	for (uintptr_t o = 0; o < objectCount; o++) {
+		SlotArrayScanner scanner(env, GC_SlotObject::addToSlotAddress(slots, o * objectSlotCount, compressed), objectSlotCount);
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = scanner.getNextSlot())) {
+			sum += (uintptr_t)slotObject->readReferenceFromSlot();
+			*slotsScanned += 1;
+		}
+	}
+	return sum;
+}
+
+/**
+ * @see scanSlotsGeneric()
+ */
+template <bool compressed>
+static uintptr_t
+scanSlotsSpecialized(MM_EnvironmentBase *env, fomrobject_t *slots, uintptr_t objectCount, uintptr_t objectSlotCount, uintptr_t *slotsScanned)
+{
+	uintptr_t sum = 0;
+	for (uintptr_t o = 0; o < objectCount; o++) {
+		SlotArrayScanner scanner(env, GC_SlotObject::addToSlotAddress(slots, o * objectSlotCount, compressed), objectSlotCount);
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = scanner.getNextSlot<compressed>())) {
+			sum += (uintptr_t)slotObject->readReferenceFromSlot<compressed>();
+			*slotsScanned += 1;
+		}
+	}
+	return sum;
+}
+
+template <bool compressed>
+static void
+verifySpecializedScan(MM_EnvironmentBase *env, fomrobject_t *slots, uintptr_t slotCount)
+{
+	SlotArrayScanner genericScanner(env, slots, slotCount);
+	SlotArrayScanner specializedScanner(env, slots, slotCount);
+	GC_SlotObject *genericSlot = NULL;
+	do {
+		genericSlot = genericScanner.getNextSlot();
+		GC_SlotObject *specializedSlot = specializedScanner.getNextSlot<compressed>();
+		ASSERT_EQ(NULL == genericSlot, NULL == specializedSlot);
+		if (NULL != genericSlot) {
+			ASSERT_EQ(genericSlot->readAddressFromSlot(), specializedSlot->readAddressFromSlot());
+			ASSERT_EQ(genericSlot->readReferenceFromSlot(), specializedSlot->readReferenceFromSlot<compressed>());
+		}
+	} while (NULL != genericSlot);
+}
+
+TEST_F(gcFunctionalTestSlotScan, specializedMatchesGeneric)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	/* up to three slot maps, with every length of the last one */
+	const uintptr_t maxSlotCount = 3 * sizeof(uintptr_t) * 8;
+	fomrobject_t *slots = (fomrobject_t *)omrmem_allocate_memory(maxSlotCount * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != slots);
+
+	for (uintptr_t slotCount = 0; slotCount <= maxSlotCount; slotCount++) {
+		uintptr_t nonNullCount = fillSlots(slots, slotCount, 3);
+		uintptr_t slotsScanned = 0;
+		uintptr_t sum = scanSlotsGeneric(env, slots, 1, slotCount, &slotsScanned);
+		ASSERT_EQ(nonNullCount, slotsScanned);
+		slotsScanned = 0;
+		if (env->compressObjectReferences()) {
+			ASSERT_NO_FATAL_FAILURE(verifySpecializedScan<true>(env, slots, slotCount));
+			ASSERT_EQ(sum, scanSlotsSpecialized<true>(env, slots, 1, slotCount, &slotsScanned));
+		} else {
+			ASSERT_NO_FATAL_FAILURE(verifySpecializedScan<false>(env, slots, slotCount));
+			ASSERT_EQ(sum, scanSlotsSpecialized<false>(env, slots, 1, slotCount, &slotsScanned));
+		}
+		ASSERT_EQ(nonNullCount, slotsScanned);
+	}
+
+	omrmem_free_memory(slots);
+}
+
+TEST_F(perfTestSlotScan, slotsPerSecond)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	/* 4M slots in objects of 24 slots, small enough that most objects are mapped by one slot map */
+	const uintptr_t objectSlotCount = 24;
+	const uintptr_t objectCount = (4 * 1024 * 1024) / objectSlotCount;
+	const uintptr_t iterations = 5;
+	bool const compressed = env->compressObjectReferences();
+	fomrobject_t *slots = (fomrobject_t *)omrmem_allocate_memory(objectCount * objectSlotCount * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != slots);
+	fillSlots(slots, objectCount * objectSlotCount, 4);
+
+#if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
+	gcTestEnv->log(LEVEL_INFO, "mixed reference mode, %s references\n", compressed ? "compressed" : "full");
+#else /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
+	gcTestEnv->log(LEVEL_INFO, "single reference mode, %s references (both scans compile to the same code)\n", compressed ? "compressed" : "full");
+#endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
+
+	const char *scanNames[] = { "generic", "specialized" };
+	uintptr_t expectedSum = 0;
+	for (uintptr_t scan = 0; scan < 2; scan++) {
+		uint64_t bestMicros = UINT64_MAX;
+		uintptr_t slotsScanned = 0;
+		for (uintptr_t i = 0; i < iterations; i++) {
+			uintptr_t sum = 0;
+			slotsScanned = 0;
+			uint64_t start = omrtime_hires_clock();
+			if (0 == scan) {
+				sum = scanSlotsGeneric(env, slots, objectCount, objectSlotCount, &slotsScanned);
+			} else if (compressed) {
+				sum = scanSlotsSpecialized<true>(env, slots, objectCount, objectSlotCount, &slotsScanned);
+			} else {
+				sum = scanSlotsSpecialized<false>(env, slots, objectCount, objectSlotCount, &slotsScanned);
+			}
+			uint64_t micros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			if ((0 == scan) && (0 == i)) {
+				expectedSum = sum;
+			}
+			ASSERT_EQ(expectedSum, sum);
+			if (micros < bestMicros) {
+				bestMicros = micros;
+			}
+		}
+		double millionSlotsPerSecond = (0 == bestMicros) ? 0.0 : (double)slotsScanned / (double)bestMicros;
+		gcTestEnv->log(LEVEL_INFO, "scan %-11s slots %8zu  best %8llu us  %8.1f M slots/s\n",
+			scanNames[scan], slotsScanned, (unsigned long long)bestMicros, millionSlotsPerSecond);
+	}
+
+	omrmem_free_memory(slots);
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2015 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -83,7 +83,61 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "workPacketDeques")) {
+					extensions->workPacketDeques = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "syncSpinCount")) {
+					extensions->gcThreadSyncSpinCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "dispatcherHotWindow")) {
+					extensions->dispatcherHotWindow = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "taskThreadCountModel")) {
+					extensions->taskThreadCountModel = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "transparentHugePages")) {
+					extensions->transparentHugePages = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "preTouchHeap")) {
+					extensions->preTouchHeap = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "deferredHeapUncommit")) {
+					extensions->deferredHeapUncommit = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBufferSize")) {
+					extensions->asyncLoggingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "heapUncommitRate")) {
+					extensions->heapUncommitRate = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "heapFreeMaximumRatio")) {
+					extensions->heapFreeMaximumRatioMultiplier = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapContractionStabilizationCount")) {
+					extensions->heapContractionStabilizationCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeListSizeIndex")) {
+					extensions->freeListSizeIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeListSizeIndexMinimumSize")) {
+					extensions->freeListSizeIndexMinimumSize = atoi(attr.value()) * unitSize;
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactIncremental")) {
+					extensions->compactIncremental = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					if (extensions->compactIncremental) {
+						extensions->noCompactOnGlobalGC = 0;
+					}
+				} else if (0 == strcmp(attr.name(), "compactPauseBudget")) {
+					extensions->compactPauseBudget = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "partitionedFinalCardCleaning")) {
+					extensions->partitionedFinalCardCleaning = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "segregatedGenerational")) {
+					extensions->segregatedGenerational = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "numaSimulatedNodes")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,6 +145,10 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+						_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
 						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
 						result = false;
@@ -106,6 +164,12 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNumaAware")) {
+					extensions->scavengerNumaAware = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerLearnHotFields")) {
+					extensions->scavengerLearnHotFields = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetPrefetchDistance")) {
+					extensions->scavengerRememberedSetPrefetchDistance = atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
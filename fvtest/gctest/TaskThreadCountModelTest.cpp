@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "TaskThreadCountModel.hpp"
+
+#include "gcTestHelpers.hpp"
+
+#define TEST_TASK_A 1
+#define TEST_TASK_B 2
+
+/**
+ * Record a task of 4 threads that took 300us to wake up and then worked for 10ms: a wakeup cost of
+ * 100us per additional thread and a work rate of 10 units per thread per microsecond.
+ */
+static void
+recordKnownTask(MM_TaskThreadCountModel *model, uintptr_t vmStateID)
+{
+	model->recordTask(vmStateID, 400000, 4, 10300, 300);
+}
+
+TEST(gcFunctionalTestTaskThreadCountModel, unmeasuredTaskUsesAllThreads)
+{
+	MM_TaskThreadCountModel model;
+	EXPECT_EQ((uintptr_t)8, model.recommendThreadCount(TEST_TASK_A, 1000, 8));
+	EXPECT_FLOAT_EQ(0.0f, model.getWorkRate(TEST_TASK_A));
+
+	/* a single thread task measures the work rate but not the wakeup cost */
+	model.recordTask(TEST_TASK_A, 1000, 1, 100, 0);
+	EXPECT_FLOAT_EQ(10.0f, model.getWorkRate(TEST_TASK_A));
+	EXPECT_FLOAT_EQ(0.0f, model.getWakeupCost());
+	EXPECT_EQ((uintptr_t)8, model.recommendThreadCount(TEST_TASK_A, 1000, 8));
+}
+
+TEST(gcFunctionalTestTaskThreadCountModel, recommendsSquareRootOfWorkOverRateAndCost)
+{
+	MM_TaskThreadCountModel model;
+	recordKnownTask(&model, TEST_TASK_A);
+	EXPECT_FLOAT_EQ(100.0f, model.getWakeupCost());
+	EXPECT_FLOAT_EQ(10.0f, model.getWorkRate(TEST_TASK_A));
+
+	/* n = sqrt(W / (10 * 100)) */
+	EXPECT_EQ((uintptr_t)4, model.recommendThreadCount(TEST_TASK_A, 16000, 8));
+	EXPECT_EQ((uintptr_t)2, model.recommendThreadCount(TEST_TASK_A, 4000, 8));
+	EXPECT_EQ((uintptr_t)1, model.recommendThreadCount(TEST_TASK_A, 500, 8));
+	/* capped by the thread count the task could run with */
+	EXPECT_EQ((uintptr_t)8, model.recommendThreadCount(TEST_TASK_A, 10000000, 8));
+	EXPECT_EQ((uintptr_t)3, model.recommendThreadCount(TEST_TASK_A, 16000, 3));
+	/* no work estimate keeps the maximum */
+	EXPECT_EQ((uintptr_t)8, model.recommendThreadCount(TEST_TASK_A, 0, 8));
+	/* the wakeup cost is shared, the work rate is not */
+	EXPECT_EQ((uintptr_t)8, model.recommendThreadCount(TEST_TASK_B, 16000, 8));
+}
+
+TEST(gcFunctionalTestTaskThreadCountModel, smoothsMeasurements)
+{
+	MM_TaskThreadCountModel model;
+	recordKnownTask(&model, TEST_TASK_A);
+
+	/* twice the work in the same time, woken twice as slowly */
+	model.recordTask(TEST_TASK_A, 800000, 4, 10600, 600);
+	float workRate = model.getWorkRate(TEST_TASK_A);
+	float wakeupCost = model.getWakeupCost();
+	EXPECT_LT(10.0f, workRate);
+	EXPECT_GT(20.0f, workRate);
+	EXPECT_LT(100.0f, wakeupCost);
+	EXPECT_GT(200.0f, wakeupCost);
+
+	/* a wakeup longer than the task is not counted as work time */
+	model.recordTask(TEST_TASK_B, 1000, 2, 50, 100);
+	EXPECT_FLOAT_EQ(500.0f, model.getWorkRate(TEST_TASK_B));
+}
+
+TEST(gcFunctionalTestTaskThreadCountModel, ignoresTasksBeyondCapacity)
+{
+	MM_TaskThreadCountModel model;
+	for (uintptr_t task = 0; task < TASK_THREAD_COUNT_MODEL_MAX_TASKS; task++) {
+		recordKnownTask(&model, 100 + task);
+	}
+	recordKnownTask(&model, 100 + TASK_THREAD_COUNT_MODEL_MAX_TASKS);
+
+	EXPECT_FLOAT_EQ(10.0f, model.getWorkRate(100 + TASK_THREAD_COUNT_MODEL_MAX_TASKS - 1));
+	EXPECT_EQ((uintptr_t)4, model.recommendThreadCount(100 + TASK_THREAD_COUNT_MODEL_MAX_TASKS - 1, 16000, 8));
+	EXPECT_FLOAT_EQ(0.0f, model.getWorkRate(100 + TASK_THREAD_COUNT_MODEL_MAX_TASKS));
+	EXPECT_EQ((uintptr_t)8, model.recommendThreadCount(100 + TASK_THREAD_COUNT_MODEL_MAX_TASKS, 16000, 8));
+}
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdio.h>
+
+#include "omrport.h"
+#include "omrthread.h"
+#include "hookable_api.h"
+#include "dispatchhook_internal.h"
+
+#include "omrTest.h"
+
+/*
+ * Microbenchmark of hook dispatch from many threads. Every thread reports the same event, which is the
+ * case the per thread shards of the listener call counts are for, and the aggregated counts must add up
+ * exactly. Events are reported with their listeners always timed, sampled and never timed.
+ *
+ * Listeners are also registered and unregistered while threads dispatch, which replaces the published
+ * record arrays under the dispatching threads.
+ */
+
+#define DISPATCH_THREADS_MAXIMUM 8
+#define DISPATCHES_PER_THREAD 200000
+#define CHURN_LISTENERS 8
+#define CHURN_REGISTRATIONS 20000
+
+static DispatchHookInterface dispatchHookInterface;
+
+typedef struct DispatchThreadData {
+	uintptr_t eventNum;
+	uintptr_t count;
+} DispatchThreadData;
+
+typedef struct ChurnThreadData {
+	volatile uintptr_t *stop;
+	uintptr_t dispatches;
+	uintptr_t missed;
+} ChurnThreadData;
+
+static void
+hookCountEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
+{
+	/* all of the events have the count as their only field */
+	((DispatchHookEventTimed *)voidEventData)->count += 1;
+}
+
+static void
+hookChurnEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
+{
+	((DispatchHookEventUntimed *)voidEventData)->count += (uintptr_t)userData;
+}
+
+static int J9THREAD_PROC
+churnDispatchThread(void *entryArg)
+{
+	ChurnThreadData *data = (ChurnThreadData *)entryArg;
+
+	while (0 == *data->stop) {
+		uintptr_t count = 0;
+		TRIGGER_DISPATCHHOOK_EVENT_UNTIMED(dispatchHookInterface, count);
+		/* the listener registered throughout must see every dispatch */
+		if (0 == (count & 1)) {
+			data->missed += 1;
+		}
+		data->dispatches += 1;
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+dispatchThread(void *entryArg)
+{
+	DispatchThreadData *data = (DispatchThreadData *)entryArg;
+	/* the listener increments the count returned by each dispatch */
+	uintptr_t count = 0;
+
+	switch (data->eventNum) {
+	case DISPATCHHOOK_EVENT_TIMED:
+		for (uintptr_t i = 0; i < DISPATCHES_PER_THREAD; i++) {
+			TRIGGER_DISPATCHHOOK_EVENT_TIMED(dispatchHookInterface, count);
+		}
+		break;
+	case DISPATCHHOOK_EVENT_SAMPLED:
+		for (uintptr_t i = 0; i < DISPATCHES_PER_THREAD; i++) {
+			TRIGGER_DISPATCHHOOK_EVENT_SAMPLED(dispatchHookInterface, count);
+		}
+		break;
+	case DISPATCHHOOK_EVENT_UNTIMED:
+		for (uintptr_t i = 0; i < DISPATCHES_PER_THREAD; i++) {
+			TRIGGER_DISPATCHHOOK_EVENT_UNTIMED(dispatchHookInterface, count);
+		}
+		break;
+	default:
+		break;
+	}
+	data->count = count;
+	return 0;
+}
+
+TEST(UtilTest, hookDispatchScaling)
+{
+	OMRPortLibrary portLibrary;
+	ASSERT_EQ(0, omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT));
+	ASSERT_EQ(0, omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)));
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	J9HookInterface **hookInterface = J9_HOOK_INTERFACE(dispatchHookInterface);
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	ASSERT_EQ(0, J9HookInitializeInterface(hookInterface, &portLibrary, sizeof(dispatchHookInterface)));
+
+	const uintptr_t events[] = { DISPATCHHOOK_EVENT_TIMED, DISPATCHHOOK_EVENT_SAMPLED, DISPATCHHOOK_EVENT_UNTIMED };
+	const char *eventNames[] = { "timed", "sampled", "untimed" };
+	const uintptr_t eventCount = sizeof(events) / sizeof(events[0]);
+	uintptr_t expectedCounts[eventCount];
+
+	for (uintptr_t e = 0; e < eventCount; e++) {
+		ASSERT_EQ(0, (*hookInterface)->J9HookRegisterWithCallSite(hookInterface, events[e], hookCountEvent, OMR_GET_CALLSITE(), NULL));
+		expectedCounts[e] = 0;
+
+		for (uintptr_t threads = 1; threads <= DISPATCH_THREADS_MAXIMUM; threads *= 2) {
+			omrthread_t handles[DISPATCH_THREADS_MAXIMUM];
+			DispatchThreadData data[DISPATCH_THREADS_MAXIMUM];
+			omrthread_attr_t attr = NULL;
+
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+			uint64_t startTime = omrtime_nano_time();
+			for (uintptr_t t = 0; t < threads; t++) {
+				data[t].eventNum = events[e];
+				data[t].count = 0;
+				ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&handles[t], &attr, 0, dispatchThread, &data[t]));
+			}
+			for (uintptr_t t = 0; t < threads; t++) {
+				ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(handles[t]));
+				ASSERT_EQ((uintptr_t)DISPATCHES_PER_THREAD, data[t].count);
+			}
+			uint64_t elapsed = omrtime_nano_time() - startTime;
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+
+			expectedCounts[e] += threads * DISPATCHES_PER_THREAD;
+			printf("%-8s %2zu threads: %6.1f ns per dispatch per thread, %7.1f million dispatches/s\n",
+					eventNames[e], (size_t)threads, (double)elapsed / DISPATCHES_PER_THREAD,
+					(double)(threads * DISPATCHES_PER_THREAD) * 1000.0 / (double)elapsed);
+		}
+	}
+
+	/* every listener call is counted, so a second listener counts each dispatch twice */
+	ASSERT_EQ(0, (*hookInterface)->J9HookRegisterWithCallSite(hookInterface, events[0], hookCountEvent, OMR_GET_CALLSITE(), (void *)1));
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < DISPATCHES_PER_THREAD; i++) {
+		TRIGGER_DISPATCHHOOK_EVENT_TIMED(dispatchHookInterface, count);
+	}
+	ASSERT_EQ((uintptr_t)(2 * DISPATCHES_PER_THREAD), count);
+	expectedCounts[0] += 2 * DISPATCHES_PER_THREAD;
+
+	/* dispatch keeps the counts current to within the calls since each shard last folded them */
+	for (uintptr_t e = 0; e < eventCount; e++) {
+		uintptr_t eventNum = events[e] & J9HOOK_EVENT_NUM_MASK;
+		EXPECT_LT((uintptr_t)0, J9HOOK_DUMPINFO(commonInterface, eventNum)->count) << eventNames[e];
+		EXPECT_GE(expectedCounts[e], J9HOOK_DUMPINFO(commonInterface, eventNum)->count) << eventNames[e];
+	}
+
+	/* the calls not folded yet are only added on demand */
+	(*hookInterface)->J9HookAggregateEventCounts(hookInterface);
+	for (uintptr_t e = 0; e < eventCount; e++) {
+		uintptr_t eventNum = events[e] & J9HOOK_EVENT_NUM_MASK;
+		EXPECT_EQ(expectedCounts[e], J9HOOK_DUMPINFO(commonInterface, eventNum)->count) << eventNames[e];
+	}
+
+	(*hookInterface)->J9HookShutdownInterface(hookInterface);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+}
+
+TEST(UtilTest, hookRegistrationDuringDispatch)
+{
+	OMRPortLibrary portLibrary;
+	ASSERT_EQ(0, omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT));
+	ASSERT_EQ(0, omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)));
+
+	J9HookInterface **hookInterface = J9_HOOK_INTERFACE(dispatchHookInterface);
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	ASSERT_EQ(0, J9HookInitializeInterface(hookInterface, &portLibrary, sizeof(dispatchHookInterface)));
+	ASSERT_EQ(0, (*hookInterface)->J9HookRegisterWithCallSite(hookInterface, DISPATCHHOOK_EVENT_UNTIMED, hookCountEvent, OMR_GET_CALLSITE(), NULL));
+
+	volatile uintptr_t stop = 0;
+	omrthread_t handles[DISPATCH_THREADS_MAXIMUM];
+	ChurnThreadData data[DISPATCH_THREADS_MAXIMUM];
+	omrthread_attr_t attr = NULL;
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	for (uintptr_t t = 0; t < DISPATCH_THREADS_MAXIMUM; t++) {
+		data[t].stop = &stop;
+		data[t].dispatches = 0;
+		data[t].missed = 0;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&handles[t], &attr, 0, churnDispatchThread, &data[t]));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+
+	/* churn listeners add even amounts, so they never hide a dispatch missed by the permanent listener */
+	for (uintptr_t i = 0; i < CHURN_REGISTRATIONS; i++) {
+		uintptr_t registered = ((i % CHURN_LISTENERS) + 1) * 2;
+		uintptr_t unregistered = (((i + (CHURN_LISTENERS / 2)) % CHURN_LISTENERS) + 1) * 2;
+		ASSERT_EQ(0, (*hookInterface)->J9HookRegisterWithCallSite(hookInterface, DISPATCHHOOK_EVENT_UNTIMED | J9HOOK_TAG_AGENT_ID, hookChurnEvent, OMR_GET_CALLSITE(), (void *)registered, i % 3));
+		(*hookInterface)->J9HookUnregister(hookInterface, DISPATCHHOOK_EVENT_UNTIMED, hookChurnEvent, (void *)unregistered);
+		if (0 == (i % 64)) {
+			omrthread_yield();
+		}
+	}
+
+	stop = 1;
+	uintptr_t dispatches = 0;
+	for (uintptr_t t = 0; t < DISPATCH_THREADS_MAXIMUM; t++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(handles[t]));
+		EXPECT_EQ((uintptr_t)0, data[t].missed);
+		dispatches += data[t].dispatches;
+	}
+	printf("%zu dispatches during %zu registration changes\n", (size_t)dispatches, (size_t)(CHURN_REGISTRATIONS * 2));
+	/* the dispatching threads freed their counts of the dispatches in progress as they terminated */
+	EXPECT_TRUE(NULL == commonInterface->threadDispatches);
+
+	/* with no dispatch in progress, the last change reclaims every replaced array */
+	(*hookInterface)->J9HookUnregister(hookInterface, DISPATCHHOOK_EVENT_UNTIMED, hookChurnEvent, NULL);
+	EXPECT_TRUE(NULL == commonInterface->retiredRecords);
+	EXPECT_TRUE(NULL == commonInterface->reclaimableRecords);
+	EXPECT_TRUE(0 != J9_EVENT_IS_HOOKED(dispatchHookInterface, DISPATCHHOOK_EVENT_UNTIMED));
+	(*hookInterface)->J9HookUnregister(hookInterface, DISPATCHHOOK_EVENT_UNTIMED, hookCountEvent, NULL);
+	EXPECT_TRUE(0 == J9_EVENT_IS_HOOKED(dispatchHookInterface, DISPATCHHOOK_EVENT_UNTIMED));
+
+	(*hookInterface)->J9HookShutdownInterface(hookInterface);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -36,6 +36,7 @@
 #define OMR_SCAVENGER_CACHE_TYPE_CLEARED 32
 #define OMR_SCAVENGER_CACHE_TYPE_SCAN 64
 #define OMR_SCAVENGER_CACHE_TYPE_HEAP 128
+#define OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE 256
 /* a mask which represents the flags which cannot change during the lifetime of a scan cache structure */
 #define OMR_SCAVENGER_CACHE_MASK_PERSISTENT (OMR_SCAVENGER_CACHE_TYPE_HEAP)
 /** @} */
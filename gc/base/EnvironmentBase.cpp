@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -45,6 +45,7 @@
 #include "HeapRegionQueue.hpp"
 #include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationTracker.hpp"
+#include "SublistFragment.hpp"
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #include "EnvironmentBase.hpp"
@@ -106,14 +107,27 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	}
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
-	/* Disable dynamic depth copying if scavengerDynamicBreadthFirstScanOrdering is not selected */ 
-	if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST != extensions->scavengerScanOrdering) {
+	/* Disable dynamic depth copying if scavengerDynamicBreadthFirstScanOrdering is not selected and hot fields are not learned */
+	if ((MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST != extensions->scavengerScanOrdering) && !extensions->scavengerLearnHotFields) {
 		disableHotFieldDepthCopy();
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	if (extensions->isSegregatedHeap()) {
+		if (extensions->segregatedGenerational) {
+			_segregatedRememberedSet = (J9VMGC_SublistFragment *)extensions->getForge()->allocate(sizeof(J9VMGC_SublistFragment), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+			if (NULL == _segregatedRememberedSet) {
+				return false;
+			}
+			_segregatedRememberedSet->count = 0;
+			_segregatedRememberedSet->fragmentCurrent = NULL;
+			_segregatedRememberedSet->fragmentTop = NULL;
+			_segregatedRememberedSet->fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
+			_segregatedRememberedSet->parentList = &extensions->segregatedRememberedSet;
+			_segregatedRememberedSet->deferredFlushID = 0;
+		}
+
 		_regionWorkList = MM_RegionPoolSegregated::allocateHeapRegionQueue(this, MM_HeapRegionList::HRL_KIND_LOCAL_WORK, true, false, false);
 		if (NULL == _regionWorkList) {
 			return false;
@@ -155,6 +169,12 @@ MM_EnvironmentBase::tearDown(MM_GCExtensionsBase *extensions)
 		_allocationTracker->kill(this);
 		_allocationTracker = NULL;
 	}
+
+	if (NULL != _segregatedRememberedSet) {
+		MM_SublistFragment::flush(_segregatedRememberedSet);
+		extensions->getForge()->free(_segregatedRememberedSet);
+		_segregatedRememberedSet = NULL;
+	}
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
 	if(NULL != _objectAllocationInterface) {
@@ -473,6 +493,7 @@ MM_EnvironmentBase::releaseExclusiveVMAccessForGC()
 		omrthread_monitor_enter(extensions->gcExclusiveAccessMutex);
 		extensions->gcExclusiveAccessThreadId = _cachedGCExclusiveAccessThreadId;
 		_cachedGCExclusiveAccessThreadId = NULL;
+		extensions->gcExclusiveAccessReleaseCount += 1;
 		omrthread_monitor_notify_all(extensions->gcExclusiveAccessMutex);
 		omrthread_monitor_exit(extensions->gcExclusiveAccessMutex);
 		reportExclusiveAccessRelease();
@@ -493,6 +514,7 @@ MM_EnvironmentBase::unwindExclusiveVMAccessForGC()
 		omrthread_monitor_enter(extensions->gcExclusiveAccessMutex);
 		extensions->gcExclusiveAccessThreadId = _cachedGCExclusiveAccessThreadId;
 		_cachedGCExclusiveAccessThreadId = NULL;
+		extensions->gcExclusiveAccessReleaseCount += 1;
 		omrthread_monitor_notify_all(extensions->gcExclusiveAccessMutex);
 		omrthread_monitor_exit(extensions->gcExclusiveAccessMutex);
 		reportExclusiveAccessRelease();
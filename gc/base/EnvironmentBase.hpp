@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -52,6 +52,7 @@ class MM_ObjectAllocationInterface;
 class MM_SegregatedAllocationTracker;
 class MM_Task;
 class MM_Validator;
+struct J9VMGC_SublistFragment;
 
 /* Allocation color values -- also used in bit in Metronome -- see Metronome.hpp */
 #define GC_UNMARK	0
@@ -162,6 +163,7 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
+	J9VMGC_SublistFragment *_segregatedRememberedSet; /**< Thread local fragment of the remembered set of old objects that were stored young references in generational segregated mode */
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
@@ -562,7 +564,7 @@ public:
 	 */
 	MMINLINE void enableHotFieldDepthCopy()
 	{ 
-		if (getExtensions()->scavengerScanOrdering == MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST) {
+		if ((getExtensions()->scavengerScanOrdering == MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST) || getExtensions()->scavengerLearnHotFields) {
 			_hotFieldCopyDepthCount = 0;
 		}
 	}
@@ -738,6 +740,7 @@ public:
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
+		,_segregatedRememberedSet(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
@@ -795,6 +798,7 @@ public:
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
+		,_segregatedRememberedSet(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		,_hotFieldCopyDepthCount(0)
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "FreeEntrySizeIndex.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+/* Smallest number of slots allocated, to avoid regrowing while the index is small */
+#define FREE_ENTRY_SIZE_INDEX_MINIMUM_SLOTS 64
+
+MM_FreeEntrySizeIndex *
+MM_FreeEntrySizeIndex::newInstance(MM_EnvironmentBase *env, uintptr_t minimumSize, bool compressed)
+{
+	MM_FreeEntrySizeIndex *index = (MM_FreeEntrySizeIndex *)env->getForge()->allocate(sizeof(MM_FreeEntrySizeIndex), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != index) {
+		new(index) MM_FreeEntrySizeIndex(minimumSize, compressed);
+		if (!index->initialize(env)) {
+			index->kill(env);
+			index = NULL;
+		}
+	}
+	return index;
+}
+
+void
+MM_FreeEntrySizeIndex::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_FreeEntrySizeIndex::initialize(MM_EnvironmentBase *env)
+{
+	return ensureCapacity(env, FREE_ENTRY_SIZE_INDEX_MINIMUM_SLOTS);
+}
+
+void
+MM_FreeEntrySizeIndex::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _slots) {
+		env->getForge()->free(_slots);
+		_slots = NULL;
+		_maxSizes = NULL;
+	}
+	_slotCount = 0;
+	_leafCount = 0;
+}
+
+/**
+ * Grow the slot storage so that it holds at least slotCount slots, preserving the slots in use and
+ * their leaves. Inner nodes of the max tree are not preserved; they are recomputed by the caller.
+ */
+bool
+MM_FreeEntrySizeIndex::ensureCapacity(MM_EnvironmentBase *env, uintptr_t slotCount)
+{
+	if (slotCount <= _leafCount) {
+		return true;
+	}
+
+	uintptr_t leafCount = OMR_MAX(_leafCount, FREE_ENTRY_SIZE_INDEX_MINIMUM_SLOTS);
+	while (leafCount < slotCount) {
+		leafCount *= 2;
+	}
+
+	/* Slots and the max tree (2 * leafCount nodes, node 0 unused) share one allocation */
+	Slot *slots = (Slot *)env->getForge()->allocate((sizeof(Slot) + (2 * sizeof(uintptr_t))) * leafCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == slots) {
+		return false;
+	}
+
+	uintptr_t *maxSizes = (uintptr_t *)(slots + leafCount);
+	if (NULL != _slots) {
+		memcpy(slots, _slots, sizeof(Slot) * _slotCount);
+		memcpy(maxSizes + leafCount, _maxSizes + _leafCount, sizeof(uintptr_t) * _slotCount);
+		env->getForge()->free(_slots);
+	}
+	_slots = slots;
+	_maxSizes = maxSizes;
+	_leafCount = leafCount;
+	return true;
+}
+
+void
+MM_FreeEntrySizeIndex::setSlotSize(uintptr_t slotIndex, uintptr_t size)
+{
+	uintptr_t node = _leafCount + slotIndex;
+	_maxSizes[node] = size;
+	while (node > 1) {
+		node /= 2;
+		uintptr_t maxSize = OMR_MAX(_maxSizes[2 * node], _maxSizes[(2 * node) + 1]);
+		if (_maxSizes[node] == maxSize) {
+			/* Ancestors are unaffected */
+			break;
+		}
+		_maxSizes[node] = maxSize;
+	}
+}
+
+uintptr_t
+MM_FreeEntrySizeIndex::findSlot(MM_HeapLinkedFreeHeader *entry)
+{
+	uintptr_t low = 0;
+	uintptr_t high = _slotCount;
+	while (low < high) {
+		uintptr_t middle = low + ((high - low) / 2);
+		if (_slots[middle].entry < entry) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	if ((low < _slotCount) && (entry == _slots[low].entry)) {
+		return low;
+	}
+	return UDATA_MAX;
+}
+
+bool
+MM_FreeEntrySizeIndex::rebuild(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeList)
+{
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	_slotCount = 0;
+
+	for (MM_HeapLinkedFreeHeader *entry = freeList; NULL != entry; entry = entry->getNext(_compressed)) {
+		uintptr_t size = entry->getSize();
+		if (size >= _minimumSize) {
+			if (!ensureCapacity(env, _slotCount + 1)) {
+				_slotCount = 0;
+				return false;
+			}
+			_slots[_slotCount].entry = entry;
+			_slots[_slotCount].previous = previous;
+			_maxSizes[_leafCount + _slotCount] = size;
+			_slotCount += 1;
+		}
+		previous = entry;
+	}
+
+	for (uintptr_t leaf = _leafCount + _slotCount; leaf < (2 * _leafCount); leaf++) {
+		_maxSizes[leaf] = 0;
+	}
+	for (uintptr_t node = _leafCount - 1; node >= 1; node--) {
+		_maxSizes[node] = OMR_MAX(_maxSizes[2 * node], _maxSizes[(2 * node) + 1]);
+	}
+	return true;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntrySizeIndex::findFirstFit(uintptr_t size, MM_HeapLinkedFreeHeader **previous)
+{
+	Assert_MM_true(size >= _minimumSize);
+
+	if ((0 == _slotCount) || (_maxSizes[1] < size)) {
+		return NULL;
+	}
+
+	/* Descend to the leftmost (lowest addressed) leaf that is large enough */
+	uintptr_t node = 1;
+	while (node < _leafCount) {
+		node *= 2;
+		if (_maxSizes[node] < size) {
+			node += 1;
+		}
+	}
+
+	Slot *slot = &_slots[node - _leafCount];
+	*previous = slot->previous;
+	return slot->entry;
+}
+
+void
+MM_FreeEntrySizeIndex::entryAllocated(MM_HeapLinkedFreeHeader *oldEntry, uintptr_t oldSize, MM_HeapLinkedFreeHeader *newEntry, uintptr_t newSize, MM_HeapLinkedFreeHeader *previous, MM_HeapLinkedFreeHeader *next)
+{
+	if (oldSize >= _minimumSize) {
+		uintptr_t slotIndex = findSlot(oldEntry);
+		Assert_MM_true(UDATA_MAX != slotIndex);
+		if ((NULL != newEntry) && (newSize >= _minimumSize)) {
+			/* The remainder lies between oldEntry and next, so the slot stays in address order */
+			_slots[slotIndex].entry = newEntry;
+			setSlotSize(slotIndex, newSize);
+		} else {
+			setSlotSize(slotIndex, 0);
+		}
+	}
+
+	if ((NULL != next) && (next->getSize() >= _minimumSize)) {
+		uintptr_t slotIndex = findSlot(next);
+		Assert_MM_true(UDATA_MAX != slotIndex);
+		_slots[slotIndex].previous = (NULL != newEntry) ? newEntry : previous;
+	}
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEENTRYSIZEINDEX_HPP_)
+#define FREEENTRYSIZEINDEX_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapLinkedFreeHeader;
+
+/**
+ * Size index over the large entries of an address ordered free list.
+ *
+ * Every free entry of at least the index minimum size has a slot, and slots are kept in address order.
+ * Each slot also records the entry preceding it in the free list, so that an entry found through the
+ * index can be unlinked without walking the list. A max tree over the slot sizes finds the lowest
+ * addressed entry able to satisfy a request in O(log n), which is the entry a first fit walk of the
+ * free list would have returned.
+ *
+ * The index is built from the free list in one walk. Afterwards allocations only shrink or remove
+ * entries, which update slots in place; any other change to the free list requires a rebuild.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeEntrySizeIndex : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	struct Slot {
+		MM_HeapLinkedFreeHeader *entry; /**< Free entry, or the last entry held by a removed slot (kept for address ordering) */
+		MM_HeapLinkedFreeHeader *previous; /**< Entry preceding entry in the free list, NULL if entry is the list head */
+	};
+
+	uintptr_t _minimumSize; /**< Free entries at least this large are indexed */
+	Slot *_slots; /**< Slots in address order */
+	uintptr_t *_maxSizes; /**< Max tree over slot sizes; node n has children 2n and 2n+1, leaves start at _leafCount */
+	uintptr_t _slotCount; /**< Number of slots in use */
+	uintptr_t _leafCount; /**< Number of leaves of the max tree (power of 2, at least _slotCount) */
+	bool _compressed; /**< True if the free list uses compressed references */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	void setSlotSize(uintptr_t slotIndex, uintptr_t size);
+	uintptr_t findSlot(MM_HeapLinkedFreeHeader *entry);
+	bool ensureCapacity(MM_EnvironmentBase *env, uintptr_t slotCount);
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+public:
+	static MM_FreeEntrySizeIndex *newInstance(MM_EnvironmentBase *env, uintptr_t minimumSize, bool compressed);
+	void kill(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getMinimumSize() { return _minimumSize; }
+
+	/**
+	 * @return the size of the largest indexed entry, or 0 if no entry is indexed
+	 */
+	MMINLINE uintptr_t getLargestSize() { return (0 == _slotCount) ? 0 : _maxSizes[1]; }
+
+	/**
+	 * Build the index from an address ordered free list.
+	 * @param freeList head of the free list
+	 * @return true on success, false if the slots could not be allocated (the index is then unusable)
+	 */
+	bool rebuild(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeList);
+
+	/**
+	 * Find the lowest addressed free entry of at least size bytes.
+	 * @param size the required size, which must be at least the index minimum size
+	 * @param[out] previous the entry preceding the one returned in the free list (NULL if it is the list head)
+	 * @return the free entry, or NULL if no free entry is large enough
+	 */
+	MM_HeapLinkedFreeHeader *findFirstFit(uintptr_t size, MM_HeapLinkedFreeHeader **previous);
+
+	/**
+	 * Record that a free entry has been allocated from. Its unallocated remainder (if any) replaces it in the
+	 * free list, and the entry following it in the list gets a new predecessor.
+	 * @param oldEntry the free entry allocated from
+	 * @param oldSize size of oldEntry before the allocation
+	 * @param newEntry the remainder now linked in place of oldEntry, or NULL if oldEntry was removed
+	 * @param newSize size of newEntry
+	 * @param previous the entry preceding oldEntry in the free list (NULL if it was the list head)
+	 * @param next the entry following oldEntry in the free list (NULL if it was the list tail)
+	 */
+	void entryAllocated(MM_HeapLinkedFreeHeader *oldEntry, uintptr_t oldSize, MM_HeapLinkedFreeHeader *newEntry, uintptr_t newSize, MM_HeapLinkedFreeHeader *previous, MM_HeapLinkedFreeHeader *next);
+
+	MM_FreeEntrySizeIndex(uintptr_t minimumSize, bool compressed)
+		: MM_BaseNonVirtual()
+		, _minimumSize(minimumSize)
+		, _slots(NULL)
+		, _maxSizes(NULL)
+		, _slotCount(0)
+		, _leafCount(0)
+		, _compressed(compressed)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* FREEENTRYSIZEINDEX_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -105,6 +105,13 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 	rememberedSet.setGrowSize(OMR_SCV_REMSET_SIZE);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (!segregatedRememberedSet.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET)) {
+		goto failed;
+	}
+	segregatedRememberedSet.setGrowSize(OMR_SCV_REMSET_SIZE);
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
 	lnrlOptions.spinCount1 = 256;
 	lnrlOptions.spinCount2 = 32;
@@ -230,6 +237,10 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 	rememberedSet.tearDown(env);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	segregatedRememberedSet.tearDown(env);
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(OMR_GC_REALTIME)
 	if (_omrVM->_gcCycleOnMonitor) {
 		omrthread_monitor_destroy(_omrVM->_gcCycleOnMonitor);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -60,6 +60,7 @@ class MM_GlobalCollector;
 class MM_Heap;
 class MM_HeapMap;
 class MM_HeapRegionManager;
+class MM_HeapUncommitter;
 
 class MM_InterRegionRememberedSet;
 class MM_MemoryManager;
@@ -287,6 +288,8 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	bool transparentHugePages; /**< if true, the heap is reserved aligned to TRANSPARENT_HUGE_PAGE_SIZE so that the kernel can back it with transparent huge pages (enabled with -Xgc:transparentHugePages) */
+	bool preTouchHeap; /**< if true, the committed heap memory is faulted in by the GC threads when they are started (enabled with -Xgc:preTouchHeap) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -332,6 +335,7 @@ public:
 	uintptr_t freeMemoryProfileMaxSizeClasses; /**< maximum number of sizeClass maintained for heap free memory profile (computed from SizeClassRatio) */
 
 	volatile OMR_VMThread* gcExclusiveAccessThreadId; /**< thread token that represents the current "winning" thread for performing garbage collection */
+	uintptr_t gcExclusiveAccessReleaseCount; /**< number of times exclusive VM access for GC has been released; mutators only run between two increments */
 	omrthread_monitor_t gcExclusiveAccessMutex; /**< Mutex used for acquiring gc priviledges as well as for signalling waiting threads that GC has been completed */
 
 	J9Pool* _lightweightNonReentrantLockPool;
@@ -350,6 +354,10 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, size each thread's TLHs from its allocation rate between GCs, and trim TLHs of idle threads at GC start */
+	uintptr_t tlhAdaptiveRefreshesPerCycle; /**< number of TLH refreshes per GC cycle adaptive sizing aims for; a thread leaves at most about 1/n of its allocation unused at GC start */
+	bool freeListSizeIndex; /**< if true, address ordered memory pools find large free entries through a size index instead of walking the free list */
+	uintptr_t freeListSizeIndexMinimumSize; /**< smallest free entry (and allocation) size handled by the free list size index */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -400,6 +408,8 @@ public:
 
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	bool deferredHeapUncommit; /**< if true, memory removed from the heap by contraction is uncommitted by a background thread instead of within the collection (enabled with -Xgc:deferredHeapUncommit) */
+	uintptr_t heapUncommitRate; /**< bytes per second the background thread may uncommit, 0 for no limit (set with -Xgc:heapUncommitRate=) */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */
@@ -407,6 +417,7 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workPacketDeques; /**< if set, GC threads keep non-empty work packets in per-thread work-stealing deques instead of the shared packet lists */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -465,6 +476,9 @@ public:
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	uintptr_t gcThreadSyncSpinCount; /**< number of spins a GC thread makes on a task synchronization point before parking on the monitor, 0 selects the monitor-only protocol */
+	uintptr_t dispatcherHotWindow; /**< time in microseconds a GC worker thread keeps spinning for the next task after completing one before parking, 0 parks immediately */
+	bool taskThreadCountModel; /**< if true, the dispatcher sizes the thread count of each task from its estimated work and the measured thread wakeup cost (enabled with -Xgc:taskThreadCountModel) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -489,6 +503,7 @@ public:
 	uint32_t maxHotFieldListLength;
 	uintptr_t minCpuUtil;
 	/* End of options relating to dynamicBreadthFirstScanOrdering */
+	bool scavengerLearnHotFields; /**< if true, the scavenger samples the fields through which young objects are copied and depth copies the hottest fields of each class in later cycles (enabled with -Xgc:scavengerLearnHotFields) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	uintptr_t scvTenureRatioHigh;
 	uintptr_t scvTenureRatioLow;
@@ -502,6 +517,8 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerNumaAware; /**< if true, GC threads copy into survivor memory of their own NUMA node and prefer scan work of their own node (enabled with -Xgc:scavengerNumaAware) */
+	uintptr_t scavengerRememberedSetPrefetchDistance; /**< number of remembered set entries ahead of the one being scanned whose object is prefetched, 0 to disable (set with -Xgc:scavengerRememberedSetPrefetchDistance=) */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS, complimentary to concurrentScavengerHWSupport with CS active */
 	bool softwareRangeCheckReadBarrierForced; /**< true if usage of softwareRangeCheckReadBarrier is requested explicitly */
@@ -576,6 +593,7 @@ public:
 	MM_Heap* heap;
 	MM_SparseVirtualMemory *largeObjectVirtualMemory; /**< Virtual memory for large objects (objectSize > arrayletLeafSize). Live large objects are committed to this separate virtual memory space when isVirtualLargeObjectHeapEnabled is true */
 	MM_HeapRegionManager* heapRegionManager; /**< The heap region manager used to view the heap as regions of memory */
+	MM_HeapUncommitter* heapUncommitter; /**< The background thread uncommitting memory removed from the heap, NULL unless deferredHeapUncommit is set */
 	MM_MemoryManager* memoryManager; /**< memory manager used to access to virtual memory instances */
 	uintptr_t aggressive;
 	MM_SweepHeapSectioning* sweepHeapSectioning; /**< Reference to the SweepHeapSectioning to Compact can share the backing store */
@@ -586,6 +604,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactIncremental; /**< If true, fragmentation triggered compactions only evacuate the most fragmented part of old space */
+	uintptr_t compactPauseBudget; /**< Target pause time in milliseconds used to size the area evacuated by an incremental compaction */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -601,6 +621,8 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool concurrentPacing; /**< if true, a pacing controller predicts the concurrent kickoff from allocation and trace rates and scales the allocation tax */
+	bool partitionedFinalCardCleaning; /**< if true, final card cleaning splits the card table into one partition per GC thread and threads steal batches of cards from other partitions once their own is done */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -679,6 +701,11 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	uintptr_t segregatedRegionRefillBatch; /**< Number of regions taken from a shared region list in one refill of an allocation context's size class reserve, or of the single free region list */
+	MM_SublistPool segregatedRememberedSet; /**< Old objects that were stored young references in generational segregated mode */
+	bool segregatedGenerational; /**< Collect the segregated heap generationally: objects surviving a collection keep their mark (sticky mark bits) and most collections only trace objects allocated since */
+	uintptr_t segregatedMinorCollectionsPerGlobal; /**< Number of consecutive minor (nursery only) collections allowed before a full heap collection is forced in generational segregated mode */
+	bool segregatedRememberedSetOverflow; /**< Set when a remembered object could not be added to segregatedRememberedSet, forcing the next collection to trace the whole heap */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -715,6 +742,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Write logs (e.g. verbose:gc) to a file from a background thread so that collections never wait for file I/O */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc logs to a file in the compact binary format of VerboseBinaryFormat.hpp, takes precedence over asyncLogging and bufferedLogging */
+	uintptr_t asyncLoggingBufferSize; /**< bytes of output queued for the background log writer before output is dropped (set with -Xgc:asyncLoggingBufferSize=) */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -1441,6 +1471,8 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, transparentHugePages(false)
+		, preTouchHeap(false)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1474,6 +1506,7 @@ public:
 		, largeObjectAllocationProfilingTopK(8)
 		, freeMemoryProfileMaxSizeClasses(0)
 		, gcExclusiveAccessThreadId(NULL)
+		, gcExclusiveAccessReleaseCount(0)
 		, gcExclusiveAccessMutex(NULL)
 		, _lightweightNonReentrantLockPool(NULL)
 #if defined(OMR_GC_COMBINATION_SPEC)
@@ -1488,6 +1521,10 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshesPerCycle(16)
+		, freeListSizeIndex(false)
+		, freeListSizeIndexMinimumSize(64 * 1024)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1524,11 +1561,14 @@ public:
 		, heapContractionGCRatioThreshold()
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, deferredHeapUncommit(false)
+		, heapUncommitRate(128 * 1024 * 1024)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workPacketDeques(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1576,6 +1616,9 @@ public:
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, gcThreadSyncSpinCount(0)
+		, dispatcherHotWindow(0)
+		, taskThreadCountModel(false)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_NONE)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1593,6 +1636,7 @@ public:
 		, maxHotFieldListLength(10)
 		, minCpuUtil (1)
 		/* End of options relating to dynamicBreadthFirstScanOrdering */
+		, scavengerLearnHotFields(false)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, scvTenureRatioHigh(OMR_SCV_TENURE_RATIO_HIGH)
@@ -1607,6 +1651,8 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerNumaAware(false)
+		, scavengerRememberedSetPrefetchDistance(8)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, softwareRangeCheckReadBarrierForced(false)
@@ -1665,6 +1711,7 @@ public:
 		, heap(NULL)
 		, largeObjectVirtualMemory(NULL)
 		, heapRegionManager(NULL)
+		, heapUncommitter(NULL)
 		, memoryManager(NULL)
 		, aggressive(0)
 		, sweepHeapSectioning(0)
@@ -1674,6 +1721,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactIncremental(false)
+		, compactPauseBudget(10)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1687,6 +1736,8 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, concurrentPacing(false)
+		, partitionedFinalCardCleaning(false)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1744,6 +1795,11 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedRegionRefillBatch(4)
+		, segregatedRememberedSet()
+		, segregatedGenerational(false)
+		, segregatedMinorCollectionsPerGlobal(8)
+		, segregatedRememberedSetOverflow(false)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1771,6 +1827,9 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, binaryLogging(false)
+		, asyncLoggingBufferSize(1024 * 1024)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -30,6 +30,7 @@
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapUncommitter.hpp"
 #include "HeapStats.hpp"
 #include "MemorySpace.hpp"
 #include "ModronAssertions.h"
@@ -108,6 +109,22 @@ MM_Heap::systemGarbageCollect(MM_EnvironmentBase* env, uint32_t gcCode)
 	getDefaultMemorySpace()->systemGarbageCollect(env, gcCode);
 }
 
+/**
+ * Decommit memory that a contraction has removed from the heap.
+ * When deferred uncommit is enabled the range is handed to the background uncommit thread, so that the
+ * collection does not pay for the decommit, otherwise (or if the range cannot be queued) it is decommitted now.
+ * @return true if the memory was decommitted or queued, false otherwise
+ */
+bool
+MM_Heap::decommitRemovedMemory(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	MM_HeapUncommitter *heapUncommitter = env->getExtensions()->heapUncommitter;
+	if ((NULL != heapUncommitter) && heapUncommitter->deferUncommit(env, address, size, lowValidAddress, highValidAddress)) {
+		return true;
+	}
+	return decommitMemory(address, size, lowValidAddress, highValidAddress);
+}
+
 /**
  * Calculate the total amount of memory consumed by all memory space.
  * @return Total memory consumed by all memory spaces.
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -128,6 +128,7 @@ public:
 
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+	bool decommitRemovedMemory(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
 
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+#include "mmprivatehook.h"
+#include "ModronAssertions.h"
+
+#include "HeapUncommitter.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+#include "ParallelDispatcher.hpp"
+
+/* Bytes decommitted at a time, so that cancelling never waits long for the chunk in progress */
+#define HEAP_UNCOMMITTER_CHUNK_SIZE ((uintptr_t)(2 * 1024 * 1024))
+
+MM_HeapUncommitter::MM_HeapUncommitter(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _extensions(env->getExtensions())
+	, _uncommitMonitor(NULL)
+	, _threadState(STATE_NOT_STARTED)
+	, _pendingRangeCount(0)
+	, _pendingBytes(0)
+	, _uncommittedBytes(0)
+	, _cancelledBytes(0)
+	, _uncommitMicros(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_HeapUncommitter *
+MM_HeapUncommitter::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HeapUncommitter *uncommitter = (MM_HeapUncommitter *)env->getForge()->allocate(sizeof(MM_HeapUncommitter), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != uncommitter) {
+		new(uncommitter) MM_HeapUncommitter(env);
+		if (!uncommitter->initialize(env)) {
+			uncommitter->kill(env);
+			uncommitter = NULL;
+		}
+	}
+	return uncommitter;
+}
+
+void
+MM_HeapUncommitter::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HeapUncommitter::initialize(MM_EnvironmentBase *env)
+{
+	return (0 == omrthread_monitor_init_with_name(&_uncommitMonitor, 0, "MM_HeapUncommitter::_uncommitMonitor"));
+}
+
+void
+MM_HeapUncommitter::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _uncommitMonitor) {
+		shutdown();
+		omrthread_monitor_destroy(_uncommitMonitor);
+		_uncommitMonitor = NULL;
+	}
+}
+
+int J9THREAD_PROC
+MM_HeapUncommitter::uncommit_thread_proc(void *info)
+{
+	MM_HeapUncommitter *uncommitter = (MM_HeapUncommitter *)info;
+	MM_GCExtensionsBase *extensions = uncommitter->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(uncommit_thread_proc2, info,
+			extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+uintptr_t
+MM_HeapUncommitter::uncommit_thread_proc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_HeapUncommitter *uncommitter = (MM_HeapUncommitter *)info;
+	/* this method will NOT return, the thread exits once it is asked to terminate */
+	uncommitter->uncommitThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+bool
+MM_HeapUncommitter::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it cannot report its state before we wait for it */
+	omrthread_monitor_enter(_uncommitMonitor);
+	_threadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		uncommit_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _threadState) {
+			omrthread_monitor_wait(_uncommitMonitor);
+		}
+		success = (STATE_RUNNING == _threadState);
+	} else {
+		_threadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_uncommitMonitor);
+
+	return success;
+}
+
+void
+MM_HeapUncommitter::shutdown()
+{
+	omrthread_monitor_enter(_uncommitMonitor);
+	if (STATE_RUNNING == _threadState) {
+		_threadState = STATE_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_uncommitMonitor);
+		while (STATE_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_uncommitMonitor);
+		}
+	}
+	/* whatever is still queued stays committed */
+	_pendingRangeCount = 0;
+	_pendingBytes = 0;
+	omrthread_monitor_exit(_uncommitMonitor);
+}
+
+void
+MM_HeapUncommitter::uncommitThreadEntryPoint()
+{
+	omrthread_monitor_enter(_uncommitMonitor);
+	_threadState = STATE_RUNNING;
+	omrthread_monitor_notify_all(_uncommitMonitor);
+
+	while (STATE_TERMINATION_REQUESTED != _threadState) {
+		if (0 == _pendingRangeCount) {
+			omrthread_monitor_wait(_uncommitMonitor);
+		} else {
+			uintptr_t chunkBytes = uncommitNextChunk();
+			uintptr_t rate = _extensions->heapUncommitRate;
+			if (0 != rate) {
+				/* pause after each chunk so that no more than the rate is uncommitted per second */
+				uint64_t pauseMillis = ((uint64_t)chunkBytes * 1000) / rate;
+				if (0 != pauseMillis) {
+					omrthread_monitor_wait_timed(_uncommitMonitor, (int64_t)pauseMillis, 0);
+				}
+			}
+		}
+	}
+
+	_threadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_uncommitMonitor);
+	omrthread_exit(_uncommitMonitor);
+}
+
+uintptr_t
+MM_HeapUncommitter::uncommitNextChunk()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	PendingRange *range = &_pendingRanges[_pendingRangeCount - 1];
+
+	/* chunks are aligned, so that the pages decommitted by consecutive chunks meet */
+	uintptr_t chunkSize = OMR_MAX(HEAP_UNCOMMITTER_CHUNK_SIZE, _extensions->heap->getPageSize());
+	uintptr_t chunkTop = OMR_MIN(MM_Math::roundToFloor(chunkSize, range->base) + chunkSize, range->top);
+	uintptr_t chunkBytes = chunkTop - range->base;
+
+	uint64_t startTime = omrtime_hires_clock();
+	_extensions->heap->decommitMemory((void *)range->base, chunkBytes, range->lowValidAddress, range->highValidAddress);
+	_uncommitMicros += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	_uncommittedBytes += chunkBytes;
+	_pendingBytes -= chunkBytes;
+	range->base = chunkTop;
+	if (range->base >= range->top) {
+		_pendingRangeCount -= 1;
+	}
+
+	return chunkBytes;
+}
+
+bool
+MM_HeapUncommitter::addPendingRange(uintptr_t base, uintptr_t top, void *lowValidAddress, void *highValidAddress)
+{
+	for (uintptr_t i = 0; i < _pendingRangeCount; i++) {
+		PendingRange *range = &_pendingRanges[i];
+		if (range->base == top) {
+			/* the heap kept contracting downwards */
+			range->base = base;
+			range->lowValidAddress = lowValidAddress;
+			return true;
+		}
+		if (range->top == base) {
+			range->top = top;
+			range->highValidAddress = highValidAddress;
+			return true;
+		}
+	}
+
+	bool added = false;
+	if (_pendingRangeCount < HEAP_UNCOMMITTER_MAX_PENDING_RANGES) {
+		PendingRange *range = &_pendingRanges[_pendingRangeCount];
+		range->base = base;
+		range->top = top;
+		range->lowValidAddress = lowValidAddress;
+		range->highValidAddress = highValidAddress;
+		_pendingRangeCount += 1;
+		added = true;
+	}
+	return added;
+}
+
+bool
+MM_HeapUncommitter::deferUncommit(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	bool deferred = false;
+
+	omrthread_monitor_enter(_uncommitMonitor);
+	if ((STATE_RUNNING == _threadState) && (0 != size)) {
+		bool threadIdle = (0 == _pendingRangeCount);
+		deferred = addPendingRange((uintptr_t)address, (uintptr_t)address + size, lowValidAddress, highValidAddress);
+		if (deferred) {
+			_pendingBytes += size;
+			if (threadIdle) {
+				/* do not wake the thread while it is pausing between chunks, that would exceed the rate */
+				omrthread_monitor_notify(_uncommitMonitor);
+			}
+		}
+	}
+	uintptr_t pendingBytes = _pendingBytes;
+	uintptr_t uncommittedBytes = _uncommittedBytes;
+	uintptr_t cancelledBytes = _cancelledBytes;
+	uint64_t uncommitMicros = _uncommitMicros;
+	omrthread_monitor_exit(_uncommitMonitor);
+
+	if (deferred) {
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_UNCOMMIT(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			omrtime_hires_clock(),
+			J9HOOK_MM_PRIVATE_HEAP_UNCOMMIT,
+			size,
+			pendingBytes,
+			uncommittedBytes,
+			cancelledBytes,
+			uncommitMicros
+		);
+	}
+
+	return deferred;
+}
+
+void
+MM_HeapUncommitter::cancelUncommit(void *address, uintptr_t size)
+{
+	uintptr_t commitBase = (uintptr_t)address;
+	uintptr_t commitTop = commitBase + size;
+
+	omrthread_monitor_enter(_uncommitMonitor);
+	uintptr_t i = _pendingRangeCount;
+	while (0 < i) {
+		i -= 1;
+		PendingRange *range = &_pendingRanges[i];
+		if (commitTop <= range->base) {
+			/* decommitting never goes below the base of a range */
+		} else if (commitBase >= range->top) {
+			/* the tail padding of the heap may make the decommit of the range reach the committed memory */
+			if ((NULL == range->highValidAddress) || ((uintptr_t)range->highValidAddress > commitBase)) {
+				range->highValidAddress = (void *)commitBase;
+			}
+		} else {
+			uintptr_t cancelledBytes = OMR_MIN(commitTop, range->top) - OMR_MAX(commitBase, range->base);
+			PendingRange upper = *range;
+			bool hasLower = (range->base < commitBase);
+			bool hasUpper = (commitTop < range->top);
+
+			if (hasLower) {
+				range->top = commitBase;
+				range->highValidAddress = (void *)commitBase;
+			} else {
+				/* the last range may be the one being uncommitted, so keep the order of the others */
+				for (uintptr_t j = i + 1; j < _pendingRangeCount; j++) {
+					_pendingRanges[j - 1] = _pendingRanges[j];
+				}
+				_pendingRangeCount -= 1;
+			}
+			if (hasUpper) {
+				/* the part above the committed memory has the committed memory as its lower neighbour */
+				upper.base = commitTop;
+				if (_pendingRangeCount < HEAP_UNCOMMITTER_MAX_PENDING_RANGES) {
+					_pendingRanges[_pendingRangeCount] = upper;
+					_pendingRangeCount += 1;
+				} else {
+					/* no room to track it, leave it committed */
+					cancelledBytes += upper.top - upper.base;
+				}
+			}
+
+			_pendingBytes -= cancelledBytes;
+			_cancelledBytes += cancelledBytes;
+		}
+	}
+	omrthread_monitor_exit(_uncommitMonitor);
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPUNCOMMITTER_HPP_)
+#define HEAPUNCOMMITTER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/* Number of removed ranges of the heap that can wait to be uncommitted at once */
+#define HEAP_UNCOMMITTER_MAX_PENDING_RANGES 32
+
+/**
+ * Background thread returning the memory removed from the heap by a contraction to the operating system.
+ *
+ * A contraction only queues the range it removed (deferUncommit()), and the low priority uncommit
+ * thread decommits the queued ranges a chunk at a time, pausing between chunks so that no more than
+ * heapUncommitRate bytes are decommitted per second. The collection contracting the heap does not wait
+ * for the decommit.
+ *
+ * A queued range is no longer part of the heap, so the only thing that can touch it is a later
+ * expansion of the heap. The heap cancels the part of any queued range it commits again
+ * (cancelUncommit()) before using it. Chunks are decommitted while holding the uncommitter monitor,
+ * so cancelling waits for a chunk in progress to complete.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapUncommitter : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	typedef enum UncommitThreadState {
+		STATE_NOT_STARTED = 0,
+		STATE_ERROR,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} UncommitThreadState;
+
+	struct PendingRange {
+		uintptr_t base; /**< lowest address of the range still to be uncommitted */
+		uintptr_t top; /**< end of the range */
+		void *lowValidAddress; /**< highest address below the range still in use when it was removed from the heap, or NULL */
+		void *highValidAddress; /**< lowest address above the range still in use when it was removed from the heap, or NULL */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _uncommitMonitor; /**< protects the pending ranges and statistics, and is held while a chunk is decommitted */
+	volatile UncommitThreadState _threadState;
+	PendingRange _pendingRanges[HEAP_UNCOMMITTER_MAX_PENDING_RANGES];
+	uintptr_t _pendingRangeCount;
+	uintptr_t _pendingBytes; /**< bytes queued and not yet uncommitted or cancelled */
+	uintptr_t _uncommittedBytes; /**< total bytes uncommitted by the uncommit thread */
+	uintptr_t _cancelledBytes; /**< total queued bytes committed again by the heap before they were uncommitted */
+	uint64_t _uncommitMicros; /**< total time the uncommit thread spent decommitting */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	static int J9THREAD_PROC uncommit_thread_proc(void *info);
+	static uintptr_t uncommit_thread_proc2(OMRPortLibrary *portLib, void *info);
+	void uncommitThreadEntryPoint();
+
+	/**
+	 * Decommit the next chunk of the last pending range, dropping the range once it is complete.
+	 * Called with the uncommitter monitor held.
+	 * @return the number of bytes of the heap the chunk covered
+	 */
+	uintptr_t uncommitNextChunk();
+
+	/**
+	 * Queue a range, merging it with a pending range it extends.
+	 * Called with the uncommitter monitor held.
+	 * @return false if the queue is full
+	 */
+	bool addPendingRange(uintptr_t base, uintptr_t top, void *lowValidAddress, void *highValidAddress);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_HeapUncommitter *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the uncommit thread, waiting until it reports it is running.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Stop the uncommit thread. Ranges still queued are left committed.
+	 */
+	void shutdown();
+
+	/**
+	 * Queue memory removed from the heap to be uncommitted by the uncommit thread.
+	 * The arguments are the ones MM_Heap::decommitMemory() would have been called with.
+	 * @return true if the range was queued, false if the caller has to decommit it itself
+	 */
+	bool deferUncommit(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Remove the memory about to be committed again by the heap from the queued ranges.
+	 * Waits for a chunk being decommitted to complete.
+	 */
+	void cancelUncommit(void *address, uintptr_t size);
+
+	MM_HeapUncommitter(MM_EnvironmentBase *env);
+};
+
+#endif /* HEAPUNCOMMITTER_HPP_ */
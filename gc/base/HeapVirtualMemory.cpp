@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -29,6 +29,7 @@
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapUncommitter.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
@@ -80,6 +81,10 @@ MM_HeapVirtualMemory::initialize(MM_EnvironmentBase* env, uintptr_t size)
 	/* we need to ensure that we allocate the heap with region alignment since the region table requires that */
 	MM_HeapRegionManager* manager = getHeapRegionManager();
 	effectiveHeapAlignment = MM_Math::roundToCeiling(manager->getRegionSize(), effectiveHeapAlignment);
+	if (extensions->transparentHugePages) {
+		/* start the heap on a huge page boundary so that every huge page sized piece of it can be backed by one */
+		effectiveHeapAlignment = MM_Math::roundToCeiling(TRANSPARENT_HUGE_PAGE_SIZE, effectiveHeapAlignment);
+	}
 
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
 	bool created = false;
@@ -320,6 +325,11 @@ MM_HeapVirtualMemory::commitMemory(void* address, uintptr_t size)
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
 
+	if (NULL != extensions->heapUncommitter) {
+		/* the heap is growing back into memory that may still be queued for uncommit */
+		extensions->heapUncommitter->cancelUncommit(address, size);
+	}
+
 	bool resultCommitMemory = memoryManager->commitMemory(&_vmemHandle, address, size);
 
 	if (resultCommitMemory && extensions->pretouchHeapOnExpand) {
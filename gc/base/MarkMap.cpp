@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -27,6 +27,13 @@
 
 #include "omrcfg.h"
 #include "omr.h"
+#include "omrport.h"
+
+#if defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && defined(__GNUC__)
+/* SSE2 is part of the x86-64 baseline, no runtime check is required */
+#define OMR_GC_MARKMAP_NONTEMPORAL_CLEAR
+#include <emmintrin.h>
+#endif /* defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && defined(__GNUC__) */
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -57,6 +64,112 @@ MM_MarkMap::newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
 	return markMap;
 }
 
+bool
+MM_MarkMap::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_HeapMap::initialize(env)) {
+		return false;
+	}
+
+	/* Not fatal if this fails - the whole map is simply cleared every time */
+	uintptr_t cleanUnitsSize = (_extensions->heap->getMaximumPhysicalRange() >> J9MODRON_MARK_MAP_CLEAN_UNIT_SHIFT) + 1;
+	_cleanUnits = (uint8_t *)env->getForge()->allocate(cleanUnitsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != _cleanUnits) {
+		memset(_cleanUnits, 0, cleanUnitsSize);
+		_cleanUnitsSize = cleanUnitsSize;
+	}
+
+	return true;
+}
+
+void
+MM_MarkMap::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _cleanUnits) {
+		env->getForge()->free(_cleanUnits);
+		_cleanUnits = NULL;
+		_cleanUnitsSize = 0;
+	}
+
+	MM_HeapMap::tearDown(env);
+}
+
+void
+MM_MarkMap::startCleanUnitTracking(MM_EnvironmentBase *env)
+{
+	if (NULL != _cleanUnits) {
+		memset(_cleanUnits, 0, _cleanUnitsSize);
+		_cleanUnitsValid = true;
+	}
+}
+
+/**
+ * Zero a range of the mark map. Large ranges bypass the cache since marking touches the map sparsely afterwards.
+ */
+void
+MM_MarkMap::clearRange(uint8_t *base, uintptr_t size)
+{
+#if defined(OMR_GC_MARKMAP_NONTEMPORAL_CLEAR)
+	/* below a few pages the cache pollution does not matter and the fence costs more than it saves */
+	const uintptr_t nonTemporalThreshold = 16 * 1024;
+	if (size >= nonTemporalThreshold) {
+		uint8_t *top = base + size;
+		uint8_t *alignedBase = (uint8_t *)MM_Math::roundToCeiling(sizeof(__m128i), (uintptr_t)base);
+		uint8_t *alignedTop = (uint8_t *)MM_Math::roundToFloor(sizeof(__m128i), (uintptr_t)top);
+		const __m128i zero = _mm_setzero_si128();
+
+		OMRZeroMemory(base, alignedBase - base);
+		for (__m128i *current = (__m128i *)alignedBase; current < (__m128i *)alignedTop; current += 4) {
+			_mm_stream_si128(current, zero);
+			_mm_stream_si128(current + 1, zero);
+			_mm_stream_si128(current + 2, zero);
+			_mm_stream_si128(current + 3, zero);
+		}
+		OMRZeroMemory(alignedTop, top - alignedTop);
+		/* streaming stores are weakly ordered, publish them before marking starts */
+		_mm_sfence();
+		return;
+	}
+#endif /* OMR_GC_MARKMAP_NONTEMPORAL_CLEAR */
+	OMRZeroMemory(base, size);
+}
+
+/**
+ * Clear the mark map for the heap range [heapLow, heapHigh), skipping clean units.
+ * @return the number of mark map bytes skipped
+ */
+uintptr_t
+MM_MarkMap::clearDirtyUnits(MM_EnvironmentBase *env, uint8_t *heapLow, uint8_t *heapHigh)
+{
+	uintptr_t bytesSkipped = 0;
+	uint8_t *current = heapLow;
+
+	while (current < heapHigh) {
+		/* Gather the longest run of units which are all dirty or all clean */
+		uintptr_t unitIndex = ((uintptr_t)current - (uintptr_t)_heapBase) >> J9MODRON_MARK_MAP_CLEAN_UNIT_SHIFT;
+		bool clean = (0 != _cleanUnits[unitIndex]);
+		uint8_t *runTop = current;
+		do {
+			runTop = (uint8_t *)(_heapMapBaseDelta + ((unitIndex + 1) << J9MODRON_MARK_MAP_CLEAN_UNIT_SHIFT));
+			unitIndex += 1;
+		} while ((runTop < heapHigh) && (clean == (0 != _cleanUnits[unitIndex])));
+		if (runTop > heapHigh) {
+			runTop = heapHigh;
+		}
+
+		uintptr_t heapMapIndex = convertHeapIndexToHeapMapIndex(env, (uintptr_t)current - _heapMapBaseDelta, sizeof(uintptr_t));
+		uintptr_t heapMapSize = convertHeapIndexToHeapMapIndex(env, (uintptr_t)runTop - _heapMapBaseDelta, sizeof(uintptr_t)) - heapMapIndex;
+		if (clean) {
+			bytesSkipped += heapMapSize;
+		} else {
+			clearRange((uint8_t *)_heapMapBits + heapMapIndex, heapMapSize);
+		}
+		current = runTop;
+	}
+
+	return bytesSkipped;
+}
+
 void
 MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 {
@@ -70,6 +183,13 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 	uintptr_t heapClearUnitSize = _extensions->heap->getMemorySize() / heapClearUnitFactor;
 	heapClearUnitSize = MM_Math::roundToCeiling(heapAlignment, heapClearUnitSize);
 
+	/* Every thread samples the flag before any of them can clear it (see MM_MarkingScheme::markLiveObjectsInit) */
+	bool skipCleanUnits = _cleanUnitsValid;
+	uintptr_t bytesCleared = 0;
+	uintptr_t bytesSkipped = 0;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
 	/* Walk all object segments to determine what ranges of the mark map should be cleared */
 	MM_HeapRegionDescriptor *region;
 	MM_Heap *heap = _extensions->getHeap();
@@ -102,7 +222,14 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 						- heapMapClearIndex;
 
 					/* And clear the mark map */
-					OMRZeroMemory((void *) (((uintptr_t)_heapMapBits) + heapMapClearIndex), heapMapClearSize);
+					uintptr_t skipped = 0;
+					if (skipCleanUnits) {
+						skipped = clearDirtyUnits(env, heapClearAddress, heapClearAddress + heapCurrentClearSize);
+					} else {
+						clearRange((uint8_t *)_heapMapBits + heapMapClearIndex, heapMapClearSize);
+					}
+					bytesSkipped += skipped;
+					bytesCleared += heapMapClearSize - skipped;
 				}
 
 				/* Move to the next address range in the segment */
@@ -111,4 +238,8 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase *env)
 			}
 		}
 	}
+
+	env->_markStats._markMapClearTime += omrtime_hires_clock() - startTime;
+	env->_markStats._markMapBytesCleared += bytesCleared;
+	env->_markStats._markMapBytesSkipped += bytesSkipped;
 }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -40,21 +40,67 @@
 
 #define BITS_PER_BYTE 8
 
+/* Heap bytes covered by one entry of the table of mark map ranges known to be clear */
+#define J9MODRON_MARK_MAP_CLEAN_UNIT_SHIFT 16
+
 class MM_EnvironmentBase;
 
 class MM_MarkMap : public MM_HeapMap
 {
 private:
 	bool _isMarkMapValid; /** < Is this mark map valid */
-	
+	uint8_t *_cleanUnits; /**< One byte per clean unit of heap, non-zero if the mark bits of the unit are known to be clear */
+	uintptr_t _cleanUnitsSize; /**< Number of entries in _cleanUnits */
+	volatile bool _cleanUnitsValid; /**< True if _cleanUnits may be trusted, false once the map was written outside of a mark/sweep cycle */
+
+	void clearRange(uint8_t *base, uintptr_t size);
+	uintptr_t clearDirtyUnits(MM_EnvironmentBase *env, uint8_t *heapLow, uint8_t *heapHigh);
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
 public:
 	MMINLINE bool isMarkMapValid() const { return _isMarkMapValid; }
 	MMINLINE void setMarkMapValid(bool isMarkMapValid) {  _isMarkMapValid = isMarkMapValid; }
 
  	static MM_MarkMap *newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize);
  	
+	/**
+	 * Clear the mark map for all committed regions, in parallel across the threads of the current task.
+	 * Ranges which sweep found to hold no mark bits since the map was last cleared are skipped.
+	 * Bytes cleared, bytes skipped and time spent are accumulated into the thread's mark stats.
+	 */
  	void initializeMarkMap(MM_EnvironmentBase *env);
 
+	/**
+	 * Forget which ranges of the map are known to be clear. Must be called by anything setting bits
+	 * in the map other than marking, which is always followed by a sweep re-establishing them.
+	 */
+	MMINLINE void invalidateCleanUnits() { _cleanUnitsValid = false; }
+
+	/**
+	 * Start establishing which ranges of the map are clear, assuming none are. Main thread only, before sweep.
+	 */
+	void startCleanUnitTracking(MM_EnvironmentBase *env);
+
+	/**
+	 * Record that the mark map holds no bits for the heap range [lowAddress, highAddress).
+	 * Only clean units entirely within the range are recorded. Safe to call from several threads for disjoint ranges.
+	 */
+	MMINLINE void
+	setCleanUnits(void *lowAddress, void *highAddress)
+	{
+		if (NULL != _cleanUnits) {
+			uintptr_t unitSize = (uintptr_t)1 << J9MODRON_MARK_MAP_CLEAN_UNIT_SHIFT;
+			uintptr_t lowIndex = ((uintptr_t)lowAddress - (uintptr_t)_heapBase + unitSize - 1) >> J9MODRON_MARK_MAP_CLEAN_UNIT_SHIFT;
+			uintptr_t highIndex = ((uintptr_t)highAddress - (uintptr_t)_heapBase) >> J9MODRON_MARK_MAP_CLEAN_UNIT_SHIFT;
+			for (uintptr_t index = lowIndex; index < highIndex; index++) {
+				_cleanUnits[index] = 1;
+			}
+		}
+	}
+
 	MMINLINE void *getMarkBits() { return _heapMapBits; };
  	
 	MMINLINE uintptr_t getHeapMapBaseRegionRounded() { return _heapMapBaseDelta; }
@@ -123,6 +169,9 @@ public:
 	MM_MarkMap(MM_EnvironmentBase *env, uintptr_t maxHeapSize) :
 		MM_HeapMap(env, maxHeapSize, env->getExtensions()->isSegregatedHeap())
 		, _isMarkMapValid(false)
+		, _cleanUnits(NULL)
+		, _cleanUnitsSize(0)
+		, _cleanUnitsValid(false)
 	{
 		_typeId = __FUNCTION__;
 	};
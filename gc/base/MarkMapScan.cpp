@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "MarkMapScan.hpp"
+
+#if defined(OMR_GC_MARKMAP_SCAN_X86_SIMD)
+#include <immintrin.h>
+
+/**
+ * AVX2 state is only usable if the OS saves the YMM registers on context switch (XCR0 bits 1 and 2).
+ */
+static bool
+isYMMStateEnabled()
+{
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	return 6 == (eax & 6);
+}
+#endif /* OMR_GC_MARKMAP_SCAN_X86_SIMD */
+
+MM_MarkMapScan::Kernel
+MM_MarkMapScan::selectKernel(OMRPortLibrary *portLibrary)
+{
+	Kernel kernel = kernel_scalar;
+
+#if defined(OMR_GC_MARKMAP_SCAN_X86_SIMD)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRProcessorDesc desc;
+	if (0 == omrsysinfo_get_processor_description(&desc)) {
+		if (omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_SSE4_1)) {
+			kernel = kernel_sse4;
+		}
+		if (omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_AVX2)
+			&& omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_OSXSAVE)
+			&& isYMMStateEnabled()
+		) {
+			kernel = kernel_avx2;
+		}
+	}
+#endif /* OMR_GC_MARKMAP_SCAN_X86_SIMD */
+
+	return kernel;
+}
+
+MM_MarkMapScan::FindNonEmptySlot
+MM_MarkMapScan::getKernel(Kernel kernel)
+{
+	FindNonEmptySlot result = NULL;
+
+	switch (kernel) {
+	case kernel_scalar:
+		result = findNonEmptySlotScalar;
+		break;
+#if defined(OMR_GC_MARKMAP_SCAN_X86_SIMD)
+	case kernel_sse4:
+		result = findNonEmptySlotSSE4;
+		break;
+	case kernel_avx2:
+		result = findNonEmptySlotAVX2;
+		break;
+#endif /* OMR_GC_MARKMAP_SCAN_X86_SIMD */
+	default:
+		break;
+	}
+
+	return result;
+}
+
+const char *
+MM_MarkMapScan::getKernelName(Kernel kernel)
+{
+	switch (kernel) {
+	case kernel_scalar:
+		return "scalar";
+	case kernel_sse4:
+		return "sse4";
+	case kernel_avx2:
+		return "avx2";
+	default:
+		return "unknown";
+	}
+}
+
+uintptr_t *
+MM_MarkMapScan::findNonEmptySlotScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(OMR_GC_MARKMAP_SCAN_X86_SIMD)
+__attribute__((target("sse4.1")))
+uintptr_t *
+MM_MarkMapScan::findNonEmptySlotSSE4(uintptr_t *current, uintptr_t *top)
+{
+	/* reach vector alignment one slot at a time */
+	while ((current < top) && (0 != ((uintptr_t)current & (sizeof(__m128i) - 1)))) {
+		if (0 != *current) {
+			return current;
+		}
+		current += 1;
+	}
+
+	/* test a cache line per iteration */
+	while (((uintptr_t)top - (uintptr_t)current) >= (4 * sizeof(__m128i))) {
+		__m128i const *vector = (__m128i const *)current;
+		__m128i merged = _mm_or_si128(_mm_or_si128(_mm_load_si128(vector), _mm_load_si128(vector + 1)),
+				_mm_or_si128(_mm_load_si128(vector + 2), _mm_load_si128(vector + 3)));
+		if (!_mm_testz_si128(merged, merged)) {
+			/* one bit per non-zero byte of the cache line, the lowest one belongs to the first live slot */
+			__m128i zero = _mm_setzero_si128();
+			uint64_t nonZeroBytes = ~(uint64_t)(
+				(uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(vector), zero))
+				| ((uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(vector + 1), zero)) << 16)
+				| ((uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(vector + 2), zero)) << 32)
+				| ((uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(vector + 3), zero)) << 48));
+			return current + (__builtin_ctzll(nonZeroBytes) / sizeof(uintptr_t));
+		}
+		current += (4 * sizeof(__m128i)) / sizeof(uintptr_t);
+	}
+
+	/* tail shorter than a cache line */
+	return findNonEmptySlotScalar(current, top);
+}
+
+__attribute__((target("avx2")))
+uintptr_t *
+MM_MarkMapScan::findNonEmptySlotAVX2(uintptr_t *current, uintptr_t *top)
+{
+	/* reach vector alignment one slot at a time */
+	while ((current < top) && (0 != ((uintptr_t)current & (sizeof(__m256i) - 1)))) {
+		if (0 != *current) {
+			return current;
+		}
+		current += 1;
+	}
+
+	/* test two cache lines per iteration */
+	while (((uintptr_t)top - (uintptr_t)current) >= (4 * sizeof(__m256i))) {
+		__m256i const *vector = (__m256i const *)current;
+		__m256i merged = _mm256_or_si256(_mm256_or_si256(_mm256_load_si256(vector), _mm256_load_si256(vector + 1)),
+				_mm256_or_si256(_mm256_load_si256(vector + 2), _mm256_load_si256(vector + 3)));
+		if (!_mm256_testz_si256(merged, merged)) {
+			/* one bit per non-zero byte of the two cache lines, the lowest one belongs to the first live slot */
+			__m256i zero = _mm256_setzero_si256();
+			uint64_t nonZeroLow = ~(uint64_t)(
+				(uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(vector), zero))
+				| ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(vector + 1), zero)) << 32));
+			if (0 != nonZeroLow) {
+				return current + (__builtin_ctzll(nonZeroLow) / sizeof(uintptr_t));
+			}
+			uint64_t nonZeroHigh = ~(uint64_t)(
+				(uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(vector + 2), zero))
+				| ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(vector + 3), zero)) << 32));
+			return current + ((64 + __builtin_ctzll(nonZeroHigh)) / sizeof(uintptr_t));
+		}
+		current += (4 * sizeof(__m256i)) / sizeof(uintptr_t);
+	}
+
+	/* tail shorter than two cache lines */
+	return findNonEmptySlotScalar(current, top);
+}
+#endif /* OMR_GC_MARKMAP_SCAN_X86_SIMD */
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(MARKMAPSCAN_HPP_)
+#define MARKMAPSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronbase.h"
+
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+#define OMR_GC_MARKMAP_SCAN_X86_SIMD
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+/**
+ * Kernels which skip runs of empty mark map slots. Sweep spends most of its time in these runs on
+ * mostly dead heaps, so vector kernels test several slots per instruction. The kernel is chosen once at
+ * startup from the processor features reported by the port library; the scalar kernel is the fallback.
+ * @ingroup GC_Base
+ */
+class MM_MarkMapScan
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Find the first non-empty slot in [current, top).
+	 * @return the address of the first slot which is not zero, or top if all slots are zero
+	 */
+	typedef uintptr_t *(*FindNonEmptySlot)(uintptr_t *current, uintptr_t *top);
+
+	enum Kernel {
+		kernel_scalar = 0,
+		kernel_sse4,
+		kernel_avx2,
+		kernel_count
+	};
+
+private:
+	enum {
+		_probeSlots = 16 /**< slots tested inline before a kernel is called */
+	};
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Find the first non-empty slot in [current, top) with the given kernel. Most empty runs between live
+	 * objects are only a few slots long, so those are probed inline and only longer runs pay for the call.
+	 * @return the address of the first slot which is not zero, or top if all slots are zero
+	 */
+	static MMINLINE uintptr_t *
+	findNonEmptySlot(FindNonEmptySlot kernel, uintptr_t *current, uintptr_t *top)
+	{
+		uintptr_t *probeTop = ((uintptr_t)(top - current) > (uintptr_t)_probeSlots) ? (current + _probeSlots) : top;
+		while (current < probeTop) {
+			if (0 != *current) {
+				return current;
+			}
+			current += 1;
+		}
+		return (current < top) ? kernel(current, top) : top;
+	}
+
+	/**
+	 * Pick the widest kernel the processor and operating system support.
+	 * @param portLibrary the port library used to query processor features
+	 */
+	static Kernel selectKernel(OMRPortLibrary *portLibrary);
+
+	/**
+	 * @return the entry point of a kernel, or NULL if it is not available in this build
+	 */
+	static FindNonEmptySlot getKernel(Kernel kernel);
+
+	/**
+	 * @return a printable name for a kernel
+	 */
+	static const char *getKernelName(Kernel kernel);
+
+	static uintptr_t *findNonEmptySlotScalar(uintptr_t *current, uintptr_t *top);
+#if defined(OMR_GC_MARKMAP_SCAN_X86_SIMD)
+	static uintptr_t *findNonEmptySlotSSE4(uintptr_t *current, uintptr_t *top);
+	static uintptr_t *findNonEmptySlotAVX2(uintptr_t *current, uintptr_t *top);
+#endif /* OMR_GC_MARKMAP_SCAN_X86_SIMD */
+};
+
+#endif /* MARKMAPSCAN_HPP_ */
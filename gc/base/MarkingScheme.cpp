@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -198,6 +198,20 @@ void
 MM_MarkingScheme::mainCleanupAfterGC(MM_EnvironmentBase *env)
 {
 	_delegate.mainCleanupAfterGC(env);
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	_lastMarkedBytes = _extensions->globalGCStats.markStats._bytesScanned;
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+}
+
+uintptr_t
+MM_MarkingScheme::getEstimatedLiveBytes(MM_EnvironmentBase *env)
+{
+	uintptr_t liveBytes = _lastMarkedBytes;
+	if (0 == liveBytes) {
+		MM_Heap *heap = _extensions->heap;
+		liveBytes = heap->getActiveMemorySize() - heap->getApproximateActiveFreeMemorySize();
+	}
+	return liveBytes;
 }
 
 void
@@ -280,6 +294,8 @@ MM_MarkingScheme::numMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, vo
 uintptr_t
 MM_MarkingScheme::setMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop, bool clear)
 {
+	/* used to prepare the map for concurrent marking, after which nothing is known to be clear */
+	_markMap->invalidateCleanUnits();
 	return _markMap->setBitsInRange(env, heapBase, heapTop, clear);
 }
 
@@ -297,16 +313,10 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 	GC_ObjectScannerState objectScannerState;
 	GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
 	if (NULL != objectScanner) {
-		bool isLeafSlot = false;
-		GC_SlotObject *slotObject;
-#if defined(OMR_GC_LEAF_BITS)
-		while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
-#else /* OMR_GC_LEAF_BITS */
-		while (NULL != (slotObject = objectScanner->getNextSlot())) {
-#endif /* OMR_GC_LEAF_BITS */
-			fixupForwardedSlot(slotObject);
-
-			inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+		if (_extensions->compressObjectReferences()) {
+			markObjectSlots<true>(env, objectPtr, objectScanner, false);
+		} else {
+			markObjectSlots<false>(env, objectPtr, objectScanner, false);
 		}
 	}
 	return sizeToDo;
@@ -348,6 +358,8 @@ MM_MarkingScheme::markLiveObjectsInit(MM_EnvironmentBase *env, bool initMarkMap)
 	if(initMarkMap) {
 		_markMap->initializeMarkMap(env);
 		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		/* marking is about to set bits anywhere, the clear ranges are known again once sweep is done */
+		_markMap->invalidateCleanUnits();
 	}
 }
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -56,6 +56,12 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	uintptr_t _lastMarkedBytes; /**< Bytes scanned by the last completed mark, 0 until a mark completes */
+#if defined(OMR_GC_MODRON_COMPACTION)
+	uintptr_t _compactWindowBase; /**< Base of the area the pending incremental compaction will evacuate */
+	uintptr_t _compactWindowSize; /**< Size of that area, zero if no incremental compaction is pending */
+	uint8_t *_compactFixupCards; /**< One byte per fixup card of heap, set if an object starting in the card references the area */
+#endif /* OMR_GC_MODRON_COMPACTION */
 
 public:
 
@@ -76,6 +82,41 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Mark the objects referenced from the slots presented by an object scanner. The reference mode is
+	 * a template parameter so that the slot loop does not test it for every slot.
+	 *
+	 * @tparam compressed must be the value of compressObjectReferences()
+	 * @param[in] env calling thread environment
+	 * @param[in] objectPtr the object being scanned
+	 * @param[in] objectScanner the scanner presenting the slots of the object
+	 * @param[in] nullCheck true if a slot read after the scanner presented it may be NULL (mutator may NULL it in concurrent marking)
+	 */
+	template <bool compressed>
+	MMINLINE void
+	markObjectSlots(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, GC_ObjectScanner *objectScanner, bool nullCheck)
+	{
+		bool isLeafSlot = false;
+		GC_SlotObject *slotObject;
+#if defined(OMR_GC_LEAF_BITS)
+		while (NULL != (slotObject = objectScanner->getNextSlot<compressed>(&isLeafSlot))) {
+#else /* OMR_GC_LEAF_BITS */
+		while (NULL != (slotObject = objectScanner->getNextSlot<compressed>())) {
+#endif /* OMR_GC_LEAF_BITS */
+			fixupForwardedSlot(slotObject);
+
+			omrobjectptr_t referent = slotObject->readReferenceFromSlot<compressed>();
+#if defined(OMR_GC_MODRON_COMPACTION)
+			rememberCompactWindowReference(objectPtr, referent);
+#endif /* OMR_GC_MODRON_COMPACTION */
+			if (nullCheck) {
+				inlineMarkObject(env, referent, isLeafSlot);
+			} else {
+				inlineMarkObjectNoCheck(env, referent, isLeafSlot);
+			}
+		}
+	}
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -90,6 +131,12 @@ public:
 	void mainSetupForWalk(MM_EnvironmentBase *env);
 	void mainCleanupAfterGC(MM_EnvironmentBase *env);
 	void workerSetupForGC(MM_EnvironmentBase *env);
+
+	/**
+	 * Estimate the live bytes the next mark will trace: the bytes scanned by the last mark,
+	 * or the bytes in use if no mark has completed yet.
+	 */
+	uintptr_t getEstimatedLiveBytes(MM_EnvironmentBase *env);
 	void workerCleanupAfterGC(MM_EnvironmentBase *env);
 	void completeMarking(MM_EnvironmentBase *env);
 
@@ -236,17 +283,11 @@ public:
 		GC_ObjectScannerState objectScannerState;
 		GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, reason, &sizeToDo);
 		if (NULL != objectScanner) {
-			bool isLeafSlot = false;
-			GC_SlotObject *slotObject;
-#if defined(OMR_GC_LEAF_BITS)
-			while (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot))) {
-#else /* OMR_GC_LEAF_BITS */
-			while (NULL != (slotObject = objectScanner->getNextSlot())) {
-#endif /* OMR_GC_LEAF_BITS */
-				fixupForwardedSlot(slotObject);
-
-				/* with concurrentMark mutator may NULL the slot so must fetch and check here */
-				inlineMarkObject(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			/* with concurrentMark mutator may NULL the slot so must fetch and check here */
+			if (_extensions->compressObjectReferences()) {
+				markObjectSlots<true>(env, objectPtr, objectScanner, true);
+			} else {
+				markObjectSlots<false>(env, objectPtr, objectScanner, true);
 			}
 		}
 
@@ -297,6 +338,50 @@ public:
 	}
 	
 	void fixupForwardedSlotOutline(GC_SlotObject *slotObject);
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Remember that an object references the area the pending incremental compaction will evacuate, so that
+	 * compaction only has to fix up the objects in remembered cards instead of every live object in the heap.
+	 * Delegates which trace references without going through scanObject() must report them here too.
+	 * @param[in] objectPtr the object holding the reference
+	 * @param[in] referent the referenced object, may be NULL
+	 */
+	MMINLINE void
+	rememberCompactWindowReference(omrobjectptr_t objectPtr, omrobjectptr_t referent)
+	{
+		if (((uintptr_t)referent - _compactWindowBase) < _compactWindowSize) {
+			uint8_t *card = _compactFixupCards + (((uintptr_t)objectPtr - (uintptr_t)_heapBase) >> INCREMENTAL_COMPACT_FIXUP_CARD_SHIFT);
+			/* test first, the same cards are hit over and over by all GC threads */
+			if (0 == *card) {
+				*card = 1;
+			}
+		}
+	}
+
+	/**
+	 * Start remembering references into [base, top) during marking.
+	 * @param[in] fixupCards cleared card table covering the heap, one byte per fixup card
+	 */
+	void
+	setCompactWindow(void *base, void *top, uint8_t *fixupCards)
+	{
+		_compactFixupCards = fixupCards;
+		_compactWindowBase = (uintptr_t)base;
+		_compactWindowSize = (uintptr_t)top - (uintptr_t)base;
+	}
+
+	/**
+	 * Stop remembering references for incremental compaction.
+	 */
+	void
+	clearCompactWindow()
+	{
+		_compactWindowBase = 0;
+		_compactWindowSize = 0;
+		_compactFixupCards = NULL;
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 	virtual uintptr_t setupIndexableScanner(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_MarkingSchemeScanReason reason, uintptr_t *sizeToDo, uintptr_t *sizeInElementsToDo, fomrobject_t **basePtr, uintptr_t *flags);
 
 	/**
@@ -311,6 +396,12 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _lastMarkedBytes(0)
+#if defined(OMR_GC_MODRON_COMPACTION)
+		, _compactWindowBase(0)
+		, _compactWindowSize(0)
+		, _compactFixupCards(NULL)
+#endif /* OMR_GC_MODRON_COMPACTION */
 	{
 		_typeId = __FUNCTION__;
 	}
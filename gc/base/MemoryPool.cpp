@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -221,6 +221,7 @@ MM_MemoryPool::resetHeapStatistics(bool memoryPoolCollected)
 	_allocBytes = 0;
 	_allocDiscardedBytes = 0;
 	_allocSearchCount = 0;
+	_allocSizeIndexCount = 0;
 }
 
 /**
@@ -235,6 +236,7 @@ MM_MemoryPool::mergeHeapStats(MM_HeapStats *heapStats, bool active)
 	
 	heapStats->_allocDiscardedBytes += _allocDiscardedBytes;
 	heapStats->_allocSearchCount += _allocSearchCount;
+	heapStats->_allocSizeIndexCount += _allocSizeIndexCount;
 
 	if (active) {
 		heapStats->_activeFreeEntryCount += getActualFreeEntryCount();
@@ -414,7 +416,6 @@ MM_MemoryPool::addFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader*
 	Assert_MM_unreachable(); /* implementation required */
 }
 
-#if defined(OMR_GC_LARGE_OBJECT_AREA)
 /**
  * Remove  all free entries in a  specified range from pool and return them to caller 
  *  as an address ordered list.
@@ -438,6 +439,7 @@ MM_MemoryPool::removeFreeEntriesWithinRange(MM_EnvironmentBase *env, void *lowAd
 	return false;
 }
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
 /**
  * Determine the address in this memoryPool where there is at least sizeRequired free bytes in free entries.
  * The free entries must be of size minimumSize to be counted.
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -96,6 +96,7 @@ protected:
 	
 	uintptr_t _allocDiscardedBytes;
 	uintptr_t _allocSearchCount;
+	uintptr_t _allocSizeIndexCount; /**< Number of allocations whose free entry was found through the free list size index */
 
 	MM_GCExtensionsBase *_extensions; /**< GC Extensions for this JVM */
 	
@@ -275,11 +276,11 @@ public:
 	virtual void addFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader* &freeListHead, MM_HeapLinkedFreeHeader* &freeListTail,
 								uintptr_t freeMemoryCount, uintptr_t freeMemorySize);
 
-#if defined(OMR_GC_LARGE_OBJECT_AREA) 
 	virtual bool removeFreeEntriesWithinRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress,uintptr_t minimumSize,
 														 MM_HeapLinkedFreeHeader* &retListHead, MM_HeapLinkedFreeHeader* &retListTail,
 														 uintptr_t &retListMemoryCount, uintptr_t &retListMemorySize);
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA) 
 	virtual void *findAddressAfterFreeSize(MM_EnvironmentBase *env, uintptr_t sizeRequired, uintptr_t minimumSize);
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 											
@@ -448,6 +449,7 @@ public:
 		_lastFreeBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeIndexCount(0),
 		_extensions(env->getExtensions()),
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0),
@@ -482,6 +484,7 @@ public:
 		_lastFreeBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeIndexCount(0),
 		_extensions(env->getExtensions()),
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0),
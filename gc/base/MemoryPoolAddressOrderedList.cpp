@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -32,6 +32,7 @@
 #include "AllocateDescription.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
+#include "FreeEntrySizeIndex.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Collector.hpp"
 #include "MemoryPool.hpp"
@@ -157,6 +158,13 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	if (ext->freeListSizeIndex && !ext->isConcurrentSweepEnabled()) {
+		_freeEntrySizeIndex = MM_FreeEntrySizeIndex::newInstance(env, ext->freeListSizeIndexMinimumSize, compressObjectReferences());
+		if (NULL == _freeEntrySizeIndex) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -206,6 +214,11 @@ MM_MemoryPoolAddressOrderedList::tearDown(MM_EnvironmentBase *env)
 	
 	_largeObjectCollectorAllocateStats = NULL;
 
+	if (NULL != _freeEntrySizeIndex) {
+		_freeEntrySizeIndex->kill(env);
+		_freeEntrySizeIndex = NULL;
+	}
+
 	_heapLock.tearDown();
 	_resetLock.tearDown();
 }
@@ -433,6 +446,20 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 	}
 }
 
+bool
+MM_MemoryPoolAddressOrderedList::useFreeEntrySizeIndex(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired)
+{
+	/* Entries waiting for card alignment may still shrink, so the index is not used until they are aligned */
+	if ((NULL == _freeEntrySizeIndex) || (sizeInBytesRequired < _freeEntrySizeIndex->getMinimumSize()) || (FREE_ENTRY_END != _firstCardUnalignedFreeEntry)) {
+		return false;
+	}
+
+	if (!_freeEntrySizeIndexValid) {
+		_freeEntrySizeIndexValid = _freeEntrySizeIndex->rebuild(env, _heapFreeList);
+	}
+	return _freeEntrySizeIndexValid;
+}
+
 /****************************************
  * Allocation
  ****************************************
@@ -448,6 +475,7 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	J9ModronAllocateHint *allocateHintUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
+	bool sizeIndexUsed = false;
 	
 	if (lockingRequired) {
 		_heapLock.acquire();
@@ -462,12 +490,21 @@ retry:
 	walkCount = 0;
 	allocateHintUsed = NULL;
 	candidateHintSize = 0;
-
-	/* Large object - use a hint if it is available */
-	allocateHintUsed = findHint(sizeInBytesRequired);
-	if(allocateHintUsed) {
-		currentFreeEntry = allocateHintUsed->heapFreeHeader;
-		candidateHintSize = allocateHintUsed->size;
+	sizeIndexUsed = useFreeEntrySizeIndex(env, sizeInBytesRequired);
+
+	if (sizeIndexUsed) {
+		/* Start at the first entry that fits, where the walk below stops immediately */
+		currentFreeEntry = _freeEntrySizeIndex->findFirstFit(sizeInBytesRequired, &previousFreeEntry);
+		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry == ((NULL == previousFreeEntry) ? _heapFreeList : previousFreeEntry->getNext(compressed))));
+		/* Free entries that are not indexed are smaller than the index minimum size */
+		largestFreeEntry = OMR_MAX(_freeEntrySizeIndex->getLargestSize(), _freeEntrySizeIndex->getMinimumSize() - 1);
+	} else {
+		/* Large object - use a hint if it is available */
+		allocateHintUsed = findHint(sizeInBytesRequired);
+		if(allocateHintUsed) {
+			currentFreeEntry = allocateHintUsed->heapFreeHeader;
+			candidateHintSize = allocateHintUsed->size;
+		}
 	}
 
 
@@ -524,6 +561,9 @@ retry:
 	_allocCount += 1;
 	_allocBytes += sizeInBytesRequired;
 	_allocSearchCount += walkCount;
+	if (sizeIndexUsed) {
+		_allocSizeIndexCount += 1;
+	}
 
 	/* Determine what to do with the recycled portion of the free entry */
 	recycleEntrySize = currentFreeEntry->getSize() - sizeInBytesRequired;
@@ -535,6 +575,9 @@ retry:
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), recycleEntry);
 		updateHint(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+		if (_freeEntrySizeIndexValid) {
+			_freeEntrySizeIndex->entryAllocated(currentFreeEntry, sizeInBytesRequired + recycleEntrySize, recycleEntry, recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext(compressed));
+		}
 	} else {
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), previousFreeEntry);
 		/* Adjust the free memory size and count */
@@ -546,6 +589,9 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		if (_freeEntrySizeIndexValid) {
+			_freeEntrySizeIndex->entryAllocated(currentFreeEntry, sizeInBytesRequired + recycleEntrySize, NULL, 0, previousFreeEntry, currentFreeEntry->getNext(compressed));
+		}
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -708,6 +754,9 @@ retry:
 		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
 			updatePrevCardUnalignedFreeEntry(entryNext, (MM_HeapLinkedFreeHeader *)addrTop);
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+			if (_freeEntrySizeIndexValid) {
+				_freeEntrySizeIndex->entryAllocated(freeEntry, freeEntrySize, (MM_HeapLinkedFreeHeader *)addrTop, recycleEntrySize, NULL, entryNext);
+			}
 		} else {
 			updatePrevCardUnalignedFreeEntry(entryNext, FREE_ENTRY_END);
 			/* Adjust the free memory size and count */
@@ -715,6 +764,9 @@ retry:
 			_freeEntryCount -= 1;
 
 			_allocDiscardedBytes += recycleEntrySize;
+			if (_freeEntrySizeIndexValid) {
+				_freeEntrySizeIndex->entryAllocated(freeEntry, freeEntrySize, NULL, 0, NULL, entryNext);
+			}
 		}
 	} else {
 		updatePrevCardUnalignedFreeEntry(entryNext, FREE_ENTRY_END);
@@ -722,6 +774,9 @@ retry:
 		_heapFreeList = entryNext;
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
+		if (_freeEntrySizeIndexValid) {
+			_freeEntrySizeIndex->entryAllocated(freeEntry, freeEntrySize, NULL, 0, NULL, entryNext);
+		}
 	}
 
 	if (lockingRequired) {
@@ -762,6 +817,9 @@ MM_MemoryPoolAddressOrderedList::getConsumedSizeForTLH(MM_EnvironmentBase *env,
 
 			_heapFreeList = entryNext;
 			_freeEntryCount -= 1;
+			if (_freeEntrySizeIndexValid) {
+				_freeEntrySizeIndex->entryAllocated(freeEntry, freeEntrySize, NULL, 0, NULL, entryNext);
+			}
 
 			consumedSize = 0;
 		}
@@ -822,6 +880,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	invalidateFreeEntrySizeIndex();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
@@ -917,6 +976,8 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	invalidateFreeEntrySizeIndex();
+
 	/* Handle the entries that are too small to make the free list */
 	if(expandSize < _minimumFreeEntrySize) {
 		abandonHeapChunk(lowAddress, highAddress);
@@ -1029,6 +1090,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	invalidateFreeEntrySizeIndex();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1115,6 +1178,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 	bool const compressed = compressObjectReferences();
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	invalidateFreeEntrySizeIndex();
+
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
 	while (currentFreeEntry != NULL) {
@@ -1180,7 +1245,6 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 	_freeEntryCount += localFreeListMemoryCount;
 }
 
-#if defined(OMR_GC_LARGE_OBJECT_AREA)
 /**
  * Remove all free entries in a specified range from pool and return to caller
  * as an address ordered list.
@@ -1210,6 +1274,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	void *currentFreeEntryTop, *baseAddr, *topAddr;
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry, *nextFreeEntry, *tailFreeEntry;
 
+	invalidateFreeEntrySizeIndex();
+
 	retListHead = NULL;
 	retListTail = NULL;
 	retListMemoryCount = 0;
@@ -1362,6 +1428,7 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	return true;
 }
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
 /**
  * Determine the address in this memoryPool where there is at least sizeRequired free bytes in free entries.
  * The free entries must be of size minimumSize to be counted.
@@ -1587,6 +1654,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	invalidateFreeEntrySizeIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1639,6 +1708,7 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(MM_EnvironmentBase *env, void
 	void *top = chunkTop;
 	intptr_t freeEntryCount = 1;
 	_heapLock.acquire();
+	invalidateFreeEntrySizeIndex();
 
 	MM_HeapLinkedFreeHeader  *currentFreeEntry = _heapFreeList;
 	MM_HeapLinkedFreeHeader  *nextFreeEntry = NULL;
@@ -1860,6 +1930,8 @@ MM_MemoryPoolAddressOrderedList::doFreeEntryCardAlignmentUpTo(MM_EnvironmentBase
 
 	uintptr_t lostToAlignment = 0;
 
+	invalidateFreeEntrySizeIndex();
+
 	uintptr_t freeBytes = _freeMemorySize;
 	uintptr_t freeEntryCount = _freeEntryCount;
 	while ((currentFreeEntry <= lastFreeEntryToAlign) && (NULL != currentFreeEntry)) {
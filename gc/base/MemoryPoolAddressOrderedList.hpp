@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -35,6 +35,7 @@
 #include "AtomicOperations.hpp"
 
 class MM_AllocateDescription;
+class MM_FreeEntrySizeIndex;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -68,6 +69,9 @@ private:
 
 	void *_parallelGCAlignmentBase; /**< Base address of the region where the pool resides */
 	uintptr_t _parallelGCAlignmentSize; /**<  Fixed Size used to determine boundaries for alignment. */
+
+	MM_FreeEntrySizeIndex *_freeEntrySizeIndex; /**< Size index over the large free entries, NULL unless -Xgc:freeListSizeIndex is specified */
+	bool _freeEntrySizeIndexValid; /**< True if _freeEntrySizeIndex matches the free list; cleared by any free list change it does not track */
 protected:
 public:
 	
@@ -81,6 +85,18 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+	/**
+	 * Free list changes other than allocations make the size index stale. It is rebuilt on its next use.
+	 */
+	MMINLINE void invalidateFreeEntrySizeIndex() { _freeEntrySizeIndexValid = false; }
+
+	/**
+	 * Determine whether an allocation should find its free entry through the size index, rebuilding the index if it is stale.
+	 * Must be called with the pool lock held.
+	 * @return true if the size index can be used for an allocation of sizeInBytesRequired bytes
+	 */
+	bool useFreeEntrySizeIndex(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
+
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	uintptr_t getConsumedSizeForTLH(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t maximumSizeInBytesRequired);
@@ -141,10 +157,10 @@ public:
 	virtual void addFreeEntries(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader* &freeListHead, MM_HeapLinkedFreeHeader* &freeListTail,
 												uintptr_t freeListMemoryCount, uintptr_t freeListMemorySize);
 	
-#if defined(OMR_GC_LARGE_OBJECT_AREA)
 	virtual bool removeFreeEntriesWithinRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress,uintptr_t minimumSize,
 														 MM_HeapLinkedFreeHeader* &retListHead, MM_HeapLinkedFreeHeader* &retListTail,
 														 uintptr_t &retListMemoryCount, uintptr_t &retListMemorySize);
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
 	virtual void *findAddressAfterFreeSize(MM_EnvironmentBase *env, uintptr_t sizeRequired, uintptr_t minimumSize);
 #endif	
 	virtual void expandWithRange(MM_EnvironmentBase *env, uintptr_t expandSize, void *lowAddress, void *highAddress, bool canCoalesce);
@@ -205,6 +221,7 @@ public:
 		}else {
 			_heapFreeList = nextFreeEntry;
 		}
+		invalidateFreeEntrySizeIndex();
 	}
 
 	void fillWithHoles(void *addrBase, void *addrTop)
@@ -260,6 +277,8 @@ public:
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_parallelGCAlignmentBase(NULL)
 		,_parallelGCAlignmentSize(0)
+		,_freeEntrySizeIndex(NULL)
+		,_freeEntrySizeIndexValid(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -272,6 +291,8 @@ public:
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_parallelGCAlignmentBase(NULL)
 		,_parallelGCAlignmentSize(0)
+		,_freeEntrySizeIndex(NULL)
+		,_freeEntrySizeIndexValid(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -99,7 +99,6 @@ protected:
 	 */
 	virtual MM_HeapLinkedFreeHeader *getLastFreeEntry() { return _lastFreeEntry; }
 	
-#if defined(OMR_GC_LARGE_OBJECT_AREA)
 	/**
 	 * Append a free entry to an address ordered list
 	 *
@@ -167,8 +166,6 @@ protected:
 
 	}
 
-#endif /* OMR_GC_LARGE_OBJECT_AREA */
-
 	bool connectInnerMemoryToPool(MM_EnvironmentBase* env, void* address, uintptr_t size, void* previousFreeEntry);
 	void connectOuterMemoryToPool(MM_EnvironmentBase *env, void *address, uintptr_t size, void *nextFreeEntry);
 	void connectFinalMemoryToPool(MM_EnvironmentBase *env, void *address, uintptr_t size);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -48,5 +48,6 @@ void
 GC_OMRVMThreadInterface::flushCachesForGC(MM_EnvironmentBase *env)
 {
 	flushCachesForWalk(env);
+	env->_objectAllocationInterface->resizeCacheForGC(env);
 	flushNonAllocationCaches(env);
 }
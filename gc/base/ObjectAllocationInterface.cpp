@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -75,3 +75,15 @@ MM_ObjectAllocationInterface::restartCache(MM_EnvironmentBase *env)
 {
 	/* Do nothing */
 }
+
+/**
+ * Resize the cache for the next GC cycle from the allocation seen since the last GC.
+ * Called at GC start, once the cache has been flushed.
+ *
+ * @note The calling environment may not be the owning environment of the receiver.
+ */
+void
+MM_ObjectAllocationInterface::resizeCacheForGC(MM_EnvironmentBase *env)
+{
+	/* Do nothing */
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -127,6 +127,7 @@ public:
 
 	virtual void flushCache(MM_EnvironmentBase *env);
 	virtual void restartCache(MM_EnvironmentBase *env);
+	virtual void resizeCacheForGC(MM_EnvironmentBase *env);
 	
 	virtual void enableCachedAllocations(MM_EnvironmentBase* env) {};
 	virtual void disableCachedAllocations(MM_EnvironmentBase* env) {};
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2021 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -164,14 +164,17 @@ public:
 	virtual fomrobject_t *getNextSlotMap(uintptr_t *scanMap, bool *hasNextSlotMap) = 0;
 
 	/**
-	 * Get the next object slot if one is available.
+	 * Get the next object slot if one is available, for a reference mode fixed at compile time.
+	 * Scanning loops that instantiate this for both modes and pick one per object or per cycle do
+	 * not test the reference mode for each slot.
 	 *
+	 * @tparam compressed must be the value of compressObjectReferences()
 	 * @return a pointer to a slot object encapsulating the next object slot, or NULL if no next object slot
 	 */
+	template <bool compressed>
 	MMINLINE GC_SlotObject *
 	getNextSlot()
 	{
-		bool const compressed = compressObjectReferences();
 		while (NULL != _scanPtr) {
 			/* while there is at least one bit-mapped slot, advance scan ptr to a non-NULL slot or end of map */
 			while ((0 != _scanMap) && ((0 == (1 & _scanMap)) || (0 == GC_SlotObject::readSlot(_scanPtr, compressed)))) {
@@ -201,6 +204,17 @@ public:
 		return NULL;
 	}
 
+	/**
+	 * Get the next object slot if one is available.
+	 *
+	 * @return a pointer to a slot object encapsulating the next object slot, or NULL if no next object slot
+	 */
+	MMINLINE GC_SlotObject *
+	getNextSlot()
+	{
+		return compressObjectReferences() ? getNextSlot<true>() : getNextSlot<false>();
+	}
+
 	/**
 	 * The object scanner leaf optimization option is enabled by the OMR_GC_LEAF_BITS
 	 * flag in omrcfg.h.
@@ -235,15 +249,16 @@ public:
 	virtual fomrobject_t *getNextSlotMap(uintptr_t *scanMap, uintptr_t *leafMap, bool *hasNextSlotMap) = 0;
 
 	/**
-	 * Get the next object slot if one is available.
+	 * Get the next object slot if one is available, for a reference mode fixed at compile time.
 	 *
+	 * @tparam compressed must be the value of compressObjectReferences()
 	 * @param[out] *isLeafSlot will be true if the slot refers to a leaf object
 	 * @return a pointer to a slot object encapsulating the next object slot, or NULL if no next object slot
 	 */
+	template <bool compressed>
 	MMINLINE GC_SlotObject *
 	getNextSlot(bool* isLeafSlot)
 	{
-		bool const compressed = compressObjectReferences();
 		while (NULL != _scanPtr) {
 			/* while there is at least one bit-mapped slot, advance scan ptr to a non-NULL slot or end of map */
 			while ((0 != _scanMap) && ((0 == (1 & _scanMap)) || (0 == GC_SlotObject::readSlot(_scanPtr, compressed)))) {
@@ -277,6 +292,18 @@ public:
 		*isLeafSlot = true;
 		return NULL;
 	}
+
+	/**
+	 * Get the next object slot if one is available.
+	 *
+	 * @param[out] *isLeafSlot will be true if the slot refers to a leaf object
+	 * @return a pointer to a slot object encapsulating the next object slot, or NULL if no next object slot
+	 */
+	MMINLINE GC_SlotObject *
+	getNextSlot(bool* isLeafSlot)
+	{
+		return compressObjectReferences() ? getNextSlot<true>(isLeafSlot) : getNextSlot<false>(isLeafSlot);
+	}
 #endif /* defined(OMR_GC_LEAF_BITS) */
 
 	/**
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PACKETDEQUE_HPP_)
+#define PACKETDEQUE_HPP_
+
+#include "omr.h"
+#include "modronbase.h"
+#include <string.h>
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_Packet;
+
+/**
+ * Fixed capacity Chase-Lev work-stealing deque of non-empty work packets.
+ * The owning GC thread pushes and pops at the bottom, any other GC thread may steal from the top.
+ * A full deque rejects the push, and the caller falls back to the shared packet lists.
+ * @ingroup GC_Base
+ */
+class MM_PacketDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum {
+		_capacity = 128,
+		_indexMask = _capacity - 1
+	};
+
+private:
+	volatile uintptr_t _top; /**< index of the oldest packet, only advanced by CAS */
+	uint8_t _padding[64 - sizeof(uintptr_t)]; /**< keep thieves and the owner off the same cache line */
+	volatile uintptr_t _bottom; /**< index one past the newest packet, only written by the owner */
+	uintptr_t _victimSeed; /**< owner-private state for randomized victim selection */
+	MM_Packet *_slots[_capacity];
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Push a packet on the bottom of the deque. Owner only.
+	 * @return true if the packet was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		if ((intptr_t)(bottom - _top) >= (intptr_t)_capacity) {
+			return false;
+		}
+		_slots[bottom & _indexMask] = packet;
+		/* the slot must be visible before a thief can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the newest packet from the bottom of the deque. Owner only.
+	 * @return a packet, or NULL if the deque is empty or the last packet was stolen
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* publishing bottom must complete before top is read */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		intptr_t size = (intptr_t)(bottom - top);
+
+		if (size < 0) {
+			_bottom = top;
+			return NULL;
+		}
+
+		MM_Packet *packet = _slots[bottom & _indexMask];
+		if (0 == size) {
+			/* last packet - race against thieves for it */
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+			_bottom = top + 1;
+		}
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet from the top of the deque. Any thread other than the owner.
+	 * @return a packet, or NULL if the deque is empty or another thread won the race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+
+		if ((intptr_t)(bottom - top) <= 0) {
+			return NULL;
+		}
+
+		MM_Packet *packet = _slots[top & _indexMask];
+		if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+			return NULL;
+		}
+		return packet;
+	}
+
+	/**
+	 * @return true if the deque held no packets when sampled (racy, used as a hint only)
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	/**
+	 * Pick a pseudo-random victim index in [0, count). Owner only.
+	 */
+	MMINLINE uintptr_t
+	nextVictim(uintptr_t count)
+	{
+		/* xorshift - quality is irrelevant, only the spread of thieves across victims matters */
+		uintptr_t seed = _victimSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		_victimSeed = seed;
+		return seed % count;
+	}
+
+	/**
+	 * Initialize the deque to empty.
+	 * @param seed non-zero seed for victim selection, typically derived from the worker ID
+	 */
+	void
+	initialize(uintptr_t seed)
+	{
+		_top = 0;
+		_bottom = 0;
+		_victimSeed = (0 == seed) ? 1 : seed;
+		memset(_slots, 0, sizeof(_slots));
+	}
+
+	MM_PacketDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _victimSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PACKETDEQUE_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -30,13 +30,16 @@
 #include "omr.h"
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
+#include "mmprivatehook.h"
 
+#include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "Task.hpp"
+#include "TaskThreadCountModel.hpp"
 
 #include "ParallelDispatcher.hpp"
 
@@ -151,6 +154,7 @@ void
 MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env) 
 {
 	uintptr_t workerID = env->getWorkerID();
+	bool keepHot = false;
 	
 	setThreadInitializationComplete(env);
 	
@@ -163,6 +167,11 @@ MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env)
 				_threadsToReserve -= 1;
 				_statusTable[workerID] = worker_status_reserved;
 				_taskTable[workerID] = _task;
+			} else if (keepHot) {
+				keepHot = false;
+				omrthread_monitor_exit(_workerThreadMutex);
+				spinForNextTask(env);
+				omrthread_monitor_enter(_workerThreadMutex);
 			} else {
 				omrthread_monitor_wait(_workerThreadMutex);
 			}
@@ -188,11 +197,28 @@ MM_ParallelDispatcher::workerEntryPoint(MM_EnvironmentBase *env)
 			omrthread_monitor_enter(_workerThreadMutex);
 			/* Returned from task - do clean up work from dispatch */
 			completeTask(env);
+			keepHot = (0 != _extensions->dispatcherHotWindow);
 		}
 	}
 	omrthread_monitor_exit(_workerThreadMutex);	
 }
 
+void
+MM_ParallelDispatcher::spinForNextTask(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	volatile uintptr_t *status = &_statusTable[env->getWorkerID()];
+	uint64_t window = (_extensions->dispatcherHotWindow * omrtime_hires_frequency()) / 1000000;
+	uint64_t startTime = omrtime_hires_clock();
+
+	while ((worker_status_waiting == *status) && !_inShutdown && !(_workerThreadsReservedForGC && (_threadsToReserve > 0))) {
+		if ((omrtime_hires_clock() - startTime) > window) {
+			break;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+}
+
 void
 MM_ParallelDispatcher::mainEntryPoint(MM_EnvironmentBase *env)
 {
@@ -250,6 +276,11 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		_threadTable = NULL;
 	}
 
+	if (NULL != _taskThreadCountModel) {
+		_taskThreadCountModel->kill(env);
+		_taskThreadCountModel = NULL;
+	}
+
 	env->getForge()->free(this);
 }
 
@@ -286,6 +317,13 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if (_extensions->taskThreadCountModel) {
+		_taskThreadCountModel = MM_TaskThreadCountModel::newInstance(env);
+		if (NULL == _taskThreadCountModel) {
+			goto error_no_memory;
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -475,6 +513,19 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 		Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_useCollectorRecommendedThreads(task->getRecommendedWorkingThreads(), taskActiveThreadCount);
 	}
 
+	/* The task thread count model may further reduce the thread count, when the work of the task is too small
+	 * to pay for waking up all of the threads. Metronome sizes its threads per cycle, so it is left alone.
+	 */
+	_taskWorkSize = 0;
+	if ((NULL != _taskThreadCountModel) && !_extensions->isMetronomeGC()) {
+		_taskWorkSize = task->getEstimatedWorkSize(env);
+		_taskMaxThreadCount = taskActiveThreadCount;
+		if (0 != _taskWorkSize) {
+			taskActiveThreadCount = _taskThreadCountModel->recommendThreadCount(task->getVMStateID(), _taskWorkSize, taskActiveThreadCount);
+			_activeThreadCount = taskActiveThreadCount;
+		}
+	}
+
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
@@ -532,6 +583,11 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	/* Main thread doesn't need to be woken up */
 	Assert_MM_true(_threadsToReserve == 0);
 	_threadsToReserve = threadCount - 1;
+	if (0 != _taskWorkSize) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		_taskWakeupTime = 0;
+		_taskDispatchTime = omrtime_hires_clock();
+	}
 	wakeUpThreads(_threadsToReserve);
 
 	omrthread_monitor_exit(_workerThreadMutex);
@@ -546,6 +602,15 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 	_statusTable[workerID] = worker_status_active;
 	env->_currentTask = _taskTable[workerID];
 
+	if ((0 != _taskWorkSize) && !env->isMainThread()) {
+		/* Workers accept the task under _workerThreadMutex, so the wakeup time needs no atomic update */
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		uint64_t wakeupTime = omrtime_hires_clock() - _taskDispatchTime;
+		if (wakeupTime > _taskWakeupTime) {
+			_taskWakeupTime = wakeupTime;
+		}
+	}
+
 	env->_currentTask->accept(env);
 }
 
@@ -587,10 +652,39 @@ MM_ParallelDispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t new
 	acceptTask(env);
 	task->run(env);
 	completeTask(env);
+	if (0 != _taskWorkSize) {
+		recordTaskThreadCount(env, task, activeThreads);
+	}
 	cleanupAfterTask(env);
 	task->mainCleanup(env);
 }
 
+void
+MM_ParallelDispatcher::recordTaskThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t vmStateID = task->getVMStateID();
+	/* All threads have completed the task, so the wakeup time of every worker is in */
+	uint64_t durationMicros = omrtime_hires_delta(_taskDispatchTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t wakeupMicros = omrtime_hires_delta(0, _taskWakeupTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	_taskThreadCountModel->recordTask(vmStateID, _taskWorkSize, threadCount, durationMicros, wakeupMicros);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_TASK_THREAD_COUNT(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_TASK_THREAD_COUNT,
+		task->getBaseVirtualTypeId(),
+		_taskWorkSize,
+		threadCount,
+		_taskMaxThreadCount,
+		durationMicros,
+		_taskThreadCountModel->getWakeupCost(),
+		_taskThreadCountModel->getWorkRate(vmStateID)
+	);
+}
+
 /**
  * Return a value indicating the priority at which GC threads should be run.
  */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -39,6 +39,7 @@
 #include "GCExtensionsBase.hpp"
 
 class MM_EnvironmentBase;
+class MM_TaskThreadCountModel;
 
 class MM_ParallelDispatcher : public MM_BaseVirtual
 {
@@ -71,18 +72,24 @@ protected:
 	/* single mutex is sufficient */
 	omrthread_monitor_t _synchronizeMutex;
 	
-	bool _workerThreadsReservedForGC;  /**< States whether or not the worker threads are currently taking part in a GC */
-	bool _inShutdown;  /**< Shutdown request is received */
+	volatile bool _workerThreadsReservedForGC;  /**< States whether or not the worker threads are currently taking part in a GC */
+	volatile bool _inShutdown;  /**< Shutdown request is received */
 
 	uintptr_t _threadCountMaximum; /**< maximum threadcount - this is the size of the thread tables etc */
 	uintptr_t _threadCount; /**< number of threads currently forked */
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
-	uintptr_t _threadsToReserve; /**< Indicates number of threads remaining to dispatch tasks upon notify. Must be exactly 0 after tasks are dispatched. */
+	volatile uintptr_t _threadsToReserve; /**< Indicates number of threads remaining to dispatch tasks upon notify. Must be exactly 0 after tasks are dispatched. */
 
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
 
+	MM_TaskThreadCountModel *_taskThreadCountModel; /**< sizes the thread count of each task from its estimated work (NULL unless taskThreadCountModel is set) */
+	uintptr_t _taskWorkSize; /**< estimated work of the task being dispatched, 0 if the model does not apply to it */
+	uintptr_t _taskMaxThreadCount; /**< thread count the task being dispatched had before the model was applied */
+	uint64_t _taskDispatchTime; /**< hires time at which worker threads were woken up for the task */
+	uint64_t _taskWakeupTime; /**< hires ticks until the last worker thread accepted the task */
+
 public:
 
 	/*
@@ -108,6 +115,13 @@ protected:
 	
 	virtual void acceptTask(MM_EnvironmentBase *env);
 	virtual void completeTask(MM_EnvironmentBase *env);
+
+	/**
+	 * Keep a worker that just completed a task spinning for up to dispatcherHotWindow microseconds,
+	 * so that the next task of the same cycle is picked up without a park/unpark round trip.
+	 * Called with _workerThreadMutex released.
+	 */
+	void spinForNextTask(MM_EnvironmentBase *env);
 	virtual void wakeUpThreads(uintptr_t count);
 	
 	virtual uintptr_t recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount); 
@@ -115,6 +129,12 @@ protected:
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * Record a task that just completed in the task thread count model and report it.
+	 * @param threadCount the number of threads the task ran with
+	 */
+	void recordTaskThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount);
 	
 public:
 	virtual bool startUpThreads();
@@ -158,6 +178,11 @@ public:
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
+		,_taskThreadCountModel(NULL)
+		,_taskWorkSize(0)
+		,_taskMaxThreadCount(0)
+		,_taskDispatchTime(0)
+		,_taskWakeupTime(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -32,8 +32,10 @@
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -80,6 +82,47 @@ public:
 	}
 };
 
+/**
+ * Task walking the live objects of a snapshot of the heap regions, with an accumulator per thread.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelLiveObjectDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_ParallelHeapWalker *_heapWalker;
+	MM_HeapWalkerRegionSnapshot *_regions;
+	uintptr_t _regionCount;
+	MM_HeapWalkerObjectFunc _function;
+	void **_accumulators;
+	bool _useMarkMap;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelLiveObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerRegionSnapshot *regions, uintptr_t regionCount, MM_HeapWalkerObjectFunc function, void **accumulators, bool useMarkMap)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _heapWalker(heapWalker)
+		, _regions(regions)
+		, _regionCount(regionCount)
+		, _function(function)
+		, _accumulators(accumulators)
+		, _useMarkMap(useMarkMap)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -158,6 +201,149 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+uintptr_t
+MM_ParallelHeapWalker::getAccumulatorCount(MM_EnvironmentBase *env)
+{
+	return env->getExtensions()->dispatcher->threadCountMaximum();
+}
+
+/**
+ * Walk the live objects of the snapshot regions, sharing the work with the other threads of the task.
+ * With a valid mark map each region is split into chunks and only the marked objects of a chunk are
+ * visited. Otherwise each region is a unit of work and is parsed, which requires a walkable heap.
+ */
+void
+MM_ParallelHeapWalker::allLiveObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerRegionSnapshot *regions, uintptr_t regionCount, MM_HeapWalkerObjectFunc function, void **accumulators, bool useMarkMap)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	void *accumulator = accumulators[env->getWorkerID()];
+	uintptr_t objectsWalked = 0;
+	uintptr_t chunkSize = 0;
+
+	Trc_MM_ParallelHeapWalker_allLiveObjectsDoParallel_Entry(env->getLanguageVMThread(), regionCount, useMarkMap ? "true" : "false");
+
+	if (useMarkMap) {
+		/* aim for eight chunks per thread so that dense and sparse areas of the heap even out */
+		uintptr_t threadCount = env->_currentTask->getThreadCount();
+		chunkSize = extensions->heap->getMemorySize() / (threadCount * 8);
+		chunkSize = OMR_MAX(MM_Math::roundToCeiling(extensions->heapAlignment, chunkSize), extensions->heapAlignment);
+
+		MM_HeapMapIterator markedObjectIterator(extensions);
+		for (uintptr_t i = 0; i < regionCount; i++) {
+			uintptr_t *chunkBase = (uintptr_t *)regions[i].lowAddress;
+			uintptr_t *regionTop = (uintptr_t *)regions[i].highAddress;
+			while (chunkBase < regionTop) {
+				uintptr_t *chunkTop = regionTop;
+				if (((uintptr_t)regionTop - (uintptr_t)chunkBase) > chunkSize) {
+					chunkTop = (uintptr_t *)((uintptr_t)chunkBase + chunkSize);
+				}
+				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+					/* an object is visited by the chunk holding its header, wherever it ends */
+					markedObjectIterator.reset(_markMap, chunkBase, chunkTop);
+					omrobjectptr_t object = NULL;
+					while (NULL != (object = markedObjectIterator.nextObject())) {
+						function(omrVMThread, regions[i].region, object, accumulator);
+						objectsWalked += 1;
+					}
+				}
+				chunkBase = chunkTop;
+			}
+		}
+	} else {
+		for (uintptr_t i = 0; i < regionCount; i++) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, regions[i].region, regions[i].lowAddress, regions[i].highAddress);
+				omrobjectptr_t object = NULL;
+				while (NULL != (object = objectHeapIterator.nextObject())) {
+					function(omrVMThread, regions[i].region, object, accumulator);
+					objectsWalked += 1;
+				}
+			}
+		}
+	}
+
+	Trc_MM_ParallelHeapWalker_allLiveObjectsDoParallel_Exit(env->getLanguageVMThread(), chunkSize, objectsWalked);
+}
+
+/**
+ * Copy the extents of the regions of the walk, skipping the first skip of them, into at most maximum snapshots.
+ * The region manager is only locked while they are copied, never while they are walked.
+ * @return the number of regions copied, or of the regions after the skipped ones when regions is NULL
+ */
+uintptr_t
+MM_ParallelHeapWalker::snapshotRegions(MM_EnvironmentBase *env, uintptr_t walkFlags, uintptr_t skip, MM_HeapWalkerRegionSnapshot *regions, uintptr_t maximum)
+{
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heap->getHeapRegionManager();
+	uintptr_t regionCount = 0;
+	uintptr_t skipped = 0;
+
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	while ((regionCount < maximum) && (NULL != (region = regionIterator.nextRegion()))) {
+		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+			if (skipped < skip) {
+				skipped += 1;
+			} else {
+				if (NULL != regions) {
+					regions[regionCount].region = region;
+					regions[regionCount].lowAddress = region->getLowAddress();
+					regions[regionCount].highAddress = region->getHighAddress();
+				}
+				regionCount += 1;
+			}
+		}
+	}
+	regionManager->unlock();
+
+	return regionCount;
+}
+
+/**
+ * Walk through all live objects of the heap on the dispatcher threads with per-thread accumulators,
+ * then merge the accumulators on the calling thread.
+ */
+void
+MM_ParallelHeapWalker::allLiveObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void **accumulators, MM_HeapWalkerMergeFunc merge, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	/* SATB premarks whole TLHs, so its mark bits do not identify objects */
+	bool useMarkMap = _markMap->isMarkMapValid() && !extensions->usingSATBBarrier();
+
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	if (prepareHeapForWalk && !useMarkMap) {
+		_globalCollector->prepareHeapForWalk(env);
+	}
+
+	/* Regions can not come or go while the caller has exclusive access, so the workers can share a snapshot of them */
+	uintptr_t regionCount = snapshotRegions(env, walkFlags, 0, NULL, UDATA_MAX);
+	MM_HeapWalkerRegionSnapshot *regions = (MM_HeapWalkerRegionSnapshot *)env->getForge()->allocate(OMR_MAX(regionCount, 1) * sizeof(MM_HeapWalkerRegionSnapshot), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL != regions) {
+		regionCount = snapshotRegions(env, walkFlags, 0, regions, regionCount);
+
+		MM_ParallelLiveObjectDoTask liveObjectDoTask(env, this, regions, regionCount, function, accumulators, useMarkMap);
+		extensions->dispatcher->run(env, &liveObjectDoTask);
+
+		env->getForge()->free(regions);
+	} else {
+		/* No room for the snapshot: dispatch the regions one at a time */
+		MM_HeapWalkerRegionSnapshot snapshot;
+		for (uintptr_t walked = 0; 1 == snapshotRegions(env, walkFlags, walked, &snapshot, 1); walked++) {
+			MM_ParallelLiveObjectDoTask liveObjectDoTask(env, this, &snapshot, 1, function, accumulators, useMarkMap);
+			extensions->dispatcher->run(env, &liveObjectDoTask);
+		}
+	}
+
+	if (NULL != merge) {
+		OMR_VMThread *omrVMThread = env->getOmrVMThread();
+		uintptr_t accumulatorCount = getAccumulatorCount(env);
+		for (uintptr_t i = 0; i < accumulatorCount; i++) {
+			merge(omrVMThread, accumulators[i], userData);
+		}
+	}
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -166,3 +352,12 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+/**
+ * gets the heap walker and walks its share of the snapshot regions
+ */
+void
+MM_ParallelLiveObjectDoTask::run(MM_EnvironmentBase *env)
+{
+	_heapWalker->allLiveObjectsDoParallel(env, _regions, _regionCount, _function, _accumulators, _useMarkMap);
+}
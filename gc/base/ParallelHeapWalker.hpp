@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -29,9 +29,22 @@
 #include "HeapWalker.hpp"
 
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
+typedef void (*MM_HeapWalkerMergeFunc)(OMR_VMThread *, void *, void *);
+
+/**
+ * Extent of a heap region, captured before a parallel walk so that the walking threads
+ * do not have to iterate the region manager themselves.
+ */
+struct MM_HeapWalkerRegionSnapshot {
+	MM_HeapRegionDescriptor *region;
+	void *lowAddress;
+	void *highAddress;
+};
+
 class MM_ParallelHeapWalker : public MM_HeapWalker
 {
 	/*
@@ -47,6 +60,17 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Walk the live objects of the snapshot regions on the current dispatcher thread, passing the accumulator
+	 * of the thread to the provided function.
+	 */
+	void allLiveObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerRegionSnapshot *regions, uintptr_t regionCount, MM_HeapWalkerObjectFunc function, void **accumulators, bool useMarkMap);
+
+	/**
+	 * Copy the extents of the regions of a walk, skipping the first skip of them, into at most maximum snapshots
+	 * (or only count them if regions is NULL). The region manager is locked while they are copied.
+	 */
+	uintptr_t snapshotRegions(MM_EnvironmentBase *env, uintptr_t walkFlags, uintptr_t skip, MM_HeapWalkerRegionSnapshot *regions, uintptr_t maximum);
 protected:
 public:	
 	/**
@@ -61,6 +85,30 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk through all live objects of the heap on the dispatcher threads and apply the provided function.
+	 * Each thread passes its own accumulator, indexed by worker ID, to the function in place of the user data,
+	 * so that the function need not synchronize. Once the walk is done the merge function is called on the
+	 * calling thread for each accumulator, with the user data. When the mark map is valid only the marked
+	 * objects are visited and the heap is not parsed, so dead space is skipped without being walked.
+	 * The caller must have exclusive access, so that regions are not added or removed during the walk. The region
+	 * manager is only locked while the regions are snapshot, so the function may do anything that locks it.
+	 *
+	 * @param[in] env The environment for the calling thread.
+	 * @param[in] function Function applied to each live object
+	 * @param[in] accumulators Per-thread accumulators, getAccumulatorCount() entries
+	 * @param[in] merge Function merging each accumulator into the user data, may be NULL
+	 * @param[in] userData Data passed to the merge function
+	 * @param[in] walkFlags Type flags of the regions to walk
+	 * @param[in] prepareHeapForWalk Prepare the heap for walking if the mark map is not valid
+	 */
+	void allLiveObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void **accumulators, MM_HeapWalkerMergeFunc merge, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk);
+
+	/**
+	 * @return the number of per-thread accumulators required by allLiveObjectsDo()
+	 */
+	uintptr_t getAccumulatorCount(MM_EnvironmentBase *env);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -85,6 +133,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelLiveObjectDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -40,6 +40,12 @@ MM_ParallelMarkTask::getVMStateID()
 	return OMRVMSTATE_GC_MARK;
 }
 
+uintptr_t
+MM_ParallelMarkTask::getEstimatedWorkSize(MM_EnvironmentBase *env)
+{
+	return (MARK_ALL == _action) ? _markingScheme->getEstimatedLiveBytes(env) : 0;
+}
+
 void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -58,6 +58,12 @@ private:
 	
 public:
 	virtual uintptr_t getVMStateID();
+
+	/**
+	 * A full mark traces about the live bytes of the last mark; marking only the roots has no estimate.
+	 * @see MM_Task::getEstimatedWorkSize()
+	 */
+	virtual uintptr_t getEstimatedWorkSize(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
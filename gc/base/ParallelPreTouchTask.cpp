@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrgcconsts.h"
+
+#include "ParallelPreTouchTask.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "Math.hpp"
+
+void
+MM_ParallelPreTouchTask::touchRange(uintptr_t base, uintptr_t top, uintptr_t pageSize)
+{
+	uintptr_t address = base;
+	while (address < top) {
+		/* write back the current contents: the page is faulted in for writing without changing the heap */
+		volatile uintptr_t *slot = (volatile uintptr_t *)address;
+		*slot = *slot;
+		address = MM_Math::roundToFloor(pageSize, address) + pageSize;
+	}
+}
+
+void
+MM_ParallelPreTouchTask::run(MM_EnvironmentBase *env)
+{
+	uintptr_t pageSize = _heap->getPageSize();
+	uintptr_t bytesTouched = 0;
+
+	GC_HeapRegionIterator regionIterator(_heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (region->isCommitted()) {
+			uintptr_t chunkBase = (uintptr_t)region->getLowAddress();
+			uintptr_t regionTop = (uintptr_t)region->getHighAddress();
+			while (chunkBase < regionTop) {
+				uintptr_t chunkTop = OMR_MIN(MM_Math::roundToFloor(HEAP_PRETOUCH_CHUNK_SIZE, chunkBase) + HEAP_PRETOUCH_CHUNK_SIZE, regionTop);
+				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+					touchRange(chunkBase, chunkTop, pageSize);
+					bytesTouched += chunkTop - chunkBase;
+				}
+				chunkBase = chunkTop;
+			}
+		}
+	}
+
+	MM_AtomicOperations::add(&_bytesTouched, bytesTouched);
+}
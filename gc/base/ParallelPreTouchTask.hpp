@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(PARALLELPRETOUCHTASK_HPP_)
+#define PARALLELPRETOUCHTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+class MM_EnvironmentBase;
+class MM_Heap;
+class MM_ParallelDispatcher;
+
+/**
+ * Task faulting in the committed memory of the heap on the GC threads, so that the first
+ * mutator and GC accesses do not take the page faults one at a time.
+ * The heap is split into HEAP_PRETOUCH_CHUNK_SIZE aligned chunks, so that a transparent huge
+ * page is faulted in by a single thread.
+ * @note Pages are touched by writing back the word they start with, so the task may only run
+ * while no other thread modifies the heap (e.g. at startup).
+ * @ingroup GC_Base_Core
+ */
+class MM_ParallelPreTouchTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_Heap *_heap;
+	volatile uintptr_t _bytesTouched; /**< bytes of committed memory touched by all threads */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Touch the first word of every page in the range [base, top).
+	 */
+	void touchRange(uintptr_t base, uintptr_t top, uintptr_t pageSize);
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PRETOUCH_HEAP; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of bytes of committed memory touched by the task
+	 */
+	MMINLINE uintptr_t getBytesTouched() { return _bytesTouched; }
+
+	MM_ParallelPreTouchTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_Heap *heap)
+		: MM_ParallelTask(env, dispatcher)
+		, _heap(heap)
+		, _bytesTouched(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PARALLELPRETOUCHTASK_HPP_ */
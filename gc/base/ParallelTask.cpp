@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -76,6 +76,23 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	env->_lastSyncPointReached = id;
 	
 	if(1 < _totalThreadCount) {
+		uintptr_t spinCount = env->getExtensions()->gcThreadSyncSpinCount;
+		if (0 != spinCount) {
+			uintptr_t index = _synchronizeIndex;
+			checkSyncPointLockFree(env, id, "synchronizeGCThreads");
+			if (_threadCount == MM_AtomicOperations::add(&_synchronizeCount, 1)) {
+				/* Last to arrive - reset the sync point before the index moves, released threads may immediately arrive at the next one */
+				resetSyncPointLockFree();
+				_synchronizeCount = 0;
+				MM_AtomicOperations::writeBarrier();
+				_synchronizeIndex += 1;
+				notifyParkedThreads(env);
+			} else {
+				spinThenPark(env, spinCount, SYNC_WAIT_INDEX_CHANGED, index);
+			}
+			goto done;
+		}
+
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -106,6 +123,7 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 
 	}
 
+done:
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
 }
 
@@ -119,6 +137,26 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 
 	if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
+		uintptr_t spinCount = env->getExtensions()->gcThreadSyncSpinCount;
+
+		if (0 != spinCount) {
+			checkSyncPointLockFree(env, id, "synchronizeGCThreadsAndReleaseMain");
+			bool lastToArrive = (_threadCount == MM_AtomicOperations::add(&_synchronizeCount, 1));
+			if (env->isMainThread()) {
+				if (!lastToArrive) {
+					spinThenPark(env, spinCount, SYNC_WAIT_ALL_ARRIVED, index);
+				}
+				isMainThread = true;
+				_synchronized = true;
+			} else {
+				if (lastToArrive) {
+					/* the main thread may have parked waiting for the rest of the threads */
+					notifyParkedThreads(env);
+				}
+				spinThenPark(env, spinCount, SYNC_WAIT_INDEX_CHANGED, index);
+			}
+			goto done;
+		}
 
 		omrthread_monitor_enter(_synchronizeMutex);
 
@@ -175,6 +213,18 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
 		uintptr_t workUnitIndex = env->getWorkUnitIndex();
+		uintptr_t spinCount = env->getExtensions()->gcThreadSyncSpinCount;
+
+		if (0 != spinCount) {
+			checkSyncPointLockFree(env, id, "synchronizeGCThreadsAndReleaseSingleThread");
+			if (_threadCount == MM_AtomicOperations::add(&_synchronizeCount, 1)) {
+				isReleasedThread = true;
+				_synchronized = true;
+			} else {
+				spinThenPark(env, spinCount, SYNC_WAIT_INDEX_CHANGED, index);
+			}
+			goto done;
+		}
 
 		omrthread_monitor_enter(_synchronizeMutex);
 
@@ -230,6 +280,18 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	Assert_GC_true_with_message2(env, _synchronized, "%s at %p from releaseSynchronizedGCThreads: call for non-synchronized\n", getBaseVirtualTypeId(), this);
 	/* Could not have gotten here unless all other threads are sync'd - don't check, just release */
 	_synchronized = false;
+
+	if (0 != env->getExtensions()->gcThreadSyncSpinCount) {
+		resetSyncPointLockFree();
+		_synchronizeCount = 0;
+		MM_AtomicOperations::writeBarrier();
+		_synchronizeIndex += 1;
+		uint64_t notifyStartTime = omrtime_hires_clock();
+		notifyParkedThreads(env);
+		addToNotifyStallTime(env, notifyStartTime, omrtime_hires_clock());
+		return;
+	}
+
 	omrthread_monitor_enter(_synchronizeMutex);
 	_synchronizeCount = 0;
 	_synchronizeIndex += 1;
@@ -281,10 +343,24 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 		MM_Task::complete(env);
 	
 		if(env->isMainThread()) {
+			uintptr_t spinCount = env->getExtensions()->gcThreadSyncSpinCount;
+			if ((0 != spinCount) && (0 != _threadCount)) {
+				/* Workers finish close together - give them a chance to drain before parking on the monitor */
+				omrthread_monitor_exit(_synchronizeMutex);
+				for (uintptr_t spin = 0; (spin < spinCount) && (0 != _threadCount); spin++) {
+					MM_AtomicOperations::yieldCPU();
+				}
+				omrthread_monitor_enter(_synchronizeMutex);
+			}
 			/* Synchronization on exit - cannot delete the task object until all threads are done with it */
 			while(0 != _threadCount) {
 				omrthread_monitor_wait(_synchronizeMutex);
 			}
+			if (0 != spinCount) {
+				/* leave the task ready for the lock-free sync point checks should it be dispatched again */
+				_synchronizeCount = 0;
+				resetSyncPointLockFree();
+			}
 		} else {
 			if(0 == _threadCount) {
 				omrthread_monitor_notify_all(_synchronizeMutex);
@@ -294,6 +370,58 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_ParallelTask::checkSyncPointLockFree(MM_EnvironmentBase *env, const char *id, const char *caller)
+{
+	uintptr_t workUnitIndex = env->getWorkUnitIndex();
+	const char *syncPointUniqueId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointUniqueId, (uintptr_t)NULL, (uintptr_t)id);
+	uintptr_t syncPointWorkUnitIndex = MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointWorkUnitIndex, UDATA_MAX, workUnitIndex);
+
+	Assert_GC_true_with_message4(env, (NULL == syncPointUniqueId) || (syncPointUniqueId == id),
+		"%s for task %p: call from (%s), expected (%s)\n", caller, this, id, syncPointUniqueId);
+	Assert_GC_true_with_message4(env, (UDATA_MAX == syncPointWorkUnitIndex) || (syncPointWorkUnitIndex == workUnitIndex),
+		"%s for task %p: call with syncPointWorkUnitIndex %zu, expected %zu\n", caller, this, workUnitIndex, syncPointWorkUnitIndex);
+}
+
+void
+MM_ParallelTask::spinThenPark(MM_EnvironmentBase *env, uintptr_t spinCount, SyncWaitCondition condition, uintptr_t index)
+{
+	for (uintptr_t spin = 0; spin < spinCount; spin++) {
+		if (isSyncWaitConditionMet(condition, index)) {
+			/* pairs with the write barrier of the releasing thread */
+			MM_AtomicOperations::readBarrier();
+			addToSyncWaitCount(env, false);
+			return;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+	omrthread_monitor_enter(_synchronizeMutex);
+	MM_AtomicOperations::add(&_parkedThreadCount, 1);
+	/* The parked count must be visible before the condition is re-checked - see notifyParkedThreads() */
+	MM_AtomicOperations::readWriteBarrier();
+	while (!isSyncWaitConditionMet(condition, index)) {
+		omrthread_monitor_wait(_synchronizeMutex);
+	}
+	MM_AtomicOperations::subtract(&_parkedThreadCount, 1);
+	omrthread_monitor_exit(_synchronizeMutex);
+	addToSyncWaitCount(env, true);
+}
+
+void
+MM_ParallelTask::notifyParkedThreads(MM_EnvironmentBase *env)
+{
+	/* The released state must be visible before the parked count is read. A thread that parks after
+	 * this point is guaranteed to see the released state when it re-checks under the monitor.
+	 */
+	MM_AtomicOperations::readWriteBarrier();
+	if (0 != _parkedThreadCount) {
+		omrthread_monitor_enter(_synchronizeMutex);
+		omrthread_monitor_notify_all(_synchronizeMutex);
+		omrthread_monitor_exit(_synchronizeMutex);
+	}
+}
+
 /**
  * Return true if threads are currently syncronized, false otherwise
  * @return true if threads are currently syncronized, false otherwise
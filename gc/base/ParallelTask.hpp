@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -61,7 +61,16 @@ protected:
 	volatile uintptr_t _workUnitIndex;
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
+	volatile uintptr_t _parkedThreadCount; /**< Number of threads that gave up spinning on a synchronization point and wait on _synchronizeMutex (spin-then-park protocol only) */
 	omrthread_monitor_t _synchronizeMutex;
+
+	/**
+	 * Conditions a thread can wait for in the spin-then-park synchronization protocol
+	 */
+	enum SyncWaitCondition {
+		SYNC_WAIT_INDEX_CHANGED = 0, /**< the synchronize index moved past the value the thread arrived with */
+		SYNC_WAIT_ALL_ARRIVED /**< all threads of the task reached the synchronization point */
+	};
 public:
 	
 	/*
@@ -88,9 +97,50 @@ public:
 	}
 	MMINLINE virtual uintptr_t getThreadCount() { return _totalThreadCount; }
 	MMINLINE virtual void addToNotifyStallTime(MM_EnvironmentBase *env, uint64_t startTime, uint64_t endTime) {}
+	MMINLINE virtual void addToSyncWaitCount(MM_EnvironmentBase *env, bool parked) {}
 	
 	virtual bool isSynchronized();
 
+private:
+	MMINLINE bool
+	isSyncWaitConditionMet(SyncWaitCondition condition, uintptr_t index)
+	{
+		if (SYNC_WAIT_INDEX_CHANGED == condition) {
+			return index != _synchronizeIndex;
+		}
+		return _synchronizeCount == _threadCount;
+	}
+
+	/**
+	 * Spin on the condition for up to spinCount iterations, then park on _synchronizeMutex until it is met.
+	 * @param condition the condition to wait for
+	 * @param index the synchronize index the thread arrived with
+	 */
+	void spinThenPark(MM_EnvironmentBase *env, uintptr_t spinCount, SyncWaitCondition condition, uintptr_t index);
+
+	/**
+	 * Wake threads parked by spinThenPark(). Must be called after the state they wait on was published.
+	 */
+	void notifyParkedThreads(MM_EnvironmentBase *env);
+
+	/**
+	 * Check that all threads arriving at the current synchronization point agree on its identity.
+	 * The first thread to arrive publishes the id and work unit index with a CAS, later threads compare.
+	 */
+	void checkSyncPointLockFree(MM_EnvironmentBase *env, const char *id, const char *caller);
+
+	/**
+	 * Forget the identity of the current synchronization point before the threads are released from it.
+	 */
+	MMINLINE void
+	resetSyncPointLockFree()
+	{
+		_syncPointUniqueId = NULL;
+		_syncPointWorkUnitIndex = UDATA_MAX;
+	}
+
+public:
+
 	/**
 	 * Create a ParallelTask object.
 	 */
@@ -100,12 +150,13 @@ public:
 		,_syncCriticalSectionDuration(0)
 		,_synchronized(false)
 		,_syncPointUniqueId(NULL)
-		,_syncPointWorkUnitIndex(0)
+		,_syncPointWorkUnitIndex(UDATA_MAX)
 		,_totalThreadCount(0)
 		,_threadCount(0)
 		,_workUnitIndex(0)
 		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
+		,_parkedThreadCount(0)
 		,_synchronizeMutex(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -308,7 +308,7 @@ MM_PhysicalSubArenaVirtualMemoryFlat::contract(MM_EnvironmentBase *env, uintptr_
 	genericSubSpace->removeExistingMemory(env, this, contractSize, (void *)contractBase, (void *)contractTop);
 
 	/* Everything is ok - decommit the memory */
-	_heap->decommitMemory((void *)contractBase, contractSize, lowValidAddress, highValidAddress);
+	_heap->decommitRemovedMemory(env, (void *)contractBase, contractSize, lowValidAddress, highValidAddress);
 
 	/* Success - the area has been contracted.  Update internal values */
 	_highAddress = (void *)contractBase;
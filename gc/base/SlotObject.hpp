@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -137,14 +137,17 @@ public:
 	}
 
 	/**
-	 * Read reference from slot
+	 * Read reference from slot, for a reference mode fixed at compile time.
+	 * @see readReferenceFromSlot()
+	 * @tparam compressed true if object to object references are compressed, false if not
 	 * @return address of object slot reference to.
 	 */
+	template <bool compressed>
 	MMINLINE omrobjectptr_t readReferenceFromSlot()
 	{
 		omrobjectptr_t value = NULL;
 #if defined (OMR_GC_COMPRESSED_POINTERS)
-		if (compressObjectReferences()) {
+		if (compressed) {
 			value = (omrobjectptr_t)(((uintptr_t)*(uint32_t volatile *)_slot) << _compressedPointersShift);
 		} else
 #endif /* OMR_GC_COMPRESSED_POINTERS */
@@ -154,6 +157,15 @@ public:
 		return value;
 	}
 
+	/**
+	 * Read reference from slot
+	 * @return address of object slot reference to.
+	 */
+	MMINLINE omrobjectptr_t readReferenceFromSlot()
+	{
+		return compressObjectReferences() ? readReferenceFromSlot<true>() : readReferenceFromSlot<false>();
+	}
+
 	/**
 	 * Return slot address. This address must be used as read only
 	 * Created for compatibility with existing code
@@ -165,13 +177,16 @@ public:
 	}
 
 	/**
-	 * Write reference to slot if it was changed only.
+	 * Write reference to slot, for a reference mode fixed at compile time.
+	 * @see writeReferenceToSlot()
+	 * @tparam compressed true if object to object references are compressed, false if not
 	 * @param reference address of object should be written to slot
 	 */
+	template <bool compressed>
 	MMINLINE void writeReferenceToSlot(omrobjectptr_t reference)
 	{
 #if defined (OMR_GC_COMPRESSED_POINTERS)
-		if (compressObjectReferences()) {
+		if (compressed) {
 			*(uint32_t volatile *)_slot = (uint32_t)((uintptr_t)reference >> _compressedPointersShift);
 		} else
 #endif /* OMR_GC_COMPRESSED_POINTERS */
@@ -181,10 +196,25 @@ public:
 	}
 
 	/**
-	 * Atomically replace heap reference. It is accepted to fail - some other thread
-	 * might have raced us and put a more up to date value.
+	 * Write reference to slot if it was changed only.
+	 * @param reference address of object should be written to slot
+	 */
+	MMINLINE void writeReferenceToSlot(omrobjectptr_t reference)
+	{
+		if (compressObjectReferences()) {
+			writeReferenceToSlot<true>(reference);
+		} else {
+			writeReferenceToSlot<false>(reference);
+		}
+	}
+
+	/**
+	 * Atomically replace heap reference, for a reference mode fixed at compile time.
+	 * @see atomicWriteReferenceToSlot()
+	 * @tparam compressed true if object to object references are compressed, false if not
 	 * @return true if write succeeded
-	 */ 	
+	 */
+	template <bool compressed>
 	MMINLINE bool atomicWriteReferenceToSlot(omrobjectptr_t oldReference, omrobjectptr_t newReference)
 	{
 		/* Caller should ensure oldReference != newReference */
@@ -193,7 +223,7 @@ public:
 		bool swapResult = false;
 
 #if defined (OMR_GC_COMPRESSED_POINTERS)
-		if (compressObjectReferences()) {
+		if (compressed) {
 			uint32_t oldCompressed = (uint32_t)(oldValue >> _compressedPointersShift);
 			uint32_t newCompressed = (uint32_t)(newValue >> _compressedPointersShift);
 			swapResult = (oldCompressed == MM_AtomicOperations::lockCompareExchangeU32((uint32_t volatile *)_slot, oldCompressed, newCompressed));
@@ -206,6 +236,16 @@ public:
 		return swapResult;
 	}
 
+	/**
+	 * Atomically replace heap reference. It is accepted to fail - some other thread
+	 * might have raced us and put a more up to date value.
+	 * @return true if write succeeded
+	 */
+	MMINLINE bool atomicWriteReferenceToSlot(omrobjectptr_t oldReference, omrobjectptr_t newReference)
+	{
+		return compressObjectReferences() ? atomicWriteReferenceToSlot<true>(oldReference, newReference) : atomicWriteReferenceToSlot<false>(oldReference, newReference);
+	}
+
 	/**
 	 *	Update of slot address.
 	 *	Must be used by friends only for fast address replacement
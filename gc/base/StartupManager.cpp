@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2014, 2017 IBM Corp. and others
+ * Copyright (c) 2014, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -37,6 +37,10 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCCOMPACTINCREMENTAL "-Xgc:compactIncremental"
+#define OMR_XGCCOMPACTINCREMENTAL_LENGTH 23
+#define OMR_XGCCOMPACTPAUSEBUDGET "-Xgc:compactPauseBudget="
+#define OMR_XGCCOMPACTPAUSEBUDGET_LENGTH 24
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,8 +52,58 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCWORKPACKETDEQUES "-Xgc:workPacketDeques"
+#define OMR_XGCWORKPACKETDEQUES_LENGTH 21
+#define OMR_XGCSYNCSPINCOUNT "-Xgc:syncSpinCount="
+#define OMR_XGCSYNCSPINCOUNT_LENGTH 19
+#define OMR_XGCDISPATCHERHOTWINDOW "-Xgc:dispatcherHotWindow="
+#define OMR_XGCDISPATCHERHOTWINDOW_LENGTH 25
+#define OMR_XGCTASKTHREADCOUNTMODEL "-Xgc:taskThreadCountModel"
+#define OMR_XGCTASKTHREADCOUNTMODEL_LENGTH 25
+#define OMR_XGCTRANSPARENTHUGEPAGES "-Xgc:transparentHugePages"
+#define OMR_XGCTRANSPARENTHUGEPAGES_LENGTH 25
+#define OMR_XGCPRETOUCHHEAP "-Xgc:preTouchHeap"
+#define OMR_XGCPRETOUCHHEAP_LENGTH 17
+#define OMR_XGCDEFERREDHEAPUNCOMMIT "-Xgc:deferredHeapUncommit"
+#define OMR_XGCDEFERREDHEAPUNCOMMIT_LENGTH 25
+#define OMR_XGCHEAPUNCOMMITRATE "-Xgc:heapUncommitRate="
+#define OMR_XGCHEAPUNCOMMITRATE_LENGTH 22
+#define OMR_XGCSCAVENGERNUMAAWARE "-Xgc:scavengerNumaAware"
+#define OMR_XGCSCAVENGERNUMAAWARE_LENGTH 23
+#define OMR_XGCSCAVENGERLEARNHOTFIELDS "-Xgc:scavengerLearnHotFields"
+#define OMR_XGCSCAVENGERLEARNHOTFIELDS_LENGTH 28
+#define OMR_XGCSCAVENGERREMEMBEREDSETPREFETCHDISTANCE "-Xgc:scavengerRememberedSetPrefetchDistance="
+#define OMR_XGCSCAVENGERREMEMBEREDSETPREFETCHDISTANCE_LENGTH 44
+#define OMR_XGCTLHADAPTIVESIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLHADAPTIVESIZING_LENGTH 22
+#define OMR_XGCTLHADAPTIVEREFRESHESPERCYCLE "-Xgc:tlhAdaptiveRefreshesPerCycle="
+#define OMR_XGCTLHADAPTIVEREFRESHESPERCYCLE_LENGTH 34
+#define OMR_XGCFREELISTSIZEINDEX "-Xgc:freeListSizeIndex"
+#define OMR_XGCFREELISTSIZEINDEX_LENGTH 22
+#define OMR_XGCFREELISTSIZEINDEXMINIMUMSIZE "-Xgc:freeListSizeIndexMinimumSize="
+#define OMR_XGCFREELISTSIZEINDEXMINIMUMSIZE_LENGTH 34
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCPARTITIONEDFINALCARDCLEANING "-Xgc:partitionedFinalCardCleaning"
+#define OMR_XGCPARTITIONEDFINALCARDCLEANING_LENGTH 33
+#define OMR_XGCCONCURRENTPACING "-Xgc:concurrentPacing"
+#define OMR_XGCCONCURRENTPACING_LENGTH 21
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCSEGREGATEDREGIONREFILLBATCH "-Xgc:segregatedRegionRefillBatch="
+#define OMR_XGCSEGREGATEDREGIONREFILLBATCH_LENGTH 33
+#define OMR_XGCSEGREGATEDGENERATIONAL "-Xgc:segregatedGenerational"
+#define OMR_XGCSEGREGATEDGENERATIONAL_LENGTH 27
+#define OMR_XGCSEGREGATEDMINORCOLLECTIONSPERGLOBAL "-Xgc:segregatedMinorCollectionsPerGlobal="
+#define OMR_XGCSEGREGATEDMINORCOLLECTIONSPERGLOBAL_LENGTH 41
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +318,16 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACTINCREMENTAL, OMR_XGCCOMPACTINCREMENTAL_LENGTH)) {
+		/* compaction is disabled by default, incremental compaction opts back in to it */
+		extensions->noCompactOnGlobalGC = 0;
+		extensions->compactIncremental = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACTPAUSEBUDGET, OMR_XGCCOMPACTPAUSEBUDGET_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCCOMPACTPAUSEBUDGET_LENGTH, &extensions->compactPauseBudget)) {
+			result = false;
+		}
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +340,108 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	/* must precede OMR_XGCASYNC_LOGGING, which is a prefix of it */
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &extensions->asyncLoggingBufferSize)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKPACKETDEQUES, OMR_XGCWORKPACKETDEQUES_LENGTH)) {
+		extensions->workPacketDeques = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSYNCSPINCOUNT, OMR_XGCSYNCSPINCOUNT_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSYNCSPINCOUNT_LENGTH, &extensions->gcThreadSyncSpinCount)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCDISPATCHERHOTWINDOW, OMR_XGCDISPATCHERHOTWINDOW_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCDISPATCHERHOTWINDOW_LENGTH, &extensions->dispatcherHotWindow)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCTASKTHREADCOUNTMODEL, OMR_XGCTASKTHREADCOUNTMODEL_LENGTH)) {
+		extensions->taskThreadCountModel = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTRANSPARENTHUGEPAGES, OMR_XGCTRANSPARENTHUGEPAGES_LENGTH)) {
+		extensions->transparentHugePages = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCPRETOUCHHEAP, OMR_XGCPRETOUCHHEAP_LENGTH)) {
+		extensions->preTouchHeap = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCDEFERREDHEAPUNCOMMIT, OMR_XGCDEFERREDHEAPUNCOMMIT_LENGTH)) {
+		extensions->deferredHeapUncommit = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAPUNCOMMITRATE, OMR_XGCHEAPUNCOMMITRATE_LENGTH)) {
+		if (!getUDATAMemoryValue(option + OMR_XGCHEAPUNCOMMITRATE_LENGTH, &extensions->heapUncommitRate)) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHADAPTIVESIZING, OMR_XGCTLHADAPTIVESIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTLHADAPTIVEREFRESHESPERCYCLE, OMR_XGCTLHADAPTIVEREFRESHESPERCYCLE_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCTLHADAPTIVEREFRESHESPERCYCLE_LENGTH, &extensions->tlhAdaptiveRefreshesPerCycle))
+			|| (0 == extensions->tlhAdaptiveRefreshesPerCycle)
+		) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCFREELISTSIZEINDEXMINIMUMSIZE, OMR_XGCFREELISTSIZEINDEXMINIMUMSIZE_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCFREELISTSIZEINDEXMINIMUMSIZE_LENGTH, &extensions->freeListSizeIndexMinimumSize))
+			|| (0 == extensions->freeListSizeIndexMinimumSize)
+		) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCFREELISTSIZEINDEX, OMR_XGCFREELISTSIZEINDEX_LENGTH)) {
+		extensions->freeListSizeIndex = true;
+	}
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCPARTITIONEDFINALCARDCLEANING, OMR_XGCPARTITIONEDFINALCARDCLEANING_LENGTH)) {
+		extensions->partitionedFinalCardCleaning = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTPACING, OMR_XGCCONCURRENTPACING_LENGTH)) {
+		extensions->concurrentPacing = true;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERNUMAAWARE, OMR_XGCSCAVENGERNUMAAWARE_LENGTH)) {
+		extensions->scavengerNumaAware = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERLEARNHOTFIELDS, OMR_XGCSCAVENGERLEARNHOTFIELDS_LENGTH)) {
+		extensions->scavengerLearnHotFields = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGERREMEMBEREDSETPREFETCHDISTANCE, OMR_XGCSCAVENGERREMEMBEREDSETPREFETCHDISTANCE_LENGTH)) {
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGERREMEMBEREDSETPREFETCHDISTANCE_LENGTH, &extensions->scavengerRememberedSetPrefetchDistance)) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCSEGREGATEDREGIONREFILLBATCH, OMR_XGCSEGREGATEDREGIONREFILLBATCH_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSEGREGATEDREGIONREFILLBATCH_LENGTH, &extensions->segregatedRegionRefillBatch))
+			|| (0 == extensions->segregatedRegionRefillBatch)
+		) {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATEDGENERATIONAL, OMR_XGCSEGREGATEDGENERATIONAL_LENGTH)) {
+		extensions->segregatedGenerational = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATEDMINORCOLLECTIONSPERGLOBAL, OMR_XGCSEGREGATEDMINORCOLLECTIONSPERGLOBAL_LENGTH)) {
+		if ((0 >= getUDATAValue(option + OMR_XGCSEGREGATEDMINORCOLLECTIONSPERGLOBAL_LENGTH, &extensions->segregatedMinorCollectionsPerGlobal))
+			|| (0 == extensions->segregatedMinorCollectionsPerGlobal)
+		) {
+			result = false;
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -288,15 +288,17 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
-	extensions->allocationStats.merge(&_stats);
-	_stats.clear();
-	/* Since AllocationStats have been reset, reset the base as well*/
-	_bytesAllocatedBase = 0;
 	_tlhAllocationSupport.flushCache(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	/* Merge after flushing, so the bytes left unused in the flushed TLHs are accounted for */
+	extensions->allocationStats.merge(&_stats);
+	_stats.clear();
+	/* Since AllocationStats have been reset, reset the base as well*/
+	_bytesAllocatedBase = 0;
 }
 
 void
@@ -309,4 +311,16 @@ MM_TLHAllocationInterface::restartCache(MM_EnvironmentBase *env)
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 }
 
+void
+MM_TLHAllocationInterface::resizeCacheForGC(MM_EnvironmentBase *env)
+{
+	if (env->getExtensions()->tlhAdaptiveSizing) {
+		_tlhAllocationSupport.resizeForGC(env);
+
+#if defined(OMR_GC_NON_ZERO_TLH)
+		_tlhAllocationSupportNonZero.resizeForGC(env);
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+	}
+}
+
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -38,6 +38,7 @@
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
 #include "AllocationStats.hpp"
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -110,7 +111,43 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* Already sized from the allocation rate at GC start */
+		_tlh->refreshSize = refreshSize;
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+}
+
+void
+MM_TLHAllocationSupport::resizeForGC(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	if (_resizeEpoch == extensions->gcExclusiveAccessReleaseCount) {
+		/* Already resized in this GC, the thread has not run since */
+		return;
+	}
+	_resizeEpoch = extensions->gcExclusiveAccessReleaseCount;
+
+	uintptr_t bytesUsed = _bytesUsedSinceGC;
+	uintptr_t refreshSize = extensions->tlhInitialSize;
+	_bytesUsedSinceGC = 0;
+	/* Average over two cycles, so a short cycle (an explicit GC, say) does not collapse the size on its own */
+	_averageBytesUsedPerGC = (_averageBytesUsedPerGC + bytesUsed) / 2;
+
+	if (bytesUsed < getRefreshSize()) {
+		/* The thread did not fill even one TLH since the last GC - stop it from pinning a large one */
+		if (refreshSize < getRefreshSize()) {
+			/* several threads may be resized at once when the caches are flushed in parallel */
+			MM_AtomicOperations::add(&extensions->allocationStats._tlhIdleTrimCount, 1);
+		}
+	} else {
+		uintptr_t targetSize = MM_Math::roundToCeiling(extensions->tlhIncrementSize, _averageBytesUsedPerGC / extensions->tlhAdaptiveRefreshesPerCycle);
+		refreshSize = OMR_MIN(OMR_MAX(targetSize, refreshSize), extensions->tlhMaximumSize);
+	}
+
+	setRefreshSize(refreshSize);
 }
 
 bool
@@ -146,6 +183,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	stats->_tlhDiscardedBytes += getRemainingSize();
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
+	_bytesUsedSinceGC += usedSize;
+	/* a TLH retired with at most a quarter of it left was mostly consumed */
+	bool exhausted = (getRemainingSize() <= ((usedSize + getRemainingSize()) >> 2));
 
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
@@ -257,7 +297,15 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
 			if (getRefreshSize() < tlhMaximumSize) {
-				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				if (!extensions->tlhAdaptiveSizing) {
+					setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
+				} else if (exhausted) {
+					/* A thread that keeps filling its TLHs ramps up geometrically rather than by increments,
+					 * and one retiring TLHs with space left does not grow further. Idle threads are trimmed at GC start.
+					 */
+					uintptr_t growth = OMR_MAX(getRefreshSize(), extensions->tlhIncrementSize);
+					setRefreshSize(OMR_MIN(getRefreshSize() + growth, tlhMaximumSize));
+				}
 			}
 			reserveTLHTopForGC(env);
 		}
@@ -324,6 +372,15 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 		env->getExtensions()->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+	if (NULL != getRealTop()) {
+		stats->_tlhFlushedBytes += getRemainingSize();
+	}
+	for (MM_HeapLinkedFreeHeaderTLH *cached = _abandonedList; NULL != cached; cached = (MM_HeapLinkedFreeHeaderTLH *)cached->getNext(env->compressObjectReferences())) {
+		stats->_tlhFlushedBytes += cached->getSize();
+	}
+	_bytesUsedSinceGC += getUsedSize();
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -84,6 +84,9 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+	uintptr_t _bytesUsedSinceGC; /**< Bytes used in TLHs retired since the last GC start */
+	uintptr_t _averageBytesUsedPerGC; /**< Running average of _bytesUsedSinceGC over GC cycles; the thread's allocation rate for adaptive sizing */
+	uintptr_t _resizeEpoch; /**< Value of gcExclusiveAccessReleaseCount when the TLH was last resized, so caches flushed repeatedly within one GC are resized once */
 public:
 protected:
 private:
@@ -183,6 +186,15 @@ private:
 	 */
 	void restart(MM_EnvironmentBase *env);
 
+	/**
+	 * Size the TLH for the next GC cycle from the bytes the thread used in TLHs per GC cycle, so that
+	 * it would take about tlhAdaptiveRefreshesPerCycle refreshes to allocate as much again. Threads that
+	 * used less than a TLH worth since the last GC are idle, and fall back to the initial refresh size.
+	 *
+	 * @note The TLH is expected to have been flushed.
+	 */
+	void resizeForGC(MM_EnvironmentBase *env);
+
 	/**
 	 * Reserve part (top) of TLH for GC if collector requires
 	 */
@@ -251,7 +263,10 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_bytesUsedSinceGC(0),
+		_averageBytesUsedPerGC(0),
+		_resizeEpoch(UDATA_MAX)
 	{};
 
 	/*
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -67,6 +67,14 @@ public:
 
 	virtual uintptr_t getRecommendedWorkingThreads() { return UDATA_MAX; }
 
+	/**
+	 * Estimate the work this task is about to do, for the dispatcher to size its thread count.
+	 * The unit is task specific (live bytes, cards, copied bytes ...) but must be consistent across
+	 * dispatches of the same task, since the dispatcher learns a work rate for each task.
+	 * @return the estimated work, or 0 if the task has no estimate
+	 */
+	virtual uintptr_t getEstimatedWorkSize(MM_EnvironmentBase *env) { return 0; }
+
 	/**
 	 * Single call setup routine for tasks invoked by the main thread before the task is dispatched.
 	 */
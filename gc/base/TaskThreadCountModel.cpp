@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#include <math.h>
+
+#include "omrcfg.h"
+
+#include "TaskThreadCountModel.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "Math.hpp"
+
+/* Weight of the history when folding a new measurement into a smoothed rate or cost */
+#define TASK_THREAD_COUNT_MODEL_HISTORY_WEIGHT 0.7f
+
+MM_TaskThreadCountModel *
+MM_TaskThreadCountModel::newInstance(MM_EnvironmentBase *env)
+{
+	MM_TaskThreadCountModel *model = (MM_TaskThreadCountModel *)env->getForge()->allocate(sizeof(MM_TaskThreadCountModel), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != model) {
+		new(model) MM_TaskThreadCountModel();
+	}
+	return model;
+}
+
+void
+MM_TaskThreadCountModel::kill(MM_EnvironmentBase *env)
+{
+	env->getForge()->free(this);
+}
+
+MM_TaskThreadCountModel::TaskEntry *
+MM_TaskThreadCountModel::findEntry(uintptr_t vmStateID, bool create)
+{
+	for (uintptr_t i = 0; i < _entryCount; i++) {
+		if (vmStateID == _entries[i].vmStateID) {
+			return &_entries[i];
+		}
+	}
+
+	TaskEntry *entry = NULL;
+	if (create && (_entryCount < TASK_THREAD_COUNT_MODEL_MAX_TASKS)) {
+		entry = &_entries[_entryCount];
+		entry->vmStateID = vmStateID;
+		entry->workRate = 0.0f;
+		_entryCount += 1;
+	}
+	return entry;
+}
+
+uintptr_t
+MM_TaskThreadCountModel::recommendThreadCount(uintptr_t vmStateID, uintptr_t workSize, uintptr_t maxThreadCount)
+{
+	TaskEntry *entry = findEntry(vmStateID, false);
+	if ((NULL == entry) || (0.0f >= entry->workRate) || (0.0f >= _wakeupCost) || (0 == workSize)) {
+		return maxThreadCount;
+	}
+
+	/* Thread count minimizing W / (r * n) + c * n */
+	float optimalThreads = sqrtf((float)workSize / (entry->workRate * _wakeupCost));
+	uintptr_t threadCount = maxThreadCount;
+	if (optimalThreads < (float)maxThreadCount) {
+		threadCount = OMR_MAX((uintptr_t)1, (uintptr_t)(optimalThreads + 0.5f));
+	}
+	return threadCount;
+}
+
+void
+MM_TaskThreadCountModel::recordTask(uintptr_t vmStateID, uintptr_t workSize, uintptr_t threadCount, uint64_t durationMicros, uint64_t wakeupMicros)
+{
+	if (threadCount > 1) {
+		/* Workers are woken one after another, so the last one to start carries the cost of all of them */
+		float wakeupCost = (float)wakeupMicros / (float)(threadCount - 1);
+		if (0.0f >= _wakeupCost) {
+			_wakeupCost = wakeupCost;
+		} else {
+			_wakeupCost = MM_Math::weightedAverage(_wakeupCost, wakeupCost, TASK_THREAD_COUNT_MODEL_HISTORY_WEIGHT);
+		}
+	}
+
+	TaskEntry *entry = findEntry(vmStateID, true);
+	if ((NULL != entry) && (0 != workSize)) {
+		/* Time spent waiting for the workers to start is not work */
+		uint64_t busyMicros = OMR_MAX((uint64_t)1, (durationMicros > wakeupMicros) ? (durationMicros - wakeupMicros) : 0);
+		float workRate = (float)workSize / ((float)busyMicros * (float)threadCount);
+		if (0.0f >= entry->workRate) {
+			entry->workRate = workRate;
+		} else {
+			entry->workRate = MM_Math::weightedAverage(entry->workRate, workRate, TASK_THREAD_COUNT_MODEL_HISTORY_WEIGHT);
+		}
+	}
+}
+
+float
+MM_TaskThreadCountModel::getWorkRate(uintptr_t vmStateID)
+{
+	TaskEntry *entry = findEntry(vmStateID, false);
+	return (NULL == entry) ? 0.0f : entry->workRate;
+}
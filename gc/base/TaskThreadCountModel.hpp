@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(TASKTHREADCOUNTMODEL_HPP_)
+#define TASKTHREADCOUNTMODEL_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/* Number of distinct tasks (by VM state) the model keeps a work rate for */
+#define TASK_THREAD_COUNT_MODEL_MAX_TASKS 32
+
+/**
+ * Per task model of how many GC threads are worth waking up.
+ *
+ * Each dispatched task reports an estimate of its work (in task specific units: live bytes, cards,
+ * copied bytes ...). After the task completes the dispatcher records how long it took with how many
+ * threads, and how long the last worker took to pick it up. From this the model keeps, per task,
+ * the work done by one thread per microsecond, and globally, the cost in microseconds that each
+ * additional thread adds to waking up the task.
+ *
+ * With a work rate r and a wakeup cost c, a task of work W run by n threads takes about
+ * W / (r * n) + c * n, which is minimal for n = sqrt(W / (r * c)). Until a task has been measured
+ * (or while no wakeup cost is known) the model recommends the maximum thread count.
+ * @ingroup GC_Base_Core
+ */
+class MM_TaskThreadCountModel : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	struct TaskEntry {
+		uintptr_t vmStateID; /**< VM state of the task, identifies the task across dispatches */
+		float workRate; /**< Smoothed work units completed by one thread per microsecond */
+	};
+
+	TaskEntry _entries[TASK_THREAD_COUNT_MODEL_MAX_TASKS];
+	uintptr_t _entryCount; /**< Number of entries in use */
+	float _wakeupCost; /**< Smoothed microseconds each additional thread adds before all threads run the task, 0 until measured */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	TaskEntry *findEntry(uintptr_t vmStateID, bool create);
+protected:
+public:
+	static MM_TaskThreadCountModel *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Recommend the number of threads to run a task with.
+	 * @param vmStateID the VM state of the task
+	 * @param workSize the estimated work of the task, in the task's own units
+	 * @param maxThreadCount the number of threads the task could run with
+	 * @return a thread count in [1, maxThreadCount]
+	 */
+	uintptr_t recommendThreadCount(uintptr_t vmStateID, uintptr_t workSize, uintptr_t maxThreadCount);
+
+	/**
+	 * Record a completed task.
+	 * @param vmStateID the VM state of the task
+	 * @param workSize the estimated work of the task, in the task's own units
+	 * @param threadCount the number of threads the task ran with
+	 * @param durationMicros time from waking up the threads until all of them completed the task
+	 * @param wakeupMicros time from waking up the threads until the last one accepted the task
+	 */
+	void recordTask(uintptr_t vmStateID, uintptr_t workSize, uintptr_t threadCount, uint64_t durationMicros, uint64_t wakeupMicros);
+
+	/**
+	 * @return the smoothed work units per thread per microsecond of a task, 0 if it was never recorded
+	 */
+	float getWorkRate(uintptr_t vmStateID);
+
+	/**
+	 * @return the smoothed wakeup cost in microseconds per additional thread, 0 if it was never measured
+	 */
+	MMINLINE float getWakeupCost() { return _wakeupCost; }
+
+	MM_TaskThreadCountModel()
+		: MM_BaseNonVirtual()
+		, _entryCount(0)
+		, _wakeupCost(0.0f)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* TASKTHREADCOUNTMODEL_HPP_ */
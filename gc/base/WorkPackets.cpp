@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -120,6 +120,19 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->workPacketDeques) {
+		/* one deque per potential GC thread, indexed by worker ID */
+		_packetDequeCount = OMR_MAX(_extensions->gcThreadCount, 1);
+		_packetDeques = (MM_PacketDeque *)env->getForge()->allocate(sizeof(MM_PacketDeque) * _packetDequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+			new(&_packetDeques[i]) MM_PacketDeque();
+			_packetDeques[i].initialize((i + 1) * 0x9E3779B9);
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -224,6 +237,12 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _packetDeques) {
+		env->getForge()->free(_packetDeques);
+		_packetDeques = NULL;
+		_packetDequeCount = 0;
+	}
+
 	for(uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if(NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -275,6 +294,13 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 		packet->resetData(env);
 		putPacket(env, packet);
 	}
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		while (NULL != (packet = _packetDeques[i].steal())) {
+			packet->setOwner(env);
+			packet->resetData(env);
+			putPacket(env, packet);
+		}
+	}
 
 	while(NULL != (packet = getPacket(env, &_deferredPacketList))) {
 		packet->resetData(env); 
@@ -332,11 +358,68 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
-				|| (!_overflowHandler->isEmpty()));
+				|| (!_overflowHandler->isEmpty())
+				|| packetDequesAvailable());
 				
 	return res;
 }
 
+/**
+ * Determine whether any GC thread's deque holds a packet
+ * @return true if yes, false if no
+ */
+bool
+MM_WorkPackets::packetDequesAvailable()
+{
+	for (uintptr_t i = 0; i < _packetDequeCount; i++) {
+		if (!_packetDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MM_PacketDeque *
+MM_WorkPackets::getPacketDeque(MM_EnvironmentBase *env)
+{
+	MM_PacketDeque *deque = NULL;
+	if ((NULL != _packetDeques) && (NULL != env->_currentTask)) {
+		uintptr_t workerID = env->getWorkerID();
+		if (workerID < _packetDequeCount) {
+			deque = &_packetDeques[workerID];
+		}
+	}
+	return deque;
+}
+
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env, MM_PacketDeque *ownDeque)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t victim = (NULL != ownDeque) ? ownDeque->nextVictim(_packetDequeCount) : 0;
+
+	for (uintptr_t i = 0; (NULL == packet) && (i < _packetDequeCount); i++) {
+		MM_PacketDeque *deque = &_packetDeques[victim];
+		if ((deque != ownDeque) && !deque->isEmpty()) {
+			/* a lost race just moves on to the next victim, the caller retries while input is available */
+			packet = deque->steal();
+		}
+		victim += 1;
+		if (victim == _packetDequeCount) {
+			victim = 0;
+		}
+	}
+
+	if (NULL != packet) {
+		packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsStolen += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+
+	return packet;
+}
+
 /**
  * Transfer a packet to the current overflow handler to be emptied to
  * resolve work packet overflow. 
@@ -384,28 +467,46 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 MM_Packet *
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
-	MM_Packet *packet;
+	MM_Packet *packet = NULL;
+	MM_PacketDeque *deque = getPacketDeque(env);
 
-	if (!inputPacketAvailable(env)) {
-		return NULL;
+	/* Work this thread produced itself is the most likely to still be in cache */
+	if (NULL != deque) {
+		packet = deque->pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsPopped += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
 	}
 
-	if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
-		if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
-			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
-				packet = getPacket(env, &_fullPacketList);
-			}
+	if (NULL == packet) {
+		if (!inputPacketAvailable(env)) {
+			return NULL;
 		}
-	} else {
-		if(NULL == (packet = getPacket(env, &_fullPacketList))) {
-			if(NULL == (packet = getPacket(env, &_relativelyFullPacketList)))  {
-				packet = getPacket(env, &_nonEmptyPacketList);
+
+		if((!_nonEmptyPacketList.isEmpty()) && (_emptyPacketList.getCount() < (_activePackets >> 2))) {
+			if(NULL == (packet = getPacket(env, &_nonEmptyPacketList))) {
+				if(NULL == (packet = getPacket(env, &_relativelyFullPacketList))) {
+					packet = getPacket(env, &_fullPacketList);
+				}
+			}
+		} else {
+			if(NULL == (packet = getPacket(env, &_fullPacketList))) {
+				if(NULL == (packet = getPacket(env, &_relativelyFullPacketList)))  {
+					packet = getPacket(env, &_nonEmptyPacketList);
+				}
 			}
 		}
-	}
 
-	if(NULL == packet) {
-		packet = getInputPacketFromOverflow(env);
+		if ((NULL == packet) && (NULL != _packetDeques)) {
+			packet = stealPacket(env, deque);
+		}
+
+		if(NULL == packet) {
+			packet = getInputPacketFromOverflow(env);
+		}
 	}
 
 	if(NULL != packet) {
@@ -578,6 +679,16 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 	MM_Packet *packet = NULL;
 	
 	packet = getPacket(env, &_fullPacketList);
+	if (NULL == packet) {
+		/* Full packets may be held in this thread's deque rather than on the shared list */
+		MM_PacketDeque *deque = getPacketDeque(env);
+		if (NULL != deque) {
+			packet = deque->pop();
+			if (NULL != packet) {
+				packet->setOwner(env);
+			}
+		}
+	}
 	if(NULL != packet) {
 		/* Move the contents of the packet to overflow */
 		emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
@@ -731,8 +842,20 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 		mustNotifyWaitingThreads = list->isEmpty();
 		packet->resetOwner();
 	}
-	
-	list->push(env, packet);
+
+	MM_PacketDeque *deque = (&_emptyPacketList == list) ? NULL : getPacketDeque(env);
+	if (NULL != deque) {
+		mustNotifyWaitingThreads = deque->isEmpty();
+		if (!deque->push(packet)) {
+			/* Deque is full - fall back to the shared list (and eventually overflow) */
+			mustNotifyWaitingThreads = list->isEmpty();
+			deque = NULL;
+		}
+	}
+
+	if (NULL == deque) {
+		list->push(env, packet);
+	}
 	
 	if(mustNotifyWaitingThreads && (_inputListWaitCount > 0)) {
 		notifyWaitingThreads(env);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -36,6 +36,7 @@
 
 #include "BaseVirtual.hpp"
 #include "Packet.hpp"
+#include "PacketDeque.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
 
@@ -89,6 +90,9 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_PacketDeque *_packetDeques; /**< per GC thread work-stealing deques of non-empty packets, NULL unless workPacketDeques is enabled */
+	uintptr_t _packetDequeCount; /**< number of entries in _packetDeques */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
@@ -96,6 +100,26 @@ protected:
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
+	/**
+	 * Find the work-stealing deque owned by the current thread.
+	 * Only dispatched GC threads own a deque; mutators (e.g. paying concurrent allocation tax)
+	 * always go through the shared packet lists.
+	 * @return the deque of the current thread, or NULL if it should use the shared lists
+	 */
+	MM_PacketDeque *getPacketDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Steal a packet from the deque of another GC thread, starting at a randomly selected victim.
+	 * @param ownDeque the deque of the current thread (skipped), or NULL
+	 * @return a stolen packet, or NULL if all deques were found empty
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env, MM_PacketDeque *ownDeque);
+
+	/**
+	 * @return true if any GC thread's deque has a packet that could be stolen
+	 */
+	bool packetDequesAvailable();
+
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	
@@ -235,7 +259,9 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_packetDeques(NULL),
+		_packetDequeCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
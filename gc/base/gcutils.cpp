@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -87,6 +87,8 @@ getCompactionReasonAsString(CompactReason reason)
 			return "page granularity fragmentation";	
 		case COMPACT_MICRO_FRAG:
 			return "micro fragmentation";	
+		case COMPACT_INCREMENTAL:
+			return "incremental compaction of fragmented area";
 		default:
 			return "unknown";
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -62,6 +62,7 @@ bool
 MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 {
 	memset(&_perContextSmallFullRegions[0], 0, sizeof(_perContextSmallFullRegions));
+	memset(&_perContextSmallReserveRegions[0], 0, sizeof(_perContextSmallReserveRegions));
 
 	if (!MM_AllocationContext::initialize(env)) {
 		return false;
@@ -79,7 +80,9 @@ MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 		_smallRegions[i] = NULL;
 		/* the small allocation lock needs to be acquired before small full region queue can be accessed, no concurrent access should be possible */
 		_perContextSmallFullRegions[i] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_FULL, true, false, false);
-		if (NULL == _perContextSmallFullRegions[i]) {
+		/* the reserve is also only accessed under the small allocation lock */
+		_perContextSmallReserveRegions[i] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_AVAILABLE, true, false, false);
+		if ((NULL == _perContextSmallFullRegions[i]) || (NULL == _perContextSmallReserveRegions[i])) {
 			return false;
 		}
 	}
@@ -111,6 +114,10 @@ MM_AllocationContextSegregated::tearDown(MM_EnvironmentBase *env)
 			_perContextSmallFullRegions[i]->kill(env);
 			_perContextSmallFullRegions[i] = NULL;
 		}
+		if (NULL != _perContextSmallReserveRegions[i]) {
+			_perContextSmallReserveRegions[i]->kill(env);
+			_perContextSmallReserveRegions[i] = NULL;
+		}
 	}
 
 	if (NULL != _perContextArrayletFullRegions) {
@@ -157,6 +164,8 @@ MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		flushSmall(env, sizeClass);
 		_regionPool->getSmallSweepRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
+		/* unused reserved regions are swept along with the pool's own available regions */
+		_regionPool->getSmallSweepRegions(sizeClass)->enqueue(_perContextSmallReserveRegions[sizeClass]);
 	}
 
 	/* flush the per-context large full region to sweep regions */
@@ -181,6 +190,7 @@ MM_AllocationContextSegregated::returnFullRegionsToRegionPool(MM_EnvironmentBase
 
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_regionPool->getSmallFullRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
+		_regionPool->getSmallAvailableRegions(sizeClass, PRIMARY_BUCKET, 0)->enqueue(_perContextSmallReserveRegions[sizeClass]);
 	}
 	_regionPool->getLargeFullRegions()->enqueue(_perContextLargeFullRegions);
 	_regionPool->getArrayletFullRegions()->enqueue(_perContextArrayletFullRegions);
@@ -194,10 +204,22 @@ MM_AllocationContextSegregated::signalSmallRegionDepleted(MM_EnvironmentBase *en
 	/* No implementation */
 }
 
+/**
+ * Take the next available region of the size class from the context's reserve, refilling the reserve with a
+ * batch of regions from the region pool when it is empty, so that the shared available queues are locked
+ * once per batch rather than once per region.
+ */
 bool
 MM_AllocationContextSegregated::tryAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
-	MM_HeapRegionDescriptorSegregated *region = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
+	MM_HeapRegionQueue *reserve = _perContextSmallReserveRegions[sizeClass];
+	MM_HeapRegionDescriptorSegregated *region = reserve->dequeue();
+	if (NULL == region) {
+		uintptr_t batch = OMR_MAX(env->getExtensions()->segregatedRegionRefillBatch, 1);
+		if (0 != _regionPool->allocateRegionsFromSmallSizeClass(env, sizeClass, reserve, batch)) {
+			region = reserve->dequeue();
+		}
+	}
 	bool result = false;
 	if (region != NULL) {
 		_smallRegions[sizeClass] = region;
@@ -247,7 +269,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* In generational mode a mark identifies an object that survived a collection, so new cells must stay unmarked */
+	return !env->getExtensions()->segregatedGenerational;
 }
 
 /*
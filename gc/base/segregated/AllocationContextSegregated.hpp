@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -59,6 +59,7 @@ private:
 	volatile uint32_t _count; /**< how many threads are attached to me */
 
 	MM_HeapRegionQueue *_perContextSmallFullRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context Regions that have been allocated into during this GC cycle. */
+	MM_HeapRegionQueue *_perContextSmallReserveRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context available regions taken from the region pool in a batch, not yet allocated into */
 	MM_HeapRegionQueue *_perContextArrayletFullRegions; /**< Per-context Arraylet regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextLargeFullRegions; /**< Per-context Large object regions that have been allocated into during this GC cycle. */
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -80,11 +80,13 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 
 	bool success = false;
 
-	/* OMRTODO investigate why these must be equal or it segfaults. */
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 
 	if (MM_Configuration::initialize(env)) {
+		/* OMRTODO investigate why these must be equal or it segfaults.
+		 * gcThreadCount is only settled by MM_Configuration::initialize(), so copy it afterwards.
+		 */
+		extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 		env->getOmrVM()->_sizeClasses = _delegate.getSegregatedSizeClasses(env);
 		if (NULL != env->getOmrVM()->_sizeClasses) {
 			extensions->setSegregatedHeap(true);
@@ -93,6 +95,16 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 			success = true;
 		}
 	}
+
+	/* the uni space resize heuristics divide by these, as in the standard configuration */
+	if (!extensions->heapExpansionGCRatioThreshold._wasSpecified) {
+		extensions->heapExpansionGCRatioThreshold._valueSpecified = 13;
+	}
+
+	if (!extensions->heapContractionGCRatioThreshold._wasSpecified) {
+		extensions->heapContractionGCRatioThreshold._valueSpecified = 5;
+	}
+
 	return success;
 }
 
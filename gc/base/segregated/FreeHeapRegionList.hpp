@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -74,7 +74,34 @@ public:
 	 */
 	virtual void detach(MM_HeapRegionDescriptorSegregated *cur) = 0;
 
-	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess) = 0;
+	/**
+	 * Detach a committed free range of numRegions regions, splitting off and keeping any excess of the first
+	 * range that is large enough.
+	 * @return the first region of the detached range, still marked free, or NULL if no range qualified
+	 */
+	virtual MM_HeapRegionDescriptorSegregated *detachFreeRange(MM_EnvironmentBase *env, uintptr_t numRegions, uintptr_t maxExcess) = 0;
+
+	/**
+	 * @return true if regions can only be transferred out of this list one at a time, by pop()
+	 */
+	virtual bool isLockFree() { return false; }
+
+	MM_HeapRegionDescriptorSegregated *
+	allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+	{
+		MM_HeapRegionDescriptorSegregated *region = detachFreeRange(env, numRegions, maxExcess);
+		if (NULL != region) {
+			region->setRangeHead(region);
+			if (szClass == OMR_SIZECLASSES_LARGE) {
+				region->setLarge(numRegions);
+			} else if (szClass == OMR_SIZECLASSES_ARRAYLET) {
+				region->setArraylet();
+			} else {
+				region->setSmall(szClass);
+			}
+		}
+		return region;
+	}
 
 	MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass)
 	{
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "LockFreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeHeapRegionList *
+MM_LockFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager)
+{
+	MM_LockFreeHeapRegionList *fpl = (MM_LockFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockFreeHeapRegionList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (fpl) {
+		new (fpl) MM_LockFreeHeapRegionList(regionListKind, regionManager);
+		if (!fpl->initialize(env)) {
+			fpl->kill(env);
+			return NULL;
+		}
+	}
+	return fpl;
+}
+
+void
+MM_LockFreeHeapRegionList::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeHeapRegionList::initialize(MM_EnvironmentBase *env)
+{
+	uintptr_t regionCount = _regionManager->getTableRegionCount();
+	if ((0 == regionCount) || (regionCount >= (uintptr_t)0xFFFFFFFF)) {
+		return false;
+	}
+	_links = (uint32_t *)env->getForge()->allocate(regionCount * sizeof(uint32_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _links) {
+		return false;
+	}
+	_stack.initialize(_links);
+	return true;
+}
+
+void
+MM_LockFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _links) {
+		env->getForge()->free(_links);
+		_links = NULL;
+	}
+}
+
+void
+MM_LockFreeHeapRegionList::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	/* the stack cannot be walked safely while other threads pop from it */
+	omrtty_printf("LockFreeHeapRegionList 0x%x: %d regions\n", this, _stack.getCount());
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOCKFREEHEAPREGIONLIST_HPP_)
+#define LOCKFREEHEAPREGIONLIST_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+#include "modronopt.h"
+
+#include "FreeHeapRegionList.hpp"
+#include "HeapRegionManager.hpp"
+#include "LockFreeRegionStack.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A FreeHeapRegionList of single regions which allocating threads push and pop without taking a lock.
+ * Regions are identified by their index in the region table, and are handed out in LIFO order.
+ */
+class MM_LockFreeHeapRegionList : public MM_FreeHeapRegionList
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_HeapRegionManager *_regionManager;
+	MM_LockFreeRegionStack _stack;
+	uint32_t *_links; /**< link array backing _stack, one entry per region in the table */
+
+/* Methods */
+public:
+	static MM_LockFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeHeapRegionList(MM_HeapRegionList::RegionListKind regionListKind, MM_HeapRegionManager *regionManager) :
+		MM_FreeHeapRegionList(regionListKind, true),
+		_regionManager(regionManager),
+		_stack(),
+		_links(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual void
+	push(MM_HeapRegionDescriptorSegregated *region)
+	{
+		Assert_MM_true(1 == region->getRange());
+		Assert_MM_true(NULL == region->getNext() && NULL == region->getPrev());
+		_stack.push(_regionManager->mapDescriptorToRegionTableIndex(region));
+	}
+
+	virtual void
+	push(MM_HeapRegionQueue *src)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = src->dequeue())) {
+			push(region);
+		}
+	}
+
+	virtual void
+	push(MM_FreeHeapRegionList *src)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = src->pop())) {
+			push(region);
+		}
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	pop()
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		uintptr_t index = 0;
+		if (_stack.pop(&index)) {
+			region = (MM_HeapRegionDescriptorSegregated *)_regionManager->mapRegionTableIndexToDescriptor(index);
+		}
+		return region;
+	}
+
+	/**
+	 * Regions cannot be unlinked from the middle of a lock-free stack. Coalescing drains this list into
+	 * the coalesce list before detaching regions, so it is never asked to.
+	 */
+	virtual void
+	detach(MM_HeapRegionDescriptorSegregated *cur)
+	{
+		Assert_MM_unreachable();
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *
+	detachFreeRange(MM_EnvironmentBase *env, uintptr_t numRegions, uintptr_t maxExcess)
+	{
+		return (1 == numRegions) ? pop() : NULL;
+	}
+
+	virtual bool isLockFree() { return true; }
+	virtual bool isEmpty() { return _stack.isEmpty(); }
+	virtual uintptr_t getTotalRegions() { return _stack.getCount(); }
+
+	virtual void showList(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONLIST_HPP_ */
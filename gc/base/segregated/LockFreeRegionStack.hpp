@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOCKFREEREGIONSTACK_HPP_)
+#define LOCKFREEREGIONSTACK_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * Treiber stack of heap region table indices.
+ * Links are kept in a caller supplied array indexed by region rather than in the region descriptors, so a pop that
+ * races with another thread only ever reads a stale link, never a descriptor that is being reused. The head word
+ * carries a version tag in its upper 32 bits which every successful update bumps, so a pop whose head was popped and
+ * pushed back in the meantime fails its compare and swap instead of installing a stale link (ABA).
+ * @ingroup GC_Base
+ */
+class MM_LockFreeRegionStack : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uint64_t _head; /**< version tag in the upper 32 bits, top index + 1 in the lower 32 bits (0 when empty) */
+	volatile uint32_t *_links; /**< for each index on the stack, the index + 1 of the entry below it (0 at the bottom) */
+	volatile uintptr_t _count; /**< number of entries, only approximate while pushes and pops are in flight */
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE static uint64_t
+	nextHead(uint64_t oldHead, uint32_t encodedTop)
+	{
+		return ((oldHead + ((uint64_t)1 << 32)) & ~(uint64_t)0xFFFFFFFF) | (uint64_t)encodedTop;
+	}
+
+public:
+	/**
+	 * Push an index on the stack. The index must not already be on the stack.
+	 */
+	MMINLINE void
+	push(uintptr_t index)
+	{
+		uint64_t oldHead = 0;
+		uint64_t newHead = 0;
+		do {
+			oldHead = _head;
+			_links[index] = (uint32_t)oldHead;
+			/* the link must be visible before a popper can observe the new head */
+			MM_AtomicOperations::writeBarrier();
+			newHead = nextHead(oldHead, (uint32_t)(index + 1));
+		} while (oldHead != MM_AtomicOperations::lockCompareExchangeU64(&_head, oldHead, newHead));
+		MM_AtomicOperations::add(&_count, 1);
+	}
+
+	/**
+	 * Pop the most recently pushed index.
+	 * @param[out] index the popped index
+	 * @return true if an index was popped, false if the stack was empty
+	 */
+	MMINLINE bool
+	pop(uintptr_t *index)
+	{
+		uint64_t oldHead = 0;
+		uint64_t newHead = 0;
+		uint32_t encodedTop = 0;
+		do {
+			oldHead = _head;
+			encodedTop = (uint32_t)oldHead;
+			if (0 == encodedTop) {
+				return false;
+			}
+			MM_AtomicOperations::readBarrier();
+			newHead = nextHead(oldHead, _links[encodedTop - 1]);
+		} while (oldHead != MM_AtomicOperations::lockCompareExchangeU64(&_head, oldHead, newHead));
+		MM_AtomicOperations::subtract(&_count, 1);
+		*index = encodedTop - 1;
+		return true;
+	}
+
+	MMINLINE bool isEmpty() { return 0 == (uint32_t)_head; }
+	MMINLINE uintptr_t getCount() { return _count; }
+
+	/**
+	 * Attach the link array and empty the stack.
+	 * @param links array with one entry per index that may be pushed, owned by the caller
+	 */
+	void
+	initialize(volatile uint32_t *links)
+	{
+		_head = 0;
+		_links = links;
+		_count = 0;
+	}
+
+	MM_LockFreeRegionStack()
+		: MM_BaseNonVirtual()
+		, _head(0)
+		, _links(NULL)
+		, _count(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEREGIONSTACK_HPP_ */
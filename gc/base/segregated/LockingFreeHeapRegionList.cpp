@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -92,8 +92,8 @@ MM_LockingFreeHeapRegionList::showList(MM_EnvironmentBase *env)
 	unlock();
 }
 
-MM_HeapRegionDescriptorSegregated*
-MM_LockingFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+MM_HeapRegionDescriptorSegregated *
+MM_LockingFreeHeapRegionList::detachFreeRange(MM_EnvironmentBase *env, uintptr_t numRegions, uintptr_t maxExcess)
 {
 	lock();
 	for (MM_HeapRegionDescriptorSegregated *cur = _head; cur != NULL; cur = cur->getNext()) {
@@ -107,14 +107,6 @@ MM_LockingFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClas
 					MM_HeapRegionDescriptorSegregated *remainder = cur->splitRange(numRegions);
 					pushInternal(remainder);
 				}
-				cur->setRangeHead(cur);
-				if (szClass == OMR_SIZECLASSES_LARGE) {
-					cur->setLarge(numRegions);
-				} else if (szClass == OMR_SIZECLASSES_ARRAYLET) {
-					cur->setArraylet();
-				} else {
-					cur->setSmall(szClass);
-				}
 				unlock();
 				return cur;
 			}
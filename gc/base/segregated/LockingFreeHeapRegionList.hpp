@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -110,6 +110,16 @@ public:
 	virtual void 
 	push(MM_FreeHeapRegionList *srcAsFPL) 
 	{ 
+		if (srcAsFPL->isLockFree()) {
+			/* no chain to splice - drain the source one region at a time */
+			lock();
+			MM_HeapRegionDescriptorSegregated *region = NULL;
+			while (NULL != (region = srcAsFPL->pop())) {
+				pushInternal(region);
+			}
+			unlock();
+			return;
+		}
 		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
 		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
 			return;
@@ -159,7 +169,7 @@ public:
 		unlock();
 	}
 
-	virtual MM_HeapRegionDescriptorSegregated* allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
+	virtual MM_HeapRegionDescriptorSegregated *detachFreeRange(MM_EnvironmentBase *env, uintptr_t numRegions, uintptr_t maxExcess);
 
 	virtual uintptr_t getTotalRegions();
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -142,6 +142,16 @@ public:
 		return region;
 	}
 
+	/* check that the receiver is not empty before locking it and moving up to count regions to target */
+	uintptr_t dequeueIfNonEmpty(MM_HeapRegionQueue *target, uintptr_t count)
+	{
+		uintptr_t moved = 0;
+		if (0 != _length) {
+			moved = dequeue(target, count);
+		}
+		return moved;
+	}
+
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
 	{
 		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -32,6 +32,7 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionList.hpp"
 #include "LockingFreeHeapRegionList.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -80,7 +81,11 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 		_smallSweepRegions[szClass] = NULL;
 	}
 
-	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
+	/* single free regions are taken by allocating threads on every fresh region refill, so keep that list lock-free */
+	_singleFreeList = MM_LockFreeHeapRegionList::newInstance(env, MM_HeapRegionList::HRL_KIND_FREE, _heapRegionManager);
+	if (NULL == _singleFreeList) {
+		_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
+	}
 	_multiFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_MULTI_FREE, false);
 	_coalesceFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_COALESCE, false);
 	if ((_singleFreeList == NULL) || (_multiFreeList == NULL) || (_coalesceFreeList == NULL)) {
@@ -297,6 +302,9 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 
 	if (numRegions == 1) {
 		region = _singleFreeList->allocate(env, szClass);
+		if ((NULL == region) && refillSingleFreeList(env)) {
+			region = _singleFreeList->allocate(env, szClass);
+		}
 	}
 	
 	if (region == NULL) {
@@ -321,6 +329,33 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 	return region;
 }
 
+/**
+ * Carve a batch of single regions off the multi free list under one lock acquisition, and publish them
+ * on the single free list so that the next refills of any size class are lock-free pops.
+ * @return true if any region was added to the single free list
+ */
+bool
+MM_RegionPoolSegregated::refillSingleFreeList(MM_EnvironmentBase *env)
+{
+	uintptr_t batch = env->getExtensions()->segregatedRegionRefillBatch;
+	if (batch <= 1) {
+		return false;
+	}
+
+	MM_HeapRegionDescriptorSegregated *range = _multiFreeList->detachFreeRange(env, batch, UDATA_MAX);
+	if (NULL == range) {
+		return false;
+	}
+
+	uintptr_t firstIndex = _heapRegionManager->mapDescriptorToRegionTableIndex(range);
+	for (uintptr_t i = 0; i < batch; i++) {
+		MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)_heapRegionManager->mapRegionTableIndexToDescriptor(firstIndex + i);
+		region->setFree(1);
+		_singleFreeList->push(region);
+	}
+	return true;
+}
+
 /* join the lists for each buckets per size class, per split index */
 void
 MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
@@ -335,33 +370,33 @@ MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 }
 
 /**
- * Attempt to allocate a region from the given size classes available list.
- * If there are no available regions in this size class, return null.
+ * Attempt to move up to count regions from the given size classes available list to target, taking the lock
+ * of only one available queue. If there are no available regions in this size class, return 0.
  */
-MM_HeapRegionDescriptorSegregated *
-MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass)
+uintptr_t
+MM_RegionPoolSegregated::allocateRegionsFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass, MM_HeapRegionQueue *target, uintptr_t count)
 {
-	MM_HeapRegionDescriptorSegregated *region = NULL;
+	uintptr_t moved = 0;
 	/* skip searching the available queue for this size class if we've already exhausted all available regions */
 	if (SKIP_AVAILABLE_REGION_FOR_ALLOCATION == _skipAvailableRegionForAllocation[sizeClass]) {
-		return region;
+		return moved;
 	}
 
 	/* try bucket 0, i.e. primary bucket first */
 	uintptr_t startList = env->getEnvironmentId() % _splitAvailableListSplitCount;
 	MM_LockingHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
 	MM_LockingHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
-	region = allocationQueue->dequeueIfNonEmpty();
-	if (region != NULL) {
-		return region;
+	moved = allocationQueue->dequeueIfNonEmpty(target, count);
+	if (0 != moved) {
+		return moved;
 	}
 
 	/* if primary bucket fails, try the other split queues, starting from the current thread's split index */
 	for (uintptr_t j=startList+1; j<startList+_splitAvailableListSplitCount; j++) {
 		allocationQueue = &primaryQueueArray[j%_splitAvailableListSplitCount];
-		region = allocationQueue->dequeueIfNonEmpty();
-		if (region != NULL) {
-			return region;
+		moved = allocationQueue->dequeueIfNonEmpty(target, count);
+		if (0 != moved) {
+			return moved;
 		}
 	}
 
@@ -371,16 +406,16 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 			MM_LockingHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=startList; j<startList+_splitAvailableListSplitCount; j++) {
 				allocationQueue = &queueArray[j%_splitAvailableListSplitCount];
-				region = allocationQueue->dequeueIfNonEmpty();
-				if (region != NULL) {
-					return region;
+				moved = allocationQueue->dequeueIfNonEmpty(target, count);
+				if (0 != moved) {
+					return moved;
 				}
 			}
 		}
 	} else {
 		_skipAvailableRegionForAllocation[sizeClass] = SKIP_AVAILABLE_REGION_FOR_ALLOCATION;
 	}
-	return region;
+	return moved;
 }
 
 /**
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -29,11 +29,15 @@
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelDispatcher.hpp"
-#include "ParallelMarkTask.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SegregatedMarkTask.hpp"
 #include "SegregatedSweepTask.hpp"
 #include "SweepSchemeSegregated.hpp"
+#include "SublistFragment.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 #include "SweepStats.hpp"
 #include "WorkPackets.hpp"
 #include "OMRVMInterface.hpp"
@@ -48,6 +52,10 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+extern "C" {
+	uintptr_t allocateMemoryForSublistFragment(void *vmThreadRawPtr, J9VMGC_SublistFragment *fragmentPrimitive);
+}
+
 /**
  * Initialization
  */
@@ -193,6 +201,11 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		gam->flushAllocationContexts(env);
 	}
 
+	if (_extensions->segregatedGenerational) {
+		flushRememberedSets(env);
+	}
+	_isMinorCollection = shouldCollectMinor(env);
+
 	reportMarkStart(env);
 	markStats->_startTime = omrtime_hires_clock();
 	/* OMRTODO investigate / fix this function call */
@@ -203,13 +216,22 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 //		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 //	}
 
-	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+	/* run the mark; a minor collection keeps the marks of older objects and traces from the remembered set and roots */
+	MM_SegregatedMarkTask markTask(env, _dispatcher, _markingScheme, _isMinorCollection, env->_cycleState);
 	_dispatcher->run(env, &markTask);
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	if (_extensions->segregatedGenerational) {
+		/* Every young object referenced from a remembered object is now marked (old) or unreachable */
+		clearRememberedSet(env);
+		if (_isMinorCollection) {
+			_minorCollectionsSinceGlobal += 1;
+		} else {
+			_minorCollectionsSinceGlobal = 0;
+		}
+	}
+
 	/* Do any post mark checks */
 	/* OMRTODO we need to implement this function for segregated marking scheme */
 //	_markingScheme->mainCleanupAfterGC(env);
@@ -247,6 +269,66 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	return true;
 }
 
+bool
+MM_SegregatedGC::shouldCollectMinor(MM_EnvironmentBase *env)
+{
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	return _extensions->segregatedGenerational
+		&& !gcCode.isExplicitGC()
+		&& !gcCode.isOutOfMemoryGC()
+		&& !_extensions->segregatedRememberedSetOverflow
+		&& (_minorCollectionsSinceGlobal < _extensions->segregatedMinorCollectionsPerGlobal);
+}
+
+void
+MM_SegregatedGC::flushRememberedSets(MM_EnvironmentBase *env)
+{
+	GC_OMRVMThreadListIterator vmThreadListIterator(env->getOmrVM());
+	while(OMR_VMThread* thread = vmThreadListIterator.nextOMRVMThread()) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(thread);
+		if (NULL != walkEnv->_segregatedRememberedSet) {
+			MM_SublistFragment::flush(walkEnv->_segregatedRememberedSet);
+		}
+	}
+}
+
+void
+MM_SegregatedGC::clearRememberedSet(MM_EnvironmentBase *env)
+{
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator remSetIterator(&_extensions->segregatedRememberedSet);
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			if (NULL != *slotPtr) {
+				_extensions->objectModel.clearRemembered(*slotPtr);
+			}
+		}
+	}
+	_extensions->segregatedRememberedSet.clear(env);
+	_extensions->segregatedRememberedSetOverflow = false;
+}
+
+void
+MM_SegregatedGC::addToRememberedSetFragment(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	J9VMGC_SublistFragment *fragment = env->_segregatedRememberedSet;
+	if (fragment->fragmentCurrent >= fragment->fragmentTop) {
+		/* There wasn't enough room in the current fragment - allocate a new one */
+		if (0 != allocateMemoryForSublistFragment(env->getOmrVMThread(), fragment)) {
+			/* The object has no entry so it must not stay remembered; the overflow forces the next collection to trace the whole heap */
+			_extensions->objectModel.clearRemembered(objectPtr);
+			_extensions->segregatedRememberedSetOverflow = true;
+			return;
+		}
+	}
+
+	/* There is at least 1 free entry in the fragment - use it */
+	fragment->count += 1;
+	*(fragment->fragmentCurrent++) = (uintptr_t)objectPtr;
+}
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -48,6 +48,9 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+
+	uintptr_t _minorCollectionsSinceGlobal; /**< Number of minor collections completed since the last full heap collection (generational mode only) */
+	bool _isMinorCollection; /**< True while the current collection is a minor collection that keeps the marks of surviving objects */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -73,6 +76,31 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	/**
+	 * Decide whether the collection about to start may be a minor collection. Explicit and out of memory
+	 * collections, a remembered set overflow and reaching segregatedMinorCollectionsPerGlobal all force a
+	 * full heap collection.
+	 */
+	bool shouldCollectMinor(MM_EnvironmentBase *env);
+
+	/**
+	 * Flush the remembered set fragments of all threads to the global remembered set.
+	 */
+	void flushRememberedSets(MM_EnvironmentBase *env);
+
+	/**
+	 * Reset the remembered state of every object in the remembered set and empty it.
+	 * Called once marking has completed, when every remembered young object is either marked or dead.
+	 */
+	void clearRememberedSet(MM_EnvironmentBase *env);
+
+	/**
+	 * Add an object to the thread's remembered set fragment. If no fragment can be allocated the remembered
+	 * state of the object is reset and the remembered set is put in overflow, forcing the next collection
+	 * to be a full heap collection.
+	 */
+	void addToRememberedSetFragment(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -99,6 +127,30 @@ public:
 
 	virtual bool isMarked(void *objectPtr) { return _markingScheme->isMarked(static_cast<omrobjectptr_t>(objectPtr)); }
 
+	/**
+	 * Generational barrier, called after childObject has been stored into a slot of parentObject.
+	 * Marked objects survived the previous collection and are old; unmarked objects were allocated
+	 * since. An old parent that receives a young child is remembered so that a minor collection scans it.
+	 *
+	 * @param env the thread doing the store
+	 * @param parentObject the object that was stored into
+	 * @param childObject the reference that was stored
+	 */
+	MMINLINE void
+	rememberReference(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+	{
+		if ((NULL != childObject) && _markingScheme->isMarked(parentObject) && !_markingScheme->isMarked(childObject)) {
+			if (_extensions->objectModel.atomicSetRememberedState(parentObject, STATE_REMEMBERED)) {
+				addToRememberedSetFragment(env, parentObject);
+			}
+		}
+	}
+
+	/**
+	 * @return true if the collection in progress is a minor collection
+	 */
+	MMINLINE bool isMinorCollection() { return _isMinorCollection; }
+
 	/**
 	 * Return reference to Marking Scheme
 	 */
@@ -119,6 +171,8 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _minorCollectionsSinceGlobal(0)
+		, _isMinorCollection(false)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "SegregatedMarkingScheme.hpp"
+#include "WorkPackets.hpp"
+#include "WorkStack.hpp"
+
+#include "SegregatedMarkTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+void
+MM_SegregatedMarkTask::run(MM_EnvironmentBase *env)
+{
+	env->_workStack.prepareForWork(env, _markingScheme->getWorkPackets());
+
+	_markingScheme->markLiveObjectsInit(env, !_minorCollection);
+	if (_minorCollection) {
+		_markingScheme->scanRememberedSet(env);
+	}
+	_markingScheme->markLiveObjectsRoots(env, true);
+	_markingScheme->markLiveObjectsScan(env);
+	_markingScheme->markLiveObjectsComplete(env);
+
+	env->_workStack.flush(env);
+}
+
+void
+MM_SegregatedMarkTask::setup(MM_EnvironmentBase *env)
+{
+	if (env->isMainThread()) {
+		Assert_MM_true(_cycleState == env->_cycleState);
+	} else {
+		Assert_MM_true(NULL == env->_cycleState);
+		env->_cycleState = _cycleState;
+	}
+}
+
+void
+MM_SegregatedMarkTask::cleanup(MM_EnvironmentBase *env)
+{
+	_markingScheme->workerCleanupAfterGC(env);
+
+	if (env->isMainThread()) {
+		Assert_MM_true(_cycleState == env->_cycleState);
+	} else {
+		env->_cycleState = NULL;
+	}
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDMARKTASK_HPP_)
+#define SEGREGATEDMARKTASK_HPP_
+
+#include "omrmodroncore.h"
+
+#include "CycleState.hpp"
+#include "ParallelTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_EnvironmentBase;
+class MM_ParallelDispatcher;
+class MM_SegregatedMarkingScheme;
+
+/**
+ * Parallel mark task of the segregated collector. A full heap collection clears the mark map before
+ * tracing from the roots. A minor collection (generational mode) keeps the marks left by previous
+ * collections, so that surviving objects stay marked (old), and traces only from the remembered set
+ * and the roots.
+ */
+class MM_SegregatedMarkTask : public MM_ParallelTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedMarkingScheme *_markingScheme;
+	const bool _minorCollection; /**< True if marks of old objects are kept and the remembered set is scanned */
+	MM_CycleState *_cycleState;  /**< Collection cycle state active for the task */
+
+/* Methods */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_MARK; };
+
+	virtual void run(MM_EnvironmentBase *env);
+	virtual void setup(MM_EnvironmentBase *env);
+	virtual void cleanup(MM_EnvironmentBase *env);
+
+	MM_SegregatedMarkTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SegregatedMarkingScheme *markingScheme, bool minorCollection, MM_CycleState *cycleState)
+		: MM_ParallelTask(env, dispatcher)
+		, _markingScheme(markingScheme)
+		, _minorCollection(minorCollection)
+		, _cycleState(cycleState)
+	{
+		_typeId = __FUNCTION__;
+	}
+protected:
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDMARKTASK_HPP_ */
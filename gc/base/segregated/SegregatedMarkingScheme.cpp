@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -21,6 +21,10 @@
  *******************************************************************************/
 
 #include "EnvironmentBase.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#include "Task.hpp"
 
 #include "SegregatedMarkingScheme.hpp"
 
@@ -57,4 +61,27 @@ MM_SegregatedMarkingScheme::kill(MM_EnvironmentBase *env)
 	env->getForge()->free(this);
 }
 
+/**
+ * Scan the objects in the remembered set, marking the young objects they reference.
+ * Puddles of the remembered set are distributed among the GC threads as work units.
+ */
+void
+MM_SegregatedMarkingScheme::scanRememberedSet(MM_EnvironmentBase *env)
+{
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator remSetIterator(&_extensions->segregatedRememberedSet);
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				/* the unused tail of a flushed fragment is left as NULL slots */
+				if (NULL != *slotPtr) {
+					scanObject(env, *slotPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
+				}
+			}
+		}
+	}
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -50,6 +50,12 @@ private:
 public:
 	static MM_SegregatedMarkingScheme *newInstance(MM_EnvironmentBase *env);
 	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Scan the remembered set of old objects that had young references stored into them.
+	 * Used by minor collections in generational mode, where old objects are not traced.
+	 */
+	void scanRememberedSet(MM_EnvironmentBase *env);
 	
 	MMINLINE void
 	preMarkSmallCells(MM_EnvironmentBase* env, MM_HeapRegionDescriptorSegregated *containingRegion, uintptr_t *cellList, uintptr_t preAllocatedBytes)
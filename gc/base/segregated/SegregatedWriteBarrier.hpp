@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef SEGREGATEDWRITEBARRIER_HPP_
+#define SEGREGATEDWRITEBARRIER_HPP_
+
+#include "objectdescription.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SegregatedGC.hpp"
+#include "SlotObject.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+struct OMR_VMThread;
+
+/**
+ * Out-of-line write barrier for the segregated heap. In generational mode, this method must be called
+ * whenever a child reference is assigned to a parent slot, so that old objects holding references to
+ * young objects are remembered for the next minor collection.
+ *
+ * @param omrThread The thread making the assignment of child reference into parent slot
+ * @param parentObject the parent object
+ * @param childObject The child object reference
+ */
+MMINLINE void
+segregatedWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->segregatedGenerational) {
+		((MM_SegregatedGC *)extensions->getGlobalCollector())->rememberReference(env, parentObject, childObject);
+	}
+}
+
+/**
+ * Convenience method to effect the assignment of a child reference to a parent slot and call
+ * out-of-line write barrier.
+ *
+ * @param omrThread The thread making the assignment of child reference to parent slot
+ * @param parentObject the parent object
+ * @param parentSlot Points to the slot in the parent object that will receive the child reference
+ * @param childObject The child object reference
+ * @see segregatedWriteBarrier(OMR_VMThread *, omrobjectptr_t, omrobjectptr_t)
+ */
+MMINLINE void
+segregatedWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot, omrobjectptr_t childObject)
+{
+	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+	slotObject.writeReferenceToSlot(childObject);
+
+	segregatedWriteBarrier(omrThread, parentObject, childObject);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDWRITEBARRIER_HPP_ */
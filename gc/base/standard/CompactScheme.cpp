@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -44,8 +44,10 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "HeapStats.hpp"
+#include "LargeObjectAllocateStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -286,6 +288,11 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _fixupCards) {
+		env->getForge()->free(_fixupCards);
+		_fixupCards = NULL;
+		_fixupCardsSize = 0;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -429,7 +436,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
 			intptr_t state = SubAreaEntry::init;
 
-			if (singleThreaded) {
+			if (singleThreaded && !_incrementalThisCycle) {
 				size = areaSize;
 			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
@@ -440,6 +447,16 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			for( uintptr_t subAreaNum=0; subAreaNum < numSubAreas; subAreaNum++){
 				uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
 
+				if (_incrementalThisCycle) {
+					/* only sub areas entirely within the window are evacuated, the rest are only fixed up */
+					uint8_t *top = (uint8_t *)OMR_MIN((uintptr_t)p + size, (uintptr_t)highAddress);
+					if ((p < (uint8_t *)_windowBase) || (top > (uint8_t *)_windowTop)) {
+						state = SubAreaEntry::fixup_only;
+					} else {
+						state = SubAreaEntry::init;
+					}
+				}
+
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
 				_subAreaTable[i].state = state;
@@ -520,19 +537,38 @@ void
 MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 {
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		MM_HeapRegionDescriptorStandard *region = NULL;
+		if (_incrementalThisCycle) {
+			/* Only the free entries of the evacuated range are rebuilt, the rest of the free lists stay as sweep left them */
+			if (_compactFrom < _compactTo) {
+				MM_MemoryPool *memoryPool = NULL;
+				MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+				while (NULL != (memoryPool = poolIterator.nextPool())) {
+					if (MEMORY_TYPE_OLD != (memoryPool->getSubSpace()->getTypeFlags() & MEMORY_TYPE_OLD)) {
+						/* the window never extends outside of old space */
+						continue;
+					}
+					MM_HeapLinkedFreeHeader *freeListHead = NULL;
+					MM_HeapLinkedFreeHeader *freeListTail = NULL;
+					uintptr_t freeListMemoryCount = 0;
+					uintptr_t freeListMemorySize = 0;
+					memoryPool->removeFreeEntriesWithinRange(env, _compactFrom, _compactTo, UDATA_MAX, freeListHead, freeListTail, freeListMemoryCount, freeListMemorySize);
+				}
+			}
+		} else {
+			MM_HeapRegionDescriptorStandard *region = NULL;
 
-		/* Finally iterate over all memory pools and reset in preparation for
-		 * rebuild of free list at end of compaction
-		 */
-		GC_HeapRegionIteratorStandard regionIterator2(_rootManager);
-		while(NULL != (region = regionIterator2.nextRegion())) {
-			if (!region->isCommitted() || (0 == region->getSize())) {
-				continue;
+			/* Finally iterate over all memory pools and reset in preparation for
+			 * rebuild of free list at end of compaction
+			 */
+			GC_HeapRegionIteratorStandard regionIterator2(_rootManager);
+			while(NULL != (region = regionIterator2.nextRegion())) {
+				if (!region->isCommitted() || (0 == region->getSize())) {
+					continue;
+				}
+				MM_MemorySubSpace *subspace = region->getSubSpace();
+				MM_MemoryPool *memoryPool = subspace->getMemoryPool();
+				memoryPool->reset(MM_MemoryPool::forCompact);
 			}
-			MM_MemorySubSpace *subspace = region->getSubSpace();
-			MM_MemoryPool *memoryPool = subspace->getMemoryPool();
-			memoryPool->reset(MM_MemoryPool::forCompact);
 		}
 
 		env->_currentTask->releaseSynchronizedGCThreads(env);
@@ -560,8 +596,10 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		_delegate.verifyHeap(env, _markMap);
 #endif /* DEBUG */
 
-		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
-		_extensions->heap->resetLargestFreeEntry();
+		/* Reset largestFreeEntry of all subSpaces at beginning of compaction, unless most free entries survive it */
+		if (!_incrementalThisCycle) {
+			_extensions->heap->resetLargestFreeEntry();
+		}
 
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -615,11 +653,14 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		rebuildFreelist(env);
 
-		MM_MemoryPool *memoryPool;
-		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+		/* An incremental compaction inserted its free entries into the existing lists, there is nothing to redistribute */
+		if (!_incrementalThisCycle) {
+			MM_MemoryPool *memoryPool;
+			MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
 
-		while(NULL != (memoryPool = poolIterator.nextPool())) {
-			memoryPool->postProcess(env, MM_MemoryPool::forCompact);
+			while(NULL != (memoryPool = poolIterator.nextPool())) {
+				memoryPool->postProcess(env, MM_MemoryPool::forCompact);
+			}
 		}
 
 		MM_AtomicOperations::sync();
@@ -647,6 +688,14 @@ MM_CompactScheme::flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolSta
 		memoryPool->addFreeEntries(env, poolState->_freeListHead, poolState->_previousFreeEntry, poolState->_freeHoles, poolState->_freeBytes);
 	}
 
+	if (_incrementalThisCycle) {
+		/* addFreeEntries() merged the rebuilt entries into the free lists which were not reset, and counted them */
+		if (poolState->_largestFreeEntry > memoryPool->getLargestFreeEntry()) {
+			memoryPool->setLargestFreeEntry(poolState->_largestFreeEntry);
+		}
+		return;
+	}
+
 	/* Update the free memory values */
 	memoryPool->setFreeMemorySize(poolState->_freeBytes);
 	memoryPool->setFreeEntryCount(poolState->_freeHoles);
@@ -1357,7 +1406,12 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		/* Nursery objects scanned by a concurrent mark may since have been moved by a scavenge, so only old space cards are trusted */
+        		if (_fixupFromCards && (SubAreaEntry::fixup_only == subAreaTable[i].state) && isSubAreaInOldSpace(&subAreaTable[i])) {
+        			fixupSubAreaFromCards(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, objectCount);
+        		} else {
+        			fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		}
 			}
         }
         /* Number of regions in regionTable, including
@@ -1402,6 +1456,43 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 	}
 }
 
+void
+MM_CompactScheme::fixupSubAreaFromCards(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish, uintptr_t& objectCount)
+{
+	/* if start address is NULL, means we don't need to fix this subarea */
+	if (NULL == firstObject) {
+		return;
+	}
+
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+	uintptr_t heapBase = (uintptr_t)_heap->getHeapBase();
+	uintptr_t low = (uintptr_t)firstObject;
+	uintptr_t high = (uintptr_t)pageStart(pageIndex(finish));
+	uintptr_t cardIndex = (low - heapBase) >> INCREMENTAL_COMPACT_FIXUP_CARD_SHIFT;
+
+	while (low < high) {
+		uintptr_t cardTop = heapBase + ((cardIndex + 1) << INCREMENTAL_COMPACT_FIXUP_CARD_SHIFT);
+		if (0 != _fixupCards[cardIndex]) {
+			/* some object starting in this card referenced the window when it was marked */
+			uintptr_t top = OMR_MIN(cardTop, high);
+			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)low, (uintptr_t *)top);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				objectCount++;
+				fixupObject.fixupObject(env, objectPtr);
+			}
+		}
+		low = cardTop;
+		cardIndex += 1;
+	}
+}
+
+bool
+MM_CompactScheme::isSubAreaInOldSpace(SubAreaEntry *entry)
+{
+	return MEMORY_TYPE_OLD == (entry->memoryPool->getSubSpace()->getTypeFlags() & MEMORY_TYPE_OLD);
+}
+
 void
 MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 {
@@ -1417,7 +1508,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1503,6 +1594,136 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
 	}
 }
 
+bool
+MM_CompactScheme::selectIncrementalWindow(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+	/* _heap is only set up once a compaction runs */
+	MM_Heap *heap = _extensions->heap;
+
+	/* Fold the throughput of an incremental compaction that just completed into the estimate */
+	if (_incrementalThisCycle && (COMPACT_INCREMENTAL == compactStats->_compactReason)) {
+		uint64_t elapsedMicros = omrtime_hires_delta(compactStats->_startTime, compactStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 != elapsedMicros) {
+			uintptr_t windowSize = (uintptr_t)_windowTop - (uintptr_t)_windowBase;
+			uintptr_t bytesPerMilli = (uintptr_t)(((uint64_t)windowSize * 1000) / elapsedMicros);
+			_windowBytesPerMilli = (_windowBytesPerMilli + bytesPerMilli) / 2;
+		}
+	}
+	_incrementalThisCycle = false;
+	_fixupFromCards = false;
+	clearIncrementalWindow(env);
+
+	if (!_extensions->processLargeAllocateStats) {
+		/* without free entry size class stats there is no measure of fragmentation */
+		return false;
+	}
+
+	MM_MemorySubSpace *tenureSubSpace = heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+	MM_MemoryPool *tenurePool = tenureSubSpace->getMemoryPool();
+	MM_LargeObjectAllocateStats *allocateStats = tenurePool->getLargeObjectAllocateStats();
+	uintptr_t freeMemorySize = tenurePool->getActualFreeMemorySize();
+	if ((NULL == allocateStats) || (0 == freeMemorySize)) {
+		return false;
+	}
+
+	/* Free memory which can not be reused at page granularity is what an incremental compaction can recover */
+	uintptr_t reusableFreeMemory = allocateStats->getPageAlignedFreeMemory(heap->getPageSize());
+	float fragmentation = 1.0f - ((float)reusableFreeMemory / (float)freeMemorySize);
+	if (fragmentation < INCREMENTAL_COMPACT_FRAGMENTATION_THRESHOLD) {
+		return false;
+	}
+
+	/* Size the window so that evacuating it fits the pause budget, in whole sub areas */
+	uintptr_t windowSize = _extensions->compactPauseBudget * _windowBytesPerMilli;
+	windowSize = MM_Math::roundToFloor(DESIRED_SUBAREA_SIZE, windowSize);
+	windowSize = OMR_MAX(windowSize, 2 * DESIRED_SUBAREA_SIZE);
+
+	/* Free entries come in address order, so score each window sized slice of the heap by
+	 * the free memory it holds in entries too small for a TLH and keep the best one
+	 */
+	uintptr_t heapBase = (uintptr_t)heap->getHeapBase();
+	uintptr_t fragmentedEntrySize = _extensions->tlhMaximumSize;
+	uintptr_t bestSlice = UDATA_MAX;
+	uintptr_t bestScore = 0;
+	uintptr_t currentSlice = UDATA_MAX;
+	uintptr_t currentScore = 0;
+	void *freeEntry = tenurePool->getFirstFreeStartingAddr(env);
+	while (NULL != freeEntry) {
+		uintptr_t freeEntrySize = ((MM_HeapLinkedFreeHeader *)freeEntry)->getSize();
+		uintptr_t slice = ((uintptr_t)freeEntry - heapBase) / windowSize;
+		if (slice != currentSlice) {
+			if (currentScore > bestScore) {
+				bestScore = currentScore;
+				bestSlice = currentSlice;
+			}
+			currentSlice = slice;
+			currentScore = 0;
+		}
+		if (freeEntrySize < fragmentedEntrySize) {
+			currentScore += freeEntrySize;
+		}
+		freeEntry = tenurePool->getNextFreeStartingAddr(env, freeEntry);
+	}
+	if (currentScore > bestScore) {
+		bestScore = currentScore;
+		bestSlice = currentSlice;
+	}
+	if (0 == bestScore) {
+		return false;
+	}
+
+	/* Clip the slice to the committed old region holding it */
+	uintptr_t windowBase = heapBase + (bestSlice * windowSize);
+	uintptr_t windowTop = windowBase + windowSize;
+	GC_HeapRegionIteratorStandard regionIterator(heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		uintptr_t regionLow = (uintptr_t)region->getLowAddress();
+		uintptr_t regionHigh = (uintptr_t)region->getHighAddress();
+		if ((windowBase < regionHigh) && (windowBase >= regionLow)) {
+			if (!region->isCommitted() || (MEMORY_TYPE_OLD != (region->getSubSpace()->getTypeFlags() & MEMORY_TYPE_OLD))) {
+				return false;
+			}
+			windowTop = OMR_MIN(windowTop, regionHigh);
+			break;
+		}
+	}
+	if ((NULL == region) || ((windowTop - windowBase) < DESIRED_SUBAREA_SIZE)) {
+		return false;
+	}
+
+	uintptr_t fixupCardsSize = (heap->getMaximumPhysicalRange() >> INCREMENTAL_COMPACT_FIXUP_CARD_SHIFT) + 1;
+	if (fixupCardsSize > _fixupCardsSize) {
+		if (NULL != _fixupCards) {
+			env->getForge()->free(_fixupCards);
+			_fixupCardsSize = 0;
+		}
+		_fixupCards = (uint8_t *)env->getForge()->allocate(fixupCardsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _fixupCards) {
+			/* not fatal, fragmentation is left to the regular compaction triggers */
+			return false;
+		}
+		_fixupCardsSize = fixupCardsSize;
+	}
+	memset(_fixupCards, 0, _fixupCardsSize);
+
+	_windowBase = (void *)windowBase;
+	_windowTop = (void *)windowTop;
+	_markingScheme->setCompactWindow(_windowBase, _windowTop, _fixupCards);
+
+	return true;
+}
+
+void
+MM_CompactScheme::clearIncrementalWindow(MM_EnvironmentBase *env)
+{
+	_windowBase = NULL;
+	_windowTop = NULL;
+	_markingScheme->clearCompactWindow();
+}
+
 bool
 MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction)
 {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -139,6 +139,14 @@ protected:
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
 
+	bool                   _incrementalThisCycle; /**< True if this compaction only evacuates the sub areas inside the incremental window */
+	bool                   _fixupFromCards; /**< True if objects outside the window are fixed up from the cards remembered during marking */
+	void                   *_windowBase; /**< Base of the area selected for the next incremental compaction, NULL if none is selected */
+	void                   *_windowTop; /**< Top of the area selected for the next incremental compaction */
+	uintptr_t              _windowBytesPerMilli; /**< Estimated incremental compaction throughput, used to fit the window to the pause budget */
+	uint8_t                *_fixupCards; /**< One byte per fixup card of the maximum heap range, set by marking for objects referencing the window */
+	uintptr_t              _fixupCardsSize; /**< Size in bytes of _fixupCards */
+
 public:
 
 	/*
@@ -216,6 +224,23 @@ protected:
 	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
 	 */
 	void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
+
+	/**
+	 * Fix up the marked objects of a sub area which is not compacted, visiting only the fixup cards
+	 * remembered by marking as holding objects which reference the incremental window.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] firstObject The first object in the subArea
+	 * @param[in] finish The last object in the subArea
+	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
+	 */
+	void fixupSubAreaFromCards(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish, uintptr_t& objectCount);
+
+	/**
+	 * @return true if the sub area belongs to old space, whose objects do not move between marking and compaction
+	 */
+	bool isSubAreaInOldSpace(SubAreaEntry *entry);
+
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
 	void rebuildFreelist(MM_EnvironmentStandard *env);
@@ -323,6 +348,37 @@ public:
 	
 	MMINLINE void setMarkMap(MM_MarkMap *markMap) {	_markMap = markMap;}
 
+	/**
+	 * Select the most fragmented part of old space, sized to the compaction pause budget, as the window
+	 * for the next incremental compaction, and have marking remember the objects which reference it.
+	 * Called by the main thread at the end of a global collection.
+	 *
+	 * @param env[in] the main thread
+	 * @return true if a window was selected
+	 */
+	bool selectIncrementalWindow(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget the incremental window, e.g. because the heap range holding it is going away.
+	 */
+	void clearIncrementalWindow(MM_EnvironmentBase *env);
+
+	MMINLINE bool isIncrementalWindowSelected() { return NULL != _windowBase; }
+
+	/**
+	 * Choose the kind of the next compaction. Must be called before the compact task is dispatched.
+	 *
+	 * @param incremental true to only evacuate the sub areas inside the incremental window
+	 * @param fixupFromCards true if marking traced every reference into the window, so objects outside of it
+	 * can be fixed up from the remembered cards instead of walking the whole heap
+	 */
+	MMINLINE void
+	setIncrementalThisCycle(bool incremental, bool fixupFromCards)
+	{
+		_incrementalThisCycle = incremental;
+		_fixupFromCards = incremental && fixupFromCards;
+	}
+
 	/**
 	 * Create a CompactScheme object.
 	 */
@@ -336,6 +392,13 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _incrementalThisCycle(false)
+		, _fixupFromCards(false)
+		, _windowBase(NULL)
+		, _windowTop(NULL)
+		, _windowBytesPerMilli(INCREMENTAL_COMPACT_INITIAL_BYTES_PER_MILLI)
+		, _fixupCards(NULL)
+		, _fixupCardsSize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
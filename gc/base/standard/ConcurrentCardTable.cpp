@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -45,6 +45,7 @@
 #include "WorkPacketsStandard.hpp"
 #include "MarkingScheme.hpp"
 #include "MemoryManager.hpp"
+#include "ParallelDispatcher.hpp"
 
 #include "mmprivatehook.h"
 #include "mmprivatehook_internal.h"
@@ -485,6 +486,9 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
+
+		/* A slot of clean cards is zero (SLOT_ALL_CLEAN), so the mark map kernels skip runs of clean cards too */
+		_findNonCleanCardSlot = MM_MarkMapScan::getKernel(MM_MarkMapScan::selectKernel(env->getPortLibrary()));
 	
 		/* How many of the card clean phases do we need to perform ?
 		 *
@@ -525,6 +529,16 @@ MM_ConcurrentCardTable::tearDown(MM_EnvironmentBase *env)
 		env->getForge()->free(_cleaningRanges);
 		_cleaningRanges = NULL;
 	}
+
+	if (NULL != _finalCleaningPartitions) {
+		env->getForge()->free(_finalCleaningPartitions);
+		_finalCleaningPartitions = NULL;
+	}
+
+	if (NULL != _finalCleaningCursors) {
+		env->getForge()->free(_finalCleaningCursors);
+		_finalCleaningCursors = NULL;
+	}
 	MM_CardTable::tearDown(env);
 }
 
@@ -1023,6 +1037,129 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 												(uintptr_t)_cleaningRanges);
 	/* We process all cards in one go */
 	_lastCardInPhase = _lastCard;
+
+	_finalCleaningPartitionCount = 0;
+	if (_extensions->partitionedFinalCardCleaning && !determineFinalCleaningPartitions(env)) {
+		/* Out of native memory - fall back to cleaning the shared cleaning ranges */
+		_finalCleaningPartitionCount = 0;
+	}
+}
+
+uintptr_t
+MM_ConcurrentCardTable::countFinalCleaningDirtyCards(MM_EnvironmentBase *env)
+{
+	uintptr_t dirtyCards = 0;
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		Card *topCard = OMR_MIN(range->topCard, _lastCard);
+		Card *card = findNextCard(range->nextCard, topCard, FINAL_CARD_CLEAN_MASK);
+		while (card < topCard) {
+			dirtyCards += 1;
+			card = findNextCard(card + 1, topCard, FINAL_CARD_CLEAN_MASK);
+		}
+	}
+	return dirtyCards;
+}
+
+/**
+ * Split the cleaning ranges into partitions for final card cleaning, one partition per GC thread
+ * where possible. Each thread starts claiming batches from its own partition and then steals from
+ * the partitions which follow it.
+ *
+ * @return TRUE if the partitions were set up; FALSE if they could not be allocated
+ */
+bool
+MM_ConcurrentCardTable::determineFinalCleaningPartitions(MM_EnvironmentBase *env)
+{
+	uintptr_t threadCount = _dispatcher->threadCountMaximum();
+
+	if (_finalCleaningCursorCount < threadCount) {
+		if (NULL != _finalCleaningCursors) {
+			env->getForge()->free(_finalCleaningCursors);
+		}
+		_finalCleaningCursors = (FinalCleaningCursor *)env->getForge()->allocate(sizeof(FinalCleaningCursor) * threadCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_finalCleaningCursorCount = (NULL == _finalCleaningCursors) ? 0 : threadCount;
+		if (NULL == _finalCleaningCursors) {
+			return false;
+		}
+	}
+
+	uintptr_t totalCards = 0;
+	uintptr_t rangeCount = 0;
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		Card *topCard = OMR_MIN(range->topCard, _lastCard);
+		if (range->nextCard < topCard) {
+			totalCards += (uintptr_t)(topCard - range->nextCard);
+		}
+		rangeCount += 1;
+	}
+
+	/* Each range ends a partition, so at most one partition per range more than the thread count */
+	uintptr_t partitionsRequired = rangeCount + threadCount;
+	if (_maxFinalCleaningPartitions < partitionsRequired) {
+		if (NULL != _finalCleaningPartitions) {
+			env->getForge()->free(_finalCleaningPartitions);
+		}
+		_finalCleaningPartitions = (FinalCleaningPartition *)env->getForge()->allocate(sizeof(FinalCleaningPartition) * partitionsRequired, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_maxFinalCleaningPartitions = (NULL == _finalCleaningPartitions) ? 0 : partitionsRequired;
+		if (NULL == _finalCleaningPartitions) {
+			return false;
+		}
+	}
+
+	uintptr_t cardsPerPartition = OMR_MAX((totalCards + threadCount - 1) / threadCount, (uintptr_t)FINAL_CARD_CLEANING_BATCH_CARDS);
+	uintptr_t partitionCount = 0;
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		Card *topCard = OMR_MIN(range->topCard, _lastCard);
+		for (Card *baseCard = range->nextCard; baseCard < topCard; baseCard += cardsPerPartition) {
+			Assert_MM_true(partitionCount < _maxFinalCleaningPartitions);
+			FinalCleaningPartition *partition = &_finalCleaningPartitions[partitionCount];
+			partition->nextCard = baseCard;
+			partition->topCard = ((uintptr_t)(topCard - baseCard) > cardsPerPartition) ? (baseCard + cardsPerPartition) : topCard;
+			partitionCount += 1;
+		}
+	}
+
+	for (uintptr_t workerID = 0; workerID < _finalCleaningCursorCount; workerID++) {
+		FinalCleaningCursor *cursor = &_finalCleaningCursors[workerID];
+		cursor->nextCard = NULL;
+		cursor->topCard = NULL;
+		cursor->partition = (0 == partitionCount) ? 0 : (workerID % partitionCount);
+	}
+
+	/* Publish the partitions before the final card cleaning task is dispatched */
+	MM_AtomicOperations::writeBarrier();
+	_finalCleaningPartitionCount = partitionCount;
+
+	return true;
+}
+
+/**
+ * Claim the next batch of cards for a GC thread, from the partition the thread last claimed from or,
+ * once that is exhausted, from the partitions after it.
+ *
+ * @return TRUE if a batch was claimed; FALSE if all partitions have been handed out
+ */
+bool
+MM_ConcurrentCardTable::claimFinalCleaningBatch(MM_EnvironmentBase *env, FinalCleaningCursor *cursor)
+{
+	uintptr_t partitionCount = _finalCleaningPartitionCount;
+
+	for (uintptr_t i = 0; i < partitionCount; i++) {
+		uintptr_t partitionIndex = (cursor->partition + i) % partitionCount;
+		FinalCleaningPartition *partition = &_finalCleaningPartitions[partitionIndex];
+		if (partition->nextCard < partition->topCard) {
+			Card *batchTop = (Card *)MM_AtomicOperations::add((volatile uintptr_t *)&partition->nextCard, FINAL_CARD_CLEANING_BATCH_CARDS * sizeof(Card));
+			Card *batchBase = batchTop - FINAL_CARD_CLEANING_BATCH_CARDS;
+			if (batchBase < partition->topCard) {
+				cursor->nextCard = batchBase;
+				cursor->topCard = OMR_MIN(batchTop, partition->topCard);
+				cursor->partition = partitionIndex;
+				return true;
+			}
+		}
+	}
+
+	return false;
 }
 
 /**
@@ -1041,10 +1178,61 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
  */
 bool
 MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *bytesTraced)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+	bool moreCards = false;
+
+	if (0 != _finalCleaningPartitionCount) {
+		moreCards = finalCleanCardsFromPartitions(env, bytesTraced);
+	} else {
+		moreCards = finalCleanCardsFromCleaningRanges(env, bytesTraced);
+	}
+
+	env->_cardCleaningStats.addToCardCleaningTime(startTime, omrtime_hires_clock());
+	return moreCards;
+}
+
+/**
+ * Clean a card and retrace the marked objects which start in it.
+ *
+ * @return the number of bytes traced
+ */
+uintptr_t
+MM_ConcurrentCardTable::finalCleanAndTraceCard(MM_EnvironmentBase *env, Card *card)
+{
+	uintptr_t traceCount = 0;
+	omrobjectptr_t objectPtr = NULL;
+
+	/* Clean the card before we trace into it */
+	finalCleanCard(card);
+
+	/* Calculate address of first slot heap for the card to be cleaned... */
+	uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env, card);
+	/* ..and address of last slot N.B Range is EXCLUSIVE */
+	uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
+
+	/* prevent loading mark bits prematurely */
+	MM_AtomicOperations::readBarrier();
+
+	/* Then iterate over all marked objects in the heap between the two addresses */
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markingScheme->getMarkMap(), heapBase, heapTop);
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
+	}
+
+	return traceCount;
+}
+
+/**
+ * Final card cleaning through the shared cleaning ranges; all threads contend for the next
+ * dirty card of the current range.
+ */
+bool
+MM_ConcurrentCardTable::finalCleanCardsFromCleaningRanges(MM_EnvironmentBase *env, uintptr_t *bytesTraced)
 {
 	uintptr_t traceCount = 0;
 	Card * nextDirtyCard;
-	omrobjectptr_t objectPtr;
 	uintptr_t cards = 0;
 	bool phase2 = false;
 
@@ -1054,8 +1242,6 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	/* Reset the number of pushes to this threads stack to zero */
 	env->_workStack.clearPushCount();
 
-	MM_MarkMap *markMap = _markingScheme->getMarkMap();
-	
 	for ( ;
 		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
 		) {
@@ -1070,23 +1256,9 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 			phase2 = true;
 		}
 
-		/* Clean the card before we trace into it */
-		finalCleanCard(nextDirtyCard);
 		cards += 1;
-
-		/* Calculate address of first slot heap for the card to be cleaned... */
-		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
-		/* ..and address of last slot N.B Range is EXCLUSIVE */
-		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
-
-		/* prevent loading mark bits prematurely */
-		MM_AtomicOperations::readBarrier();
-
-		/* Then iterate over all marked objects in the heap between the two addresses */
-		MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
-		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
-			traceCount += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_DIRTY_CARD);
-		}
+		env->_cardCleaningStats._cardsCleaned += 1;
+		traceCount += finalCleanAndTraceCard(env, nextDirtyCard);
 
 		/* Have we pushed enough new refs ?*/
 		if (env->_workStack.getPushCount() >= maxPushes) {
@@ -1108,6 +1280,57 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	return (NULL == nextDirtyCard) ? false : true;
 }
 
+/**
+ * Final card cleaning through the card table partitions. The thread cleans the batch of cards it
+ * claimed last, and claims further batches until it has pushed a packet worth of references.
+ */
+bool
+MM_ConcurrentCardTable::finalCleanCardsFromPartitions(MM_EnvironmentBase *env, uintptr_t *bytesTraced)
+{
+	uintptr_t traceCount = 0;
+	uintptr_t phase1Cards = 0;
+	uintptr_t phase2Cards = 0;
+	bool moreCards = true;
+	FinalCleaningCursor *cursor = &_finalCleaningCursors[env->getWorkerID()];
+
+	/* Set upper limit of refs we push before returning to one packets worth */
+	uintptr_t maxPushes = _markingScheme->getWorkPackets()->getSlotsInPacket();
+
+	/* Reset the number of pushes to this threads stack to zero */
+	env->_workStack.clearPushCount();
+
+	while (env->_workStack.getPushCount() < maxPushes) {
+		if (cursor->nextCard >= cursor->topCard) {
+			if (!claimFinalCleaningBatch(env, cursor)) {
+				moreCards = false;
+				break;
+			}
+			env->_cardCleaningStats._cardsScanned += (uintptr_t)(cursor->topCard - cursor->nextCard);
+		}
+
+		Card *card = findNextCard(cursor->nextCard, cursor->topCard, _finalCardCleanMask);
+		if (card >= cursor->topCard) {
+			cursor->nextCard = cursor->topCard;
+			continue;
+		}
+		cursor->nextCard = card + 1;
+
+		if (card >= _firstCardInPhase2) {
+			phase2Cards += 1;
+		} else {
+			phase1Cards += 1;
+		}
+		traceCount += finalCleanAndTraceCard(env, card);
+	}
+
+	incFinalCleanedCards(phase1Cards, false);
+	incFinalCleanedCards(phase2Cards, true);
+	env->_cardCleaningStats._cardsCleaned += phase1Cards + phase2Cards;
+
+	*bytesTraced = traceCount;
+	return moreCards;
+}
+
 /**
  * Process TLH mark bits
  * Set or clear bits within the TLH mark bit map. The bit map contains one bit for
@@ -1639,8 +1862,8 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 				 * complete slots worth of cards; then go card at a time
 				 **/
 				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
+				if (nextSlot < lastSlot) {
+					nextSlot = MM_MarkMapScan::findNonEmptySlot(_findNonCleanCardSlot, nextSlot, lastSlot);
 				}
 				/*
 			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
@@ -1678,6 +1901,10 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 											  							  (uintptr_t)currentCard)) {
 					break;
 				}
+				if (!concurrentCardClean) {
+					/* The cards up to the one claimed are scanned by this thread only */
+					env->_cardCleaningStats._cardsScanned += (uintptr_t)(currentCard - firstCard);
+				}
 				
 				return nextDirtyCard;
 			}
@@ -1700,7 +1927,12 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 		} else if (currentCard >= currentRange->topCard) {
 			assume0(currentCard == currentRange->topCard);
 			/* Range complete so set nextCard of cleaning range to top card to show cleaning range finsished */
-			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard, (uintptr_t)currentRange->nextCard, (uintptr_t)currentRange->topCard);
+			Card *rangeNextCard = (Card *)currentRange->nextCard;
+			if ((rangeNextCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard, (uintptr_t)rangeNextCard, (uintptr_t)currentRange->topCard))
+				&& !concurrentCardClean
+			) {
+				env->_cardCleaningStats._cardsScanned += (uintptr_t)(currentRange->topCard - rangeNextCard);
+			}
 			
 			/* Switch to next cleaning range */
 			CleaningRange *nextRange =  currentRange + 1;
@@ -1714,9 +1946,12 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 			 * cards in next phase we start at last card in this phase. If we fail then
 			 * another thread beat us to it
 			 */
-			if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+			if ((firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
 										  							  (uintptr_t)firstCard,
-										  							  (uintptr_t)currentCard)) {
+										  							  (uintptr_t)currentCard))
+				&& !concurrentCardClean
+			) {
+				env->_cardCleaningStats._cardsScanned += (uintptr_t)(currentCard - firstCard);
 			}
 			return NULL;
 		}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -26,11 +26,14 @@
 
 #include "omrcfg.h"
 
+#include "CardCleaningStats.hpp"
 #include "CardTable.hpp"
 #include "ConcurrentCardTableStats.hpp"
 #include "Debug.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MarkMapScan.hpp"
+#include "Math.hpp"
 #include "MemoryManager.hpp"
 
 /**
@@ -67,6 +70,9 @@
 
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
+
+/* Number of cards a thread claims at a time during partitioned final card cleaning */
+#define FINAL_CARD_CLEANING_BATCH_CARDS 512
  
 /**
  * @}
@@ -136,6 +142,23 @@ typedef struct {
 	uintptr_t numCards;
 } CleaningRange;
 
+/**
+ * Part of a cleaning range that final card cleaning hands out in batches.
+ */
+typedef struct {
+	Card * volatile nextCard; /**< first card not yet claimed, may overshoot topCard */
+	Card * topCard;
+} FinalCleaningPartition;
+
+/**
+ * Batch of cards a GC thread has claimed during final card cleaning.
+ */
+typedef struct {
+	Card * nextCard; /**< next card of the batch to examine */
+	Card * topCard; /**< end of the batch (exclusive) */
+	uintptr_t partition; /**< partition the next batch is claimed from first */
+} FinalCleaningCursor;
+
 /**
  * @todo Provide class documentation
  * @warn All card table functions assume EXCLUSIVE ranges, ie they take a base and top card where base card
@@ -174,6 +197,14 @@ protected:
 	Card *_firstCardInPhase;
 	Card * volatile _lastCardInPhase;
 	Card *_firstCardInPhase2;
+
+	MM_MarkMapScan::FindNonEmptySlot _findNonCleanCardSlot; /**< kernel skipping runs of clean cards, chosen from the processor features at startup */
+	FinalCleaningPartition *_finalCleaningPartitions; /**< partitions of the card table cleaned during partitioned final card cleaning */
+	uintptr_t _finalCleaningPartitionCount; /**< number of partitions in use, 0 if final card cleaning walks the cleaning ranges instead */
+	uintptr_t _maxFinalCleaningPartitions; /**< number of partitions _finalCleaningPartitions can hold */
+	FinalCleaningCursor *_finalCleaningCursors; /**< batch being cleaned by each GC thread, indexed by worker ID */
+	uintptr_t _finalCleaningCursorCount; /**< number of entries in _finalCleaningCursors */
+	MM_CardCleaningStats _finalCardCleaningStats; /**< final card cleaning statistics merged from all GC threads */
 public:
 	
 	/*
@@ -193,6 +224,35 @@ private:
 	
 	void determineCleaningRanges(MM_EnvironmentBase *env);
 	void resetCleaningRanges(MM_EnvironmentBase *env);
+	bool determineFinalCleaningPartitions(MM_EnvironmentBase *env);
+	bool claimFinalCleaningBatch(MM_EnvironmentBase *env, FinalCleaningCursor *cursor);
+	bool finalCleanCardsFromCleaningRanges(MM_EnvironmentBase *env, uintptr_t *bytesTraced);
+	bool finalCleanCardsFromPartitions(MM_EnvironmentBase *env, uintptr_t *bytesTraced);
+	uintptr_t finalCleanAndTraceCard(MM_EnvironmentBase *env, Card *card);
+
+	/**
+	 * Find the first card in [card, topCard) with any bit of cardMask set. Runs of clean cards are skipped
+	 * a slot at a time with the vector kernel selected at startup.
+	 * @return the card found, or topCard if there is none
+	 */
+	MMINLINE Card *
+	findNextCard(Card *card, Card *topCard, Card cardMask)
+	{
+		uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+		while (card < topCard) {
+			if (((Card)CARD_CLEAN == *card) && (0 == ((uintptr_t)card % sizeof(uintptr_t))) && ((uintptr_t *)card < lastSlot)) {
+				card = (Card *)MM_MarkMapScan::findNonEmptySlot(_findNonCleanCardSlot, (uintptr_t *)card, lastSlot);
+				if (card >= topCard) {
+					break;
+				}
+			}
+			if (0 != (*card & cardMask)) {
+				return card;
+			}
+			card += 1;
+		}
+		return topCard;
+	}
 	bool isCardInActiveTLH(MM_EnvironmentBase *env, Card *card);
 	
 	void reportCardCleanPass2Start(MM_EnvironmentBase *env);
@@ -395,6 +455,19 @@ public:
 	 *
 	 */
 	bool finalCleanCards(MM_EnvironmentBase *env, uintptr_t *bytesTraced);
+
+	/**
+	 * Count the cards final card cleaning will clean. Must be called after initializeFinalCardCleaning()
+	 * and before the cleaning starts.
+	 *
+	 * @return the number of dirty cards in the cleaning ranges
+	 */
+	uintptr_t countFinalCleaningDirtyCards(MM_EnvironmentBase *env);
+
+	/**
+	 * @return final card cleaning statistics, merged from the GC threads at the end of each final card cleaning task
+	 */
+	MM_CardCleaningStats *getFinalCardCleaningStats() { return &_finalCardCleaningStats; }
 	/**
 	 * Determine whether the referenced object is within a dirty card. Used if
 	 * object reference may not be in tenure or nursery.
@@ -490,7 +563,14 @@ public:
 		_lastCard(NULL),
 		_firstCardInPhase(NULL),
 		_lastCardInPhase(NULL),
-		_firstCardInPhase2(NULL)
+		_firstCardInPhase2(NULL),
+		_findNonCleanCardSlot(MM_MarkMapScan::findNonEmptySlotScalar),
+		_finalCleaningPartitions(NULL),
+		_finalCleaningPartitionCount(0),
+		_maxFinalCleaningPartitions(0),
+		_finalCleaningCursors(NULL),
+		_finalCleaningCursorCount(0),
+		_finalCardCleaningStats()
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -25,6 +25,7 @@
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 
 #include "ConcurrentGCIncrementalUpdate.hpp"
+#include "ConcurrentCardTable.hpp"
 
 #include "ConcurrentFinalCleanCardsTask.hpp"
 
@@ -35,6 +36,12 @@ MM_ConcurrentFinalCleanCardsTask::run(MM_EnvironmentBase *envBase)
 	_collector->finalCleanCards(env);
 }
 
+uintptr_t
+MM_ConcurrentFinalCleanCardsTask::getEstimatedWorkSize(MM_EnvironmentBase *env)
+{
+	return ((MM_ConcurrentCardTable *)env->getExtensions()->cardTable)->countFinalCleaningDirtyCards(env);
+}
+
 void
 MM_ConcurrentFinalCleanCardsTask::setup(MM_EnvironmentBase *env)
 {
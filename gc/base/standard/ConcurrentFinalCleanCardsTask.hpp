@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -50,6 +50,12 @@ private:
 
 public:
 	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_CONCURRENT_MARK_FINAL_CLEAN_CARDS; };
+
+	/**
+	 * Final card cleaning retraces the objects in the dirty cards, so its work is the dirty card count.
+	 * @see MM_Task::getEstimatedWorkSize()
+	 */
+	virtual uintptr_t getEstimatedWorkSize(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
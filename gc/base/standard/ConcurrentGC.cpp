@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -196,6 +196,27 @@ MM_ConcurrentGC::reportConcurrentKickoff(MM_EnvironmentBase *env)
 	);
 }
 
+void
+MM_ConcurrentGC::reportConcurrentPacing(MM_EnvironmentBase *env, MM_ConcurrentPacingController::Decision decision)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	/* Controller rates are per microsecond */
+	TRIGGER_J9HOOK_MM_PRIVATE_CONCURRENT_PACING(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_CONCURRENT_PACING,
+		(uintptr_t)decision,
+		(uint64_t)(_pacingController->getAllocationRate() * 1000000.0f),
+		(uint64_t)(_pacingController->getAllocationRateDeviation() * 1000000.0f),
+		(uint64_t)(_pacingController->getTraceRate() * 1000000.0f),
+		_pacingController->getKickoffScale(),
+		_pacingController->getTaxScale(),
+		_pacingController->getCycleError()
+	);
+}
+
 void
 MM_ConcurrentGC::reportConcurrentAborted(MM_EnvironmentBase *env, CollectionAbortReason reason)
 {
@@ -455,6 +476,13 @@ MM_ConcurrentGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->concurrentPacing) {
+		_pacingController = createPacingController(env);
+		if (NULL == _pacingController) {
+			goto error_no_memory;
+		}
+	}
+
 	_allocToInitRate = _extensions->concurrentLevel * CONCURRENT_INIT_BOOST_FACTOR;
 	_allocToTraceRate = _extensions->concurrentLevel;
 	_allocToTraceRateNormal = _extensions->concurrentLevel;
@@ -517,6 +545,11 @@ MM_ConcurrentGC::tearDown(MM_EnvironmentBase *env)
 		_callback = NULL;
 	}
 
+	if (NULL != _pacingController) {
+		_pacingController->kill(env);
+		_pacingController = NULL;
+	}
+
 	/* ..and then tearDown our super class */
 	MM_ParallelGlobalGC::tearDown(env);
 }
@@ -1104,17 +1137,27 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 		remainingFree = targetPool->getApproximateFreeMemorySize();
 	}
 
+	/* Calculate the size to trace for this alloc based on the
+	 * trace target and how much work has been already completed.
+	 */
+	uintptr_t workCompleteSoFar = workCompleted();
+
+	if (NULL != _pacingController) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		/* Only sample free space measured the same way as at kickoff */
+		if (!_extensions->scavengerEnabled || allocDescription->isNurseryAllocation())
+#endif /* OMR_GC_MODRON_SCAVENGER */
+		{
+			samplePacing(env, remainingFree, workCompleteSoFar);
+		}
+	}
+
 	/* We need to adjust the remaining free by same amount we boosted KO threshold
 	 * so that the trace rate calculation works out. Basically we are attempting to ensure
 	 * that all work is assigned to mutators by the time free space drops to _kickoffThresholdBuffer.
 	 */
 	remainingFree = (remainingFree > _kickoffThresholdBuffer) ? (remainingFree - _kickoffThresholdBuffer) : 0;
 
-	/* Calculate the size to trace for this alloc based on the
-	 * trace target and how much work has been already completed.
-	 */
-	uintptr_t workCompleteSoFar = workCompleted();
-
 	/* Calculate how much work we need to get through */
 	uintptr_t traceTarget = getTraceTarget();
 
@@ -1140,6 +1183,11 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 			thisTraceRate = getAllocToTraceRateMin();
 		}
 
+		if (NULL != _pacingController) {
+			/* Tax loop of the pacing controller; may go beyond the maximum rate while tracing lags behind */
+			thisTraceRate = _pacingController->adjustTraceRate(thisTraceRate);
+		}
+
 		if (_forcedKickoff) {
 			/* in case of external kickoff use at least default trace rate */
 			if (thisTraceRate < getAllocToTraceRateNormal()) {
@@ -1353,6 +1401,46 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize)
 	omrthread_monitor_exit(_concurrentTuningMonitor);
 }
 
+/**
+ * Feed the pacing controller a sample of the taxable free space and the work completed.
+ * Sampling is skipped rather than waited for if another thread is tuning.
+ *
+ * @param freeSize the current amount of taxable free space
+ * @param workCompleted the work completed in the current cycle, 0 outside a cycle
+ */
+void
+MM_ConcurrentGC::samplePacing(MM_EnvironmentBase *env, uintptr_t freeSize, uintptr_t workCompleted)
+{
+	if (_pacingController->sampleNeeded(freeSize) && (0 == omrthread_monitor_try_enter(_concurrentTuningMonitor))) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		_pacingController->sample(omrtime_hires_delta(0, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS), freeSize, workCompleted);
+		omrthread_monitor_exit(_concurrentTuningMonitor);
+	}
+}
+
+/**
+ * Let the pacing controller retune the kickoff from how the cycle ended. Explicit GCs end the
+ * cycle regardless of its progress so they do not retune.
+ *
+ * @param executionModeAtGC the concurrent execution mode when the collection was triggered
+ */
+void
+MM_ConcurrentGC::updatePacingAtCycleEnd(MM_EnvironmentBase *env, uintptr_t executionModeAtGC, uint32_t gcCode)
+{
+	if ((NULL == _pacingController) || !_pacingController->isCycleActive()) {
+		return;
+	}
+
+	if (MM_GCCode(gcCode).isExplicitGC()) {
+		_pacingController->cycleAbandoned();
+	} else {
+		bool tracingComplete = (CONCURRENT_EXHAUSTED <= executionModeAtGC);
+		uintptr_t work = (CONCURRENT_TRACE_ONLY <= executionModeAtGC) ? workCompleted() : 0;
+		_pacingController->cycleEnd(tracingComplete, _pacingController->getLastSampleFree(), work);
+		reportConcurrentPacing(env, MM_ConcurrentPacingController::PACING_CYCLE_END);
+	}
+}
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Replenish a pools free lists to satisfy a given allocate.
@@ -1663,7 +1751,13 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		return false;
 	}
 
-	if ((remainingFree < _stats.getKickoffThreshold()) || _forcedKickoff) {
+	bool pacingKickoff = false;
+	if (NULL != _pacingController) {
+		samplePacing(env, remainingFree, 0);
+		pacingKickoff = _pacingController->shouldKickoff(remainingFree, getTraceTarget());
+	}
+
+	if ((remainingFree < _stats.getKickoffThreshold()) || _forcedKickoff || pacingKickoff) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		/* Finish off any sweep work that was still in progress */
 		completeConcurrentSweepForKickoff(env);
@@ -1672,6 +1766,9 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		if (_stats.switchExecutionMode(CONCURRENT_OFF, CONCURRENT_INIT_RUNNING)) {
 			_stats.setRemainingFree(remainingFree);
 			/* Set kickoff reason if it is not set yet */
+			if (pacingKickoff && (remainingFree >= _stats.getKickoffThreshold())) {
+				_stats.setKickoffReason(KICKOFF_PACING_PREDICTED);
+			}
 			_stats.setKickoffReason(KICKOFF_THRESHOLD_REACHED);
 			if (LANGUAGE_DEFINED_REASON != _stats.getKickoffReason()) {
 				_languageKickoffReason = NO_LANGUAGE_KICKOFF_REASON;
@@ -1680,6 +1777,14 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 			_extensions->setConcurrentGlobalGCInProgress(true);
 #endif
 			reportConcurrentKickoff(env);
+
+			if (NULL != _pacingController) {
+				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+				omrthread_monitor_enter(_concurrentTuningMonitor);
+				_pacingController->cycleStart(omrtime_hires_delta(0, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS), remainingFree, getTraceTarget(), _kickoffThresholdBuffer);
+				omrthread_monitor_exit(_concurrentTuningMonitor);
+				reportConcurrentPacing(env, MM_ConcurrentPacingController::PACING_KICKOFF);
+			}
 		}
 		return true;
 	} else {
@@ -1951,6 +2056,8 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 	/* Remember the executionMode at the point when the GC was triggered */
 	uintptr_t executionModeAtGC = _stats.getExecutionMode();
 	_stats.setExecutionModeAtGC(executionModeAtGC);
+
+	updatePacingAtCycleEnd(env, executionModeAtGC, gcCode);
 	
 	Assert_MM_true(NULL == env->_cycleState);
 
@@ -2089,6 +2196,17 @@ MM_ConcurrentGC::postMark(MM_EnvironmentBase *envModron)
 	MM_ParallelGlobalGC::postMark(envModron);
 }
 
+uintptr_t
+MM_ConcurrentGC::getMarkedBytes(MM_EnvironmentBase *env)
+{
+	uintptr_t markedBytes = MM_ParallelGlobalGC::getMarkedBytes(env);
+	if (!_initializeMarkMap) {
+		/* the mark map was kept, so the concurrent phase traced part of this cycle */
+		markedBytes += _stats.getTraceSizeCount() + _stats.getConHelperTraceSizeCount();
+	}
+	return markedBytes;
+}
+
 /**
  * A global collection has been completed. All we need do here is request a retune
  * of concurrent adaptive parameters.
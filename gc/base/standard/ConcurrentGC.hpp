@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -35,6 +35,7 @@
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGCStats.hpp"
+#include "ConcurrentPacingController.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ParallelGlobalGC.hpp"
@@ -222,6 +223,7 @@ protected:
 	MM_ConcurrentMarkingDelegate _concurrentDelegate;
 
 	MM_ConcurrentSafepointCallback *_callback;
+	MM_ConcurrentPacingController *_pacingController; /**< paces kickoff and allocation tax if -Xgc:concurrentPacing is specified, NULL otherwise */
 	MM_ConcurrentGCStats _stats;
 	MM_ConcurrentMarkPhaseStats _concurrentPhaseStats;
 
@@ -254,6 +256,7 @@ private:
 	void reportConcurrentBackgroundThreadFinished(MM_EnvironmentBase *env, uintptr_t traceTotal);
 	void reportConcurrentRememberedSetScanStart(MM_EnvironmentBase *env);
 	void reportConcurrentRememberedSetScanEnd(MM_EnvironmentBase *env, uint64_t duration);
+	void reportConcurrentPacing(MM_EnvironmentBase *env, MM_ConcurrentPacingController::Decision decision);
 	virtual void reportConcurrentHalted(MM_EnvironmentBase *env) {};
 	virtual void reportConcurrentCollectionStart(MM_EnvironmentBase *env) = 0;
 
@@ -313,6 +316,15 @@ protected:
 	virtual void updateTuningStatisticsInternal(MM_EnvironmentBase *env) {};
 
 	bool tracingRateDropped(MM_EnvironmentBase *env);
+
+	/**
+	 * Create the pacing controller used when -Xgc:concurrentPacing is specified.
+	 * Client languages may override this to supply their own pacing policy.
+	 * @return the controller, or NULL if it could not be allocated
+	 */
+	virtual MM_ConcurrentPacingController *createPacingController(MM_EnvironmentBase *env) { return MM_ConcurrentPacingController::newInstance(env); }
+	void samplePacing(MM_EnvironmentBase *env, uintptr_t freeSize, uintptr_t workCompleted);
+	void updatePacingAtCycleEnd(MM_EnvironmentBase *env, uintptr_t executionModeAtGC, uint32_t gcCode);
 	bool periodicalTuningNeeded(MM_EnvironmentBase *env, uintptr_t freeSize);
 	void periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize);
 
@@ -385,6 +397,12 @@ public:
 	virtual void kill(MM_EnvironmentBase *env);
 	
 	virtual void postMark(MM_EnvironmentBase *env);
+
+	/**
+	 * Adds the bytes traced concurrently when the stop-the-world mark completed a concurrent cycle.
+	 * @see MM_ParallelGlobalGC::getMarkedBytes()
+	 */
+	virtual uintptr_t getMarkedBytes(MM_EnvironmentBase *env);
 	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
 	virtual void collectorShutdown(MM_GCExtensionsBase *extensions);
 	virtual void abortCollection(MM_EnvironmentBase *env, CollectionAbortReason reason);
@@ -508,6 +526,7 @@ public:
 		,_rebuildInitWorkForRemove(false)
 		,_retuneAfterHeapResize(false)
 		,_callback(NULL)
+		,_pacingController(NULL)
 		,_stats()
 		,_concurrentPhaseStats()
 		{
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2018, 2021 IBM Corp. and others
+ * Copyright (c) 2018, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -212,6 +212,7 @@ void
 MM_ConcurrentGCIncrementalUpdate::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, uint64_t duration)
 {
 	MM_ConcurrentCardTable *cardTable = (MM_ConcurrentCardTable *)_cardTable;
+	MM_CardCleaningStats *finalCardCleaningStats = cardTable->getFinalCardCleaningStats();
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 	Trc_MM_ConcurrentCollectionCardCleaningEnd(env->getLanguageVMThread());
@@ -233,7 +234,9 @@ MM_ConcurrentGCIncrementalUpdate::reportConcurrentFinalCardCleaningEnd(MM_Enviro
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase3Kickoff(),
-		_stats.getConcurrentWorkStackOverflowCount()
+		_stats.getConcurrentWorkStackOverflowCount(),
+		finalCardCleaningStats->_cardsScanned,
+		finalCardCleaningStats->getCardsScannedPerSecond(omrtime_hires_frequency())
 	);
 }
 
@@ -471,6 +474,7 @@ MM_ConcurrentGCIncrementalUpdate::finalConcurrentPrecollect(MM_EnvironmentBase *
 
 	bool overflow = false; /* assume the worst case*/
 
+	((MM_ConcurrentCardTable *)_cardTable)->getFinalCardCleaningStats()->clear();
 	do {
 		/* remember count when we start */
 		uintptr_t overflowCount = _stats.getConcurrentWorkStackOverflowCount();
@@ -1198,6 +1202,7 @@ MM_ConcurrentGCIncrementalUpdate::finalCleanCards(MM_EnvironmentBase *env)
 	uintptr_t bytesCleaned = 0;
 
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
+	env->_cardCleaningStats.clear();
 
 	/* Until no more refs to process */
 	while (moreRefs) {
@@ -1266,6 +1271,7 @@ MM_ConcurrentGCIncrementalUpdate::finalCleanCards(MM_EnvironmentBase *env)
 	flushLocalBuffers(env);
 	_stats.incFinalTraceCount(totalTraced);
 	_stats.incFinalCardCleanCount(totalCleaned);
+	((MM_ConcurrentCardTable *)_cardTable)->getFinalCardCleaningStats()->mergeAtomic(&env->_cardCleaningStats);
 }
 
 void
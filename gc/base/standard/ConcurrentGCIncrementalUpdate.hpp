@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2018, 2022 IBM Corp. and others
+ * Copyright (c) 2018, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -168,6 +168,16 @@ protected:
 
 	virtual bool canSkipObjectRSScan(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Every store into an object already marked dirties its card, and final card cleaning rescans the marked
+	 * objects of dirty cards through the marking scheme, as does the remembered set scan for objects tenured
+	 * while marking ran. So every old object referencing the incremental window was scanned at its final
+	 * address after its last such store, and its fixup card is set, whether or not marking ran concurrently.
+	 */
+	virtual bool isCompactFixupCardsComplete(MM_EnvironmentBase *env) { return true; }
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	virtual void postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats = NULL, UDATA bytesConcurrentlyScanned = 0);
 
 	virtual void clearWorkStackOverflow();
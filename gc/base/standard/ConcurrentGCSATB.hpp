@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2018, 2022 IBM Corp. and others
+ * Copyright (c) 2018, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -66,6 +66,14 @@ protected:
 	virtual void completeConcurrentTracing(MM_EnvironmentBase *env, uintptr_t executionModeAtGC);
 	virtual void adjustTraceTarget();
 	virtual uintptr_t getTraceTarget() { return _traceTarget; };
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * The snapshot barrier records overwritten references only, an object scanned before a reference into the
+	 * incremental window was stored into it is never rescanned. The fixup cards are therefore only complete
+	 * if this collection marked the heap from scratch.
+	 */
+	virtual bool isCompactFixupCardsComplete(MM_EnvironmentBase *env) { return _initializeMarkMap; }
+#endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/**
 	 * Process event from an external GC (Scavenger) when old-to-old reference is created.
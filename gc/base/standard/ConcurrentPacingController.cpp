@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ConcurrentPacingController.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Math.hpp"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+MM_ConcurrentPacingController *
+MM_ConcurrentPacingController::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentPacingController *controller = (MM_ConcurrentPacingController *)env->getForge()->allocate(sizeof(MM_ConcurrentPacingController), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != controller) {
+		new(controller) MM_ConcurrentPacingController();
+	}
+	return controller;
+}
+
+void
+MM_ConcurrentPacingController::kill(MM_EnvironmentBase *env)
+{
+	env->getForge()->free(this);
+}
+
+void
+MM_ConcurrentPacingController::sample(uint64_t time, uintptr_t freeBytes, uintptr_t workCompleted)
+{
+	if (!_sampleValid || (freeBytes > _lastSampleFree) || (time <= _lastSampleTime) || (workCompleted < _lastSampleWork)) {
+		/* First sample, or a collection or expansion freed space: start a new baseline */
+		if (!_sampleValid || (freeBytes > _lastSampleFree)) {
+			_sampleInterval = OMR_MAX((uintptr_t)((float)freeBytes * PACING_SAMPLE_HEAP_FACTOR), (uintptr_t)PACING_MINIMUM_SAMPLE_INTERVAL);
+		}
+		_sampleValid = true;
+		_lastSampleTime = time;
+		_lastSampleFree = freeBytes;
+		_lastSampleWork = workCompleted;
+		return;
+	}
+
+	float elapsed = (float)(time - _lastSampleTime);
+	float allocationRate = (float)(_lastSampleFree - freeBytes) / elapsed;
+	if (0.0f == _allocationRate) {
+		_allocationRate = allocationRate;
+	} else {
+		float deviation = (allocationRate > _allocationRate) ? (allocationRate - _allocationRate) : (_allocationRate - allocationRate);
+		_allocationRateDeviation = MM_Math::weightedAverage(_allocationRateDeviation, deviation, PACING_RATE_HISTORY_WEIGHT);
+		_allocationRate = MM_Math::weightedAverage(_allocationRate, allocationRate, PACING_RATE_HISTORY_WEIGHT);
+	}
+
+	if (_cycleActive) {
+		float traceRate = (float)(workCompleted - _lastSampleWork) / elapsed;
+		_traceRate = (0.0f == _traceRate) ? traceRate : MM_Math::weightedAverage(_traceRate, traceRate, PACING_RATE_HISTORY_WEIGHT);
+
+		_progressError = progressError(freeBytes, workCompleted);
+		_progressIntegral = clamp(_progressIntegral + _progressError, -PACING_INTEGRAL_LIMIT, PACING_INTEGRAL_LIMIT);
+		_taxScale = clamp(1.0f + (_taxProportionalGain * _progressError) + (_taxIntegralGain * _progressIntegral), PACING_TAX_SCALE_MIN, PACING_TAX_SCALE_MAX);
+	}
+
+	_lastSampleTime = time;
+	_lastSampleFree = freeBytes;
+	_lastSampleWork = workCompleted;
+}
+
+bool
+MM_ConcurrentPacingController::shouldKickoff(uintptr_t freeBytes, uintptr_t traceTarget)
+{
+	/* Without a trace rate from an earlier cycle leave kickoff to the threshold */
+	if ((0.0f == _allocationRate) || (0.0f == _traceRate)) {
+		return false;
+	}
+
+	float predictedAllocationRate = _allocationRate + (PACING_ALLOCATION_DEVIATION_BOOST * _allocationRateDeviation);
+	float timeToExhaustion = (float)freeBytes / predictedAllocationRate;
+	float timeToTrace = ((float)traceTarget / _traceRate) * _kickoffScale;
+
+	return timeToTrace >= timeToExhaustion;
+}
+
+void
+MM_ConcurrentPacingController::cycleStart(uint64_t time, uintptr_t freeBytes, uintptr_t traceTarget, uintptr_t bufferBytes)
+{
+	_cycleActive = true;
+	_cycleFreeAtKickoff = freeBytes;
+	_cycleTraceTarget = traceTarget;
+	_cycleBuffer = OMR_MIN(bufferBytes, freeBytes);
+	_progressError = 0.0f;
+	_progressIntegral = 0.0f;
+	_taxScale = 1.0f;
+
+	/* Measure the trace rate of this cycle from kickoff */
+	_sampleValid = true;
+	_lastSampleTime = time;
+	_lastSampleFree = freeBytes;
+	_lastSampleWork = 0;
+}
+
+void
+MM_ConcurrentPacingController::cycleAbandoned()
+{
+	_cycleActive = false;
+	_sampleValid = false;
+}
+
+void
+MM_ConcurrentPacingController::cycleEnd(bool tracingComplete, uintptr_t freeBytes, uintptr_t workCompleted)
+{
+	if (!_cycleActive) {
+		return;
+	}
+
+	float error = 0.0f;
+	if (tracingComplete) {
+		/* Finished early: the free space left unused is the amount by which the kickoff was premature */
+		error = -((float)OMR_MIN(freeBytes, _cycleFreeAtKickoff) / (float)OMR_MAX(_cycleFreeAtKickoff, (uintptr_t)1));
+	} else if (workCompleted < _cycleTraceTarget) {
+		/* Work left for the stop-the-world collection */
+		error = (float)(_cycleTraceTarget - workCompleted) / (float)_cycleTraceTarget;
+	}
+
+	/* Aim to finish slightly early rather than exactly on time */
+	_cycleError = error + PACING_EARLY_COMPLETION_TARGET;
+	_cycleIntegral = clamp(_cycleIntegral + _cycleError, -PACING_INTEGRAL_LIMIT, PACING_INTEGRAL_LIMIT);
+	_kickoffScale = clamp(1.0f + (_kickoffProportionalGain * _cycleError) + (_kickoffIntegralGain * _cycleIntegral), PACING_KICKOFF_SCALE_MIN, PACING_KICKOFF_SCALE_MAX);
+
+	_cycleActive = false;
+	_sampleValid = false;
+}
+
+float
+MM_ConcurrentPacingController::progressError(uintptr_t freeBytes, uintptr_t workCompleted)
+{
+	if ((0 == _cycleTraceTarget) || (_cycleFreeAtKickoff <= _cycleBuffer)) {
+		return 0.0f;
+	}
+
+	uintptr_t consumed = (_cycleFreeAtKickoff > freeBytes) ? (_cycleFreeAtKickoff - freeBytes) : 0;
+	float consumedShare = OMR_MIN((float)consumed / (float)(_cycleFreeAtKickoff - _cycleBuffer), 1.0f);
+	float tracedShare = OMR_MIN((float)workCompleted / (float)_cycleTraceTarget, 1.0f);
+
+	return consumedShare - tracedShare;
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
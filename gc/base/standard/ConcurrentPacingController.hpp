@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTPACINGCONTROLLER_HPP_)
+#define CONCURRENTPACINGCONTROLLER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+class MM_EnvironmentBase;
+
+/**
+ * @name Concurrent pacing controller tuning
+ * @{
+ */
+#define PACING_RATE_HISTORY_WEIGHT ((float)0.7)
+#define PACING_ALLOCATION_DEVIATION_BOOST ((float)2.0)
+#define PACING_SAMPLE_HEAP_FACTOR ((float)0.02)
+#define PACING_MINIMUM_SAMPLE_INTERVAL 0x10000
+#define PACING_EARLY_COMPLETION_TARGET ((float)0.05)
+#define PACING_KICKOFF_SCALE_MIN ((float)0.5)
+#define PACING_KICKOFF_SCALE_MAX ((float)4.0)
+#define PACING_TAX_SCALE_MIN ((float)0.5)
+#define PACING_TAX_SCALE_MAX ((float)4.0)
+#define PACING_INTEGRAL_LIMIT ((float)4.0)
+/**
+ * @}
+ */
+
+/**
+ * Paces a concurrent mark cycle from the predicted allocation rate and the measured trace rate.
+ *
+ * Outside a cycle the controller predicts the time left before the taxable free space runs out, using
+ * the allocation rate plus a multiple of its deviation so that bursts are anticipated, and asks for a
+ * kickoff once the time needed to trace the target (scaled by the kickoff scale) reaches it.
+ *
+ * Two PI loops correct the predictions. Within a cycle the error is how far tracing lags the share of
+ * free space already consumed; it scales the allocation tax. At the end of a cycle the error is the share
+ * of the trace target left for the final collection, or minus the share of free space left unused when
+ * tracing finished early; it scales the next kickoff.
+ *
+ * Time is in microseconds and space in bytes. The caller serializes sample(), cycleStart() and cycleEnd();
+ * adjustTraceRate() and shouldKickoff() only read the controller state and may run on any mutator.
+ * Client languages can replace the policy by subclassing and overriding MM_ConcurrentGC::createPacingController().
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentPacingController : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum Decision {
+		PACING_KICKOFF = 1, /**< a cycle was kicked off, either by the controller or by the kickoff threshold */
+		PACING_CYCLE_END /**< the kickoff scale was retuned at the end of a cycle */
+	};
+
+protected:
+	float _kickoffProportionalGain;
+	float _kickoffIntegralGain;
+	float _taxProportionalGain;
+	float _taxIntegralGain;
+
+	bool _sampleValid; /**< set once a baseline sample has been taken */
+	uint64_t _lastSampleTime;
+	uintptr_t _lastSampleFree;
+	uintptr_t _lastSampleWork;
+	uintptr_t _sampleInterval; /**< bytes of free space to consume between samples */
+
+	float _allocationRate; /**< average bytes allocated per microsecond */
+	float _allocationRateDeviation; /**< average absolute deviation of the allocation rate */
+	float _traceRate; /**< average bytes traced per microsecond while a cycle is active */
+
+	bool _cycleActive;
+	uintptr_t _cycleFreeAtKickoff;
+	uintptr_t _cycleTraceTarget;
+	uintptr_t _cycleBuffer; /**< free space at which tracing is planned to be complete */
+
+	float _progressError;
+	float _progressIntegral;
+	float _taxScale; /**< multiplier applied to the planned trace rate of each allocation */
+
+	float _cycleError;
+	float _cycleIntegral;
+	float _kickoffScale; /**< multiplier applied to the predicted trace time when deciding to kick off */
+
+private:
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_ConcurrentPacingController *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if enough free space has been consumed since the last sample, or the free space grew
+	 */
+	MMINLINE bool
+	sampleNeeded(uintptr_t freeBytes)
+	{
+		return !_sampleValid || (freeBytes > _lastSampleFree) || ((_lastSampleFree - freeBytes) >= _sampleInterval);
+	}
+
+	/**
+	 * Update the allocation and trace rates, and the tax loop while a cycle is active.
+	 * @param time current time in microseconds
+	 * @param freeBytes taxable free space
+	 * @param workCompleted bytes traced and cleaned so far in the current cycle, 0 outside a cycle
+	 */
+	virtual void sample(uint64_t time, uintptr_t freeBytes, uintptr_t workCompleted);
+
+	/**
+	 * @return true if the predicted time to trace traceTarget reaches the predicted time until freeBytes is allocated
+	 */
+	virtual bool shouldKickoff(uintptr_t freeBytes, uintptr_t traceTarget);
+
+	/**
+	 * A concurrent cycle has been kicked off.
+	 * @param bufferBytes free space left when tracing is planned to be complete
+	 */
+	virtual void cycleStart(uint64_t time, uintptr_t freeBytes, uintptr_t traceTarget, uintptr_t bufferBytes);
+
+	/**
+	 * @return the planned alloc to trace rate scaled by the output of the tax loop
+	 */
+	virtual float adjustTraceRate(float plannedTraceRate) { return plannedTraceRate * _taxScale; }
+
+	/**
+	 * The concurrent cycle has ended; retune the kickoff scale.
+	 * @param tracingComplete true if concurrent tracing finished before the collection
+	 * @param freeBytes taxable free space when the collection started
+	 * @param workCompleted bytes traced and cleaned concurrently
+	 */
+	virtual void cycleEnd(bool tracingComplete, uintptr_t freeBytes, uintptr_t workCompleted);
+
+	/**
+	 * The concurrent cycle ended for a reason unrelated to pacing, such as an explicit GC; leave the kickoff scale as is.
+	 */
+	virtual void cycleAbandoned();
+
+	MMINLINE bool isCycleActive() { return _cycleActive; }
+	MMINLINE uintptr_t getLastSampleFree() { return _lastSampleFree; }
+	MMINLINE float getAllocationRate() { return _allocationRate; }
+	MMINLINE float getAllocationRateDeviation() { return _allocationRateDeviation; }
+	MMINLINE float getTraceRate() { return _traceRate; }
+	MMINLINE float getKickoffScale() { return _kickoffScale; }
+	MMINLINE float getTaxScale() { return _taxScale; }
+	MMINLINE float getProgressError() { return _progressError; }
+	MMINLINE float getCycleError() { return _cycleError; }
+
+	MM_ConcurrentPacingController()
+		: MM_BaseVirtual()
+		, _kickoffProportionalGain(1.0f)
+		, _kickoffIntegralGain(0.5f)
+		, _taxProportionalGain(2.0f)
+		, _taxIntegralGain(0.5f)
+		, _sampleValid(false)
+		, _lastSampleTime(0)
+		, _lastSampleFree(0)
+		, _lastSampleWork(0)
+		, _sampleInterval(PACING_MINIMUM_SAMPLE_INTERVAL)
+		, _allocationRate(0.0f)
+		, _allocationRateDeviation(0.0f)
+		, _traceRate(0.0f)
+		, _cycleActive(false)
+		, _cycleFreeAtKickoff(0)
+		, _cycleTraceTarget(0)
+		, _cycleBuffer(0)
+		, _progressError(0.0f)
+		, _progressIntegral(0.0f)
+		, _taxScale(1.0f)
+		, _cycleError(0.0f)
+		, _cycleIntegral(0.0f)
+		, _kickoffScale(1.0f)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	/**
+	 * @return how far tracing lags the share of free space consumed since kickoff; positive when behind
+	 */
+	float progressError(uintptr_t freeBytes, uintptr_t workCompleted);
+
+	MMINLINE static float
+	clamp(float value, float minimum, float maximum)
+	{
+		return (value < minimum) ? minimum : ((value > maximum) ? maximum : value);
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#endif /* CONCURRENTPACINGCONTROLLER_HPP_ */
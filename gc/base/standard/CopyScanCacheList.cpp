@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -317,6 +317,29 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 	list->_cacheLock.release();
 }
 
+MM_CopyScanCacheStandard *
+MM_CopyScanCacheList::popCacheFromSublist(MM_EnvironmentBase *env, CopyScanCacheSublist *list)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	if (NULL != list->_cacheHead) {
+		env->_scavengerStats._acquireListLockCount += 1;
+		list->_cacheLock.acquire();
+		cache = list->_cacheHead;
+		if (NULL != cache) {
+			decrementCount(list, 1);
+			list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
+
+			if (NULL == list->_cacheHead) {
+				Assert_MM_true(0 == list->_entryCount);
+			}
+		}
+		list->_cacheLock.release();
+	}
+
+	return cache;
+}
+
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
@@ -324,27 +347,57 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 	MM_CopyScanCacheStandard *cache = NULL;
 
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
-
-		if (NULL != list->_cacheHead) {
-			env->_scavengerStats._acquireListLockCount += 1;
-			list->_cacheLock.acquire();
-			cache = list->_cacheHead;
-			if (NULL != cache) {
-				decrementCount(list, 1);
-				list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
-
-				if (NULL == list->_cacheHead) {
-					Assert_MM_true(0 == list->_entryCount);
-				}
-			}
-			list->_cacheLock.release();
+		cache = popCacheFromSublist(env, &_sublists[index]);
+		if (NULL != cache) {
+			break;
+		}
 
-			if (NULL != cache) {
-				break;
-			}
+		index = (index + 1) % _sublistCount;
+	}
+
+	return cache;
+}
+
+void
+MM_CopyScanCacheList::pushCacheForNode(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cacheEntry, uintptr_t nodeIndex, uintptr_t nodeCount)
+{
+	MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSublistIndexForNode(env, nodeIndex, nodeCount)];
+
+	list->_cacheLock.acquire();
+	cacheEntry->next = list->_cacheHead;
+	list->_cacheHead = cacheEntry;
+	incrementCount(list, 1);
+	list->_cacheLock.release();
+}
+
+MM_CopyScanCacheStandard *
+MM_CopyScanCacheList::popCacheForNode(MM_EnvironmentBase *env, uintptr_t nodeIndex, uintptr_t nodeCount, bool *remote)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t groupCount = _sublistCount / nodeCount;
+	uintptr_t index = getSublistIndexForNode(env, nodeIndex, nodeCount);
+
+	*remote = false;
+
+	/* first drain the sublists of our own node */
+	for (uintptr_t i = 0; i < groupCount; i++) {
+		cache = popCacheFromSublist(env, &_sublists[index]);
+		if (NULL != cache) {
+			return cache;
+		}
+		index += nodeCount;
+		if (index >= (groupCount * nodeCount)) {
+			index = nodeIndex;
 		}
+	}
 
+	/* no local work left - steal from any sublist */
+	for (uintptr_t i = 0; i < _sublistCount; i++) {
+		cache = popCacheFromSublist(env, &_sublists[index]);
+		if (NULL != cache) {
+			*remote = ((index % nodeCount) != nodeIndex);
+			break;
+		}
 		index = (index + 1) % _sublistCount;
 	}
 
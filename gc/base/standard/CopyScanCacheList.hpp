@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -103,6 +103,33 @@ private:
 	{
 		return env->getEnvironmentId() % _sublistCount;
 	}
+
+	/**
+	 * Determine the sublist index an environment should use for caches of a NUMA node.
+	 * Sublist i belongs to node (i % nodeCount), threads of the node are spread over its sublists.
+	 *
+	 * @param env the current environment
+	 * @param nodeIndex zero based index of the node
+	 * @param nodeCount the number of nodes the sublists are grouped by
+	 *
+	 * @return an index into the _sublists array
+	 */
+	uintptr_t getSublistIndexForNode(MM_EnvironmentBase *env, uintptr_t nodeIndex, uintptr_t nodeCount)
+	{
+		uintptr_t groupCount = _sublistCount / nodeCount;
+		if (0 == groupCount) {
+			return nodeIndex % _sublistCount;
+		}
+		return nodeIndex + (nodeCount * (env->getEnvironmentId() % groupCount));
+	}
+
+	/**
+	 * Pop the head of a sublist, if any.
+	 * @param env[in] the current GC thread
+	 * @param list[in] the sublist to pop from
+	 * @return the cache entry, or NULL if the sublist is empty
+	 */
+	MM_CopyScanCacheStandard *popCacheFromSublist(MM_EnvironmentBase *env, CopyScanCacheSublist *list);
 	
 	/**
 	 * Increment the sublist counter by the specified amount
@@ -194,6 +221,25 @@ public:
 	 */
 	MM_CopyScanCacheStandard *popCache(MM_EnvironmentBase *env);
 
+	/**
+	 * Add the specified entry to a sublist of the NUMA node its memory belongs to.
+	 * @param env[in] the current GC thread
+	 * @param cacheEntry[in] the cache entry to add
+	 * @param nodeIndex[in] zero based index of the node the cache memory belongs to
+	 * @param nodeCount[in] the number of nodes the sublists are grouped by
+	 */
+	void pushCacheForNode(MM_EnvironmentBase *env, MM_CopyScanCacheStandard *cacheEntry, uintptr_t nodeIndex, uintptr_t nodeCount);
+
+	/**
+	 * Pop a cache entry, trying all sublists of the specified NUMA node before those of any other node.
+	 * @param env[in] the current GC thread
+	 * @param nodeIndex[in] zero based index of the node of the current GC thread
+	 * @param nodeCount[in] the number of nodes the sublists are grouped by
+	 * @param remote[out] set to true if the entry came from a sublist of another node
+	 * @return the cache entry, or NULL if the list is empty
+	 */
+	MM_CopyScanCacheStandard *popCacheForNode(MM_EnvironmentBase *env, uintptr_t nodeIndex, uintptr_t nodeCount, bool *remote);
+
 	/**
 	 * Create a CopyScanCacheList object.
 	 */
@@ -74,6 +74,12 @@ MM_EnvironmentStandard::tearDown(MM_GCExtensionsBase *extensions)
 {
 	/* If we are in a middle of a concurrent GC, we may want to flush GC caches (if thread happens to do GC work) */
 	flushGCCaches(true);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _hotFieldSamples) {
+		extensions->getForge()->free(_hotFieldSamples);
+		_hotFieldSamples = NULL;
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	/* tearDown base class */
 	MM_EnvironmentBase::tearDown(extensions);
 }
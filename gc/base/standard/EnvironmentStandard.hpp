@@ -38,6 +38,7 @@
 #include "SublistFragment.hpp"
 
 class MM_CopyScanCacheStandard;
+struct MM_ScavengerHotFieldSample;
 
 /**
  * @todo Provide class documentation
@@ -60,6 +61,11 @@ public:
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
+	MM_ScavengerHotFieldSample *_hotFieldSamples; /**< hot field samples recorded by this thread in the current scavenge, NULL if hot fields are not learned */
+	uintptr_t _hotFieldSampleCount; /**< number of samples in _hotFieldSamples */
+	uintptr_t _hotFieldSampleCountdown; /**< objects left to scan before the next one is sampled */
+	omrobjectptr_t _hotFieldSampleObject; /**< the last object sampled, so that its samples continue if its scan is resumed */
+	uintptr_t _hotFieldSampleClassKey; /**< the class key of _hotFieldSampleObject */
 #endif
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
@@ -93,6 +99,13 @@ public:
 		,_inactiveDeferredCopyCache(NULL)
 		,_inactiveTenureCopyScanCache(NULL)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_hotFieldSamples(NULL)
+		,_hotFieldSampleCount(0)
+		,_hotFieldSampleCountdown(0)
+		,_hotFieldSampleObject(NULL)
+		,_hotFieldSampleClassKey(0)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		,_tenureTLHRemainderBase(NULL)
 		,_tenureTLHRemainderTop(NULL)
 		,_loaAllocation(false)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -30,6 +30,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalGCStats.hpp"
+#include "Heap.hpp"
 
 #include "ParallelCompactTask.hpp"
 
@@ -39,6 +40,13 @@ MM_ParallelCompactTask::getVMStateID()
 	return OMRVMSTATE_GC_COMPACT;
 }
 
+uintptr_t
+MM_ParallelCompactTask::getEstimatedWorkSize(MM_EnvironmentBase *env)
+{
+	MM_Heap *heap = env->getExtensions()->heap;
+	return heap->getActiveMemorySize() - heap->getApproximateActiveFreeMemorySize();
+}
+
 void
 MM_ParallelCompactTask::run(MM_EnvironmentBase *env)
 {
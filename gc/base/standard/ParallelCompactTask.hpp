@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -51,6 +51,12 @@ private:
 
 public:
 	virtual uintptr_t getVMStateID();
+
+	/**
+	 * Compaction runs after sweep and moves the live objects, so its work is the bytes in use.
+	 * @see MM_Task::getEstimatedWorkSize()
+	 */
+	virtual uintptr_t getEstimatedWorkSize(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
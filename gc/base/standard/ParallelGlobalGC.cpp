@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -43,6 +43,7 @@
 #include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
+#include "HeapUncommitter.hpp"
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -314,6 +315,13 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->deferredHeapUncommit) {
+		_extensions->heapUncommitter = MM_HeapUncommitter::newInstance(env);
+		if (NULL == _extensions->heapUncommitter) {
+			goto error_no_memory;
+		}
+	}
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -378,6 +386,11 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+	if (NULL != _extensions->heapUncommitter) {
+		_extensions->heapUncommitter->kill(env);
+		_extensions->heapUncommitter = NULL;
+	}
 }
 
 uintptr_t
@@ -447,6 +460,7 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	_compactThisCycle = false;
+	_compactIncrementalThisCycle = false;
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	_fixHeapForWalkCompleted = false;
@@ -467,7 +481,7 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	/* If a compaction was required, then do one */
-	if (_compactThisCycle) {
+	if (_compactThisCycle || _compactIncrementalThisCycle) {
 		_collectionStatistics._tenureFragmentation = MICRO_FRAGMENTATION;
 		if (GLOBALGC_ESTIMATE_FRAGMENTATION == (_extensions->estimateFragmentation & GLOBALGC_ESTIMATE_FRAGMENTATION)) {
 			_collectionStatistics._tenureFragmentation |= MACRO_FRAGMENTATION;
@@ -498,7 +512,7 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 
 	bool compactedThisCycle = false;
 #if defined(OMR_GC_MODRON_COMPACTION)
-	compactedThisCycle = _compactThisCycle;
+	compactedThisCycle = _compactThisCycle || _compactIncrementalThisCycle;
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	/* If the delegate has isAllowUserHeapWalk set, fix the heap so that it can be walked */
@@ -533,6 +547,11 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 		*/
 		env->_cycleState->_activeSubSpace->checkResize(env, allocDescription, env->_cycleState->_gcCode.isExplicitGC());
 	}
+
+	if (_extensions->compactIncremental) {
+		/* Pick the window for the next incremental compaction while the free entry stats are fresh */
+		_compactScheme->selectIncrementalWindow(env);
+	}
 #endif
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -722,7 +741,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -777,6 +796,36 @@ compactionReqd:
 	return true;
 }
 
+bool
+MM_ParallelGlobalGC::shouldCompactIncrementallyThisCycle(MM_EnvironmentBase *env)
+{
+	if (!_extensions->compactIncremental || _extensions->noCompactOnGlobalGC || !_compactScheme->isIncrementalWindowSelected()) {
+		return false;
+	}
+
+	MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+	if (_compactThisCycle) {
+		switch (compactStats->_compactReason) {
+		case COMPACT_FRAGMENTED:
+		case COMPACT_MICRO_FRAG:
+		case COMPACT_PAGE:
+			/* fragmentation alone does not justify a full heap compaction pause */
+			_compactThisCycle = false;
+			break;
+		default:
+			return false;
+		}
+	} else {
+		if (COMPACT_PREVENTED_NONE != _delegate.checkIfCompactionShouldBePrevented(env)) {
+			return false;
+		}
+	}
+
+	compactStats->_compactReason = COMPACT_INCREMENTAL;
+	compactStats->_compactPreventedReason = COMPACT_PREVENTED_NONE;
+	return true;
+}
+
 /**
  * Determine if a compact is required to aid contraction.
  * A heap contraction is due so decide whether a compaction would be
@@ -873,6 +922,7 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 #if defined(OMR_GC_MODRON_COMPACTION)
 	/* Decide is a compaction is required - this decision must be made after we sweep since we use the largestFreeEntrySize, as changed by sweep, to determine if a compaction should be done */
 	_compactThisCycle = shouldCompactThisCycle(env, allocDescription, activeSubSpace->maxExpansionInSpace(env), env->_cycleState->_gcCode);
+	_compactIncrementalThisCycle = shouldCompactIncrementallyThisCycle(env);
 
 	if (!_compactThisCycle)  
 #endif /* OMR_GC_MODRON_COMPACTION */		
@@ -902,6 +952,10 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 #if defined(OMR_GC_MODRON_COMPACTION)
 	if (0 != activeSubSpace->getContractionSize()) {
 		_compactThisCycle = compactRequiredBeforeHeapContraction(env, allocDescription, activeSubSpace->getContractionSize());
+		if (_compactThisCycle) {
+			/* a full compaction supersedes the incremental one */
+			_compactIncrementalThisCycle = false;
+		}
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 
@@ -916,7 +970,7 @@ MM_ParallelGlobalGC::completeFreelistRebuildRequired(MM_EnvironmentBase *env, Sw
 	
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 #if defined(OMR_GC_MODRON_COMPACTION)	
-	if (_compactThisCycle) { 
+	if (_compactThisCycle || _compactIncrementalThisCycle) { 
 		*reason = COMPACTION_REQUIRED;
 	} else 
 #endif 	/* OMR_GC_MODRON_COMPACTION */
@@ -968,6 +1022,7 @@ void
 MM_ParallelGlobalGC::mainThreadSweepStart(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
 {
 	_sweepScheme->setMarkMap(_markingScheme->getMarkMap());
+	_sweepScheme->setMarkedBytes(getMarkedBytes(env));
 	_sweepScheme->sweepForMinimumSize(env, env->_cycleState->_activeSubSpace,  allocDescription);
 }
 
@@ -986,7 +1041,10 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 
 	markMap->setMarkMapValid(false);
+	/* compaction reuses the map as its forwarding table */
+	markMap->invalidateCleanUnits();
 	_compactScheme->setMarkMap(markMap);
+	_compactScheme->setIncrementalThisCycle(!_compactThisCycle && _compactIncrementalThisCycle, isCompactFixupCardsComplete(env));
 
 	reportCompactStart(env);
 	compactStats->_startTime = omrtime_hires_clock();
@@ -1103,6 +1161,8 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	_markingScheme->setMarkMap(objectMap->getObjectMap());
 	objectMap->setMarkMap(markMap);
+	/* the map coming back from the object map had bits set by allocation */
+	_markingScheme->getMarkMap()->invalidateCleanUnits();
 #endif
 
 	env->_cycleState->_activeSubSpace = NULL;
@@ -1339,6 +1399,12 @@ MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 {
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* the window may no longer be backed, the next global collection selects a new one */
+	if (NULL != _compactScheme) {
+		_compactScheme->clearIncrementalWindow(env);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 
 	result = result && _delegate.heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -1362,6 +1428,9 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if ((NULL != extensions->heapUncommitter) && !extensions->heapUncommitter->startup()) {
+		return false;
+	}
 	return true;
 }
 
@@ -1373,6 +1442,9 @@ MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 		extensions->scavenger->collectorShutdown(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if (NULL != extensions->heapUncommitter) {
+		extensions->heapUncommitter->shutdown();
+	}
 }
 
 /**
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -70,6 +70,7 @@ private:
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactScheme *_compactScheme;
 	bool _compactThisCycle;		/**< keep a decision should compact run this cycle */
+	bool _compactIncrementalThisCycle;		/**< keep a decision should an incremental compact of the selected window run this cycle */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 protected:
@@ -143,6 +144,13 @@ private:
 	 * @return true if a compaction is required, false otherwise.
 	 */
 	bool compactRequiredBeforeHeapContraction(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t contractionSize);
+	/**
+	 * Determine if only the window selected at the end of the previous global collection should be compacted.
+	 * A compaction required only because of fragmentation is replaced by the incremental one.
+	 * Must be called after shouldCompactThisCycle().
+	 * @return true if an incremental compaction is required, false otherwise.
+	 */
+	bool shouldCompactIncrementallyThisCycle(MM_EnvironmentBase *env);
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	/**
@@ -222,6 +230,12 @@ protected:
 #if defined(OMR_GC_MODRON_COMPACTION)
 	void reportCompactStart(MM_EnvironmentBase *env);
 	void reportCompactEnd(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if marking this cycle traced every reference into the incremental compaction window,
+	 * so that the fixup cards it remembered are complete
+	 */
+	virtual bool isCompactFixupCardsComplete(MM_EnvironmentBase *env) { return true; }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	/**
@@ -248,6 +262,11 @@ protected:
 
 	virtual void postMark(MM_EnvironmentBase *env);
 
+	/**
+	 * @return the bytes marked by this cycle
+	 */
+	virtual uintptr_t getMarkedBytes(MM_EnvironmentBase *env) { return _extensions->globalGCStats.markStats._bytesScanned; }
+
 	MM_ParallelSweepScheme*
 	createSweepScheme(MM_EnvironmentBase *env, MM_GlobalCollector *globalCollector)
 	{
@@ -285,6 +304,7 @@ public:
 	 */
 	uintptr_t fixHeapForWalk(MM_EnvironmentBase *env, UDATA walkFlags, uintptr_t walkReason, MM_HeapWalkerObjectFunc walkFunction);
 	MM_HeapWalker *getHeapWalker() { return _heapWalker; }
+	MM_ParallelHeapWalker *getParallelHeapWalker() { return _heapWalker; }
 	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
 
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
@@ -341,6 +361,7 @@ public:
 #if defined(OMR_GC_MODRON_COMPACTION)
 		, _compactScheme(NULL)
 		, _compactThisCycle(false)
+		, _compactIncrementalThisCycle(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
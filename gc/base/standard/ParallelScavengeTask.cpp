@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2020 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -38,6 +38,12 @@ MM_ParallelScavengeTask::run(MM_EnvironmentBase *envBase)
 	_collector->workThreadGarbageCollect(env);
 }
 
+uintptr_t
+MM_ParallelScavengeTask::getEstimatedWorkSize(MM_EnvironmentBase *env)
+{
+	return _collector->getEstimatedScavengeWork(env);
+}
+
 void
 MM_ParallelScavengeTask::mainSetup(MM_EnvironmentBase *env)
 {
@@ -129,6 +135,12 @@ MM_ParallelScavengeTask::addToNotifyStallTime(MM_EnvironmentBase *env, uint64_t
 	env->_scavengerStats.addToNotifyStallTime(startTime, endTime);
 }
 
+void
+MM_ParallelScavengeTask::addToSyncWaitCount(MM_EnvironmentBase *env, bool parked)
+{
+	env->_scavengerStats.addToSyncWaitCount(parked);
+}
+
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2020 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -80,10 +80,17 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id);
 
 	virtual void addToNotifyStallTime(MM_EnvironmentBase *env, uint64_t startTime, uint64_t endTime);
+	virtual void addToSyncWaitCount(MM_EnvironmentBase *env, bool parked);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	virtual uintptr_t getRecommendedWorkingThreads() { return _recommendedThreads; };
 
+	/**
+	 * @see MM_Scavenger::getEstimatedScavengeWork()
+	 * @see MM_Task::getEstimatedWorkSize()
+	 */
+	virtual uintptr_t getEstimatedWorkSize(MM_EnvironmentBase *env);
+
 	/**
 	 * Create a ParallelScavengeTask object.
 	 */
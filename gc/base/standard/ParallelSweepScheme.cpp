@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -46,6 +46,7 @@
 #include "SweepPoolManagerAddressOrderedList.hpp"
 #include "SweepPoolState.hpp"
 #include "MarkMap.hpp"
+#include "MarkMapScan.hpp"
 #include "ModronAssertions.h"
 #include "HeapMapWordIterator.hpp"
 #include "ObjectModel.hpp"
@@ -71,6 +72,12 @@ MM_ParallelSweepTask::run(MM_EnvironmentBase *env)
 	_sweepScheme->internalSweep(env);
 }
 
+uintptr_t
+MM_ParallelSweepTask::getEstimatedWorkSize(MM_EnvironmentBase *env)
+{
+	return _sweepScheme->_markedBytes;
+}
+
 /**
  * Initialize sweep statistics per work thread at the beginning of the sweep task.
  */
@@ -194,6 +201,8 @@ MM_ParallelSweepScheme::initialize(MM_EnvironmentBase *env)
 	if (0 != omrthread_monitor_init_with_name(&_mutexSweepPoolState, 0, "SweepPoolState Monitor")) {
 		return false;
 	}
+
+	_findNonEmptyMarkSlot = MM_MarkMapScan::getKernel(MM_MarkMapScan::selectKernel(env->getPortLibrary()));
 	
 	return true;
 }
@@ -341,14 +350,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_MarkMapScan::findNonEmptySlot(_findNonEmptyMarkSlot, markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -504,7 +506,11 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 	 */	
 	if (markMapCurrent < markMapChunkTop) {
 		liveObjectFound = true;
-	}	
+	} else {
+		/* The whole map range of the chunk is clear, the next global collection need not clear it again */
+		uintptr_t sweptTop = (uintptr_t)_heapBase + MM_Math::roundToFloor(J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * sizeof(uintptr_t), ((uintptr_t)sweepChunk->chunkTop) - ((uintptr_t)_heapBase));
+		_currentMarkMap->setCleanUnits(sweepChunk->chunkBase, (void *)sweptTop);
+	}
 
 	uintptr_t darkMatterBytes = 0;
 	uintptr_t darkMatterCandidates = 0;
@@ -765,6 +771,9 @@ MM_ParallelSweepScheme::internalSweep(MM_EnvironmentBase *env)
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		/* Reset largestFreeEntry of all subSpaces at beginning of sweep */
 		_extensions->heap->resetLargestFreeEntry();
+
+		/* Sweep finds out which parts of the mark map are clear */
+		_currentMarkMap->startCleanUnitTracking(env);
 		
 		_chunksPrepared = prepareAllChunks(env);
 		
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -37,6 +37,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MarkMapScan.hpp"
 #include "MemoryPool.hpp"
 #include "ParallelTask.hpp"
 
@@ -63,6 +64,12 @@ protected:
 
 public:
 	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_SWEEP; };
+
+	/**
+	 * Sweep connects the free memory between the objects marked this cycle, so its work is the bytes marked.
+	 * @see MM_Task::getEstimatedWorkSize()
+	 */
+	virtual uintptr_t getEstimatedWorkSize(MM_EnvironmentBase *env);
 	
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
@@ -110,6 +117,9 @@ protected:
 	J9Pool *_poolSweepPoolState;				/**< Memory pools for SweepPoolState*/ 
 	omrthread_monitor_t _mutexSweepPoolState;	/**< Monitor to protect memory pool operations for sweepPoolState*/
 
+	MM_MarkMapScan::FindNonEmptySlot _findNonEmptyMarkSlot; /**< kernel skipping runs of empty mark map slots, chosen from the processor features at startup */
+	uintptr_t _markedBytes; /**< Bytes marked by the cycle being swept, 0 if unknown */
+
 public:
 	
 	/*
@@ -159,6 +169,12 @@ public:
 	 * @param markMap[in] The mark map to sweep
 	 */
 	void setMarkMap(MM_MarkMap *markMap);
+
+	/**
+	 * Sets the bytes marked by the cycle about to be swept. Called by the ParallelGlobalGC with the mark map.
+	 * @param markedBytes[in] The bytes marked, 0 if unknown
+	 */
+	MMINLINE void setMarkedBytes(uintptr_t markedBytes) { _markedBytes = markedBytes; }
 	
 	/**
  	* Request to create sweepPoolState class for pool
@@ -225,6 +241,8 @@ public:
 		, _sweepHeapSectioning(NULL)
 		, _poolSweepPoolState(NULL)
 		, _mutexSweepPoolState(0)
+		, _findNonEmptyMarkSlot(MM_MarkMapScan::findNonEmptySlotScalar)
+		, _markedBytes(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -707,7 +707,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env, HEAP_RECONFIG_CONTRACT);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		_heap->decommitRemovedMemory(
+			env,
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
@@ -890,7 +891,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env, HEAP_RECONFIG_CONTRACT);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		_heap->decommitRemovedMemory(
+			env,
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2015 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -53,5 +53,7 @@ MM_RSOverflow::initialize(MM_EnvironmentBase *env)
 
 	/* Clean stolen Mark Map */
 	_markMap->initializeMarkMap(env);
+	/* overflowed objects are about to be marked */
+	_markMap->invalidateCleanUnits();
 }
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -57,10 +57,13 @@
 #include "ForwardedHeader.hpp"
 #include "IndexableObjectScanner.hpp"
 #include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -286,6 +289,19 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
 
+	if (_extensions->scavengerNumaAware && !_extensions->isConcurrentScavengerEnabled()) {
+		uintptr_t nodeCount = _extensions->_numaManager.getAffinityLeaderCount();
+		if (nodeCount > 1) {
+			uintptr_t reservesSize = sizeof(NUMASurvivorReserve) * nodeCount;
+			_numaSurvivorReserves = (NUMASurvivorReserve *)env->getForge()->allocate(reservesSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _numaSurvivorReserves) {
+				return false;
+			}
+			memset(_numaSurvivorReserves, 0, reservesSize);
+			_numaReserveCapacity = nodeCount;
+		}
+	}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (_extensions->concurrentScavenger) {
 		if (!_mainGCThread.initialize(this, true, true, true)) {
@@ -298,6 +314,13 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->scavengerLearnHotFields) {
+		_hotFieldTable = MM_ScavengerHotFieldTable::newInstance(env);
+		if (NULL == _hotFieldTable) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -309,6 +332,17 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _hotFieldTable) {
+		_hotFieldTable->kill(env);
+		_hotFieldTable = NULL;
+	}
+
+	if (NULL != _numaSurvivorReserves) {
+		env->getForge()->free(_numaSurvivorReserves);
+		_numaSurvivorReserves = NULL;
+		_numaReserveCapacity = 0;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -442,6 +476,10 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (NULL != _numaSurvivorReserves) {
+		setupNUMASurvivorReserves(env);
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
@@ -471,6 +509,17 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	env->_scavengerRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
 	env->_scavengerRememberedSet.parentList = &_extensions->rememberedSet;
 
+	if (NULL != _hotFieldTable) {
+		if (NULL == env->_hotFieldSamples) {
+			/* thread goes without sampling if the buffer can not be allocated */
+			env->_hotFieldSamples = (MM_ScavengerHotFieldSample *)env->getForge()->allocate(SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE * sizeof(MM_ScavengerHotFieldSample), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		}
+		env->_hotFieldSampleCount = 0;
+		/* stagger the first sample of each thread */
+		env->_hotFieldSampleCountdown = (env->getWorkerID() % SCAVENGER_HOT_FIELD_SAMPLE_INTERVAL) + 1;
+		env->_hotFieldSampleObject = NULL;
+	}
+
 	/* caches should all be reset */
 	Assert_MM_true(NULL == env->_survivorCopyScanCache);
 	Assert_MM_true(NULL == env->_tenureCopyScanCache);
@@ -479,6 +528,92 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_false(env->_loaAllocation);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderBase);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
+
+	if ((0 != _numaNodeCount) && (GC_WORKER_THREAD == env->getThreadType())
+		&& _extensions->_numaManager.isPhysicalNUMASupported() && _extensions->_numaManager.shouldSetCPUAffinity()
+	) {
+		/* run next to the survivor reserve this thread copies into */
+		uintptr_t j9NodeNumber = _extensions->_numaManager.getJ9NodeNumber(getNUMANodeIndex(env) + 1);
+		env->setNumaAffinity(&j9NodeNumber, 1);
+	}
+}
+
+void
+MM_Scavenger::setupNUMASurvivorReserves(MM_EnvironmentStandard *env)
+{
+	MM_MemoryPool *memoryPool = _survivorMemorySubSpace->getMemoryPool();
+	uintptr_t reserveSize = MM_Math::roundToFloor(_objectAlignmentInBytes, memoryPool->getActualFreeMemorySize() / _numaReserveCapacity);
+	bool bindMemory = _extensions->_numaManager.isPhysicalNUMASupported() && !_extensions->enableSplitHeap;
+	uintptr_t nodeCount = 0;
+
+	_numaNodeCount = 0;
+
+	if (reserveSize >= _extensions->scavengerScanCacheMaximumSize) {
+		for (uintptr_t i = 0; i < _numaReserveCapacity; i++) {
+			MM_AllocateDescription allocDescription(0, 0, false, true);
+			void *addrBase = NULL;
+			void *addrTop = NULL;
+			if (NULL == memoryPool->collectorAllocateTLH(env, &allocDescription, reserveSize, addrBase, addrTop, false)) {
+				break;
+			}
+			NUMASurvivorReserve *reserve = &_numaSurvivorReserves[nodeCount];
+			reserve->base = (uintptr_t)addrBase;
+			reserve->alloc = (uintptr_t)addrBase;
+			reserve->top = (uintptr_t)addrTop;
+			if (bindMemory) {
+				/* pages already touched keep their placement, only new faults follow the preferred node */
+				_extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)_extensions->heap)->getVmemHandle(), _extensions->_numaManager.getJ9NodeNumber(nodeCount + 1), addrBase, (uintptr_t)addrTop - (uintptr_t)addrBase);
+			}
+			nodeCount += 1;
+		}
+	}
+
+	/* a single reserve buys no locality - give the memory back and copy from the pool as usual */
+	_numaNodeCount = nodeCount;
+	if (1 == nodeCount) {
+		releaseNUMASurvivorReserves(env);
+	}
+}
+
+void
+MM_Scavenger::releaseNUMASurvivorReserves(MM_EnvironmentStandard *env)
+{
+	MM_MemoryPool *memoryPool = _survivorMemorySubSpace->getMemoryPool();
+
+	for (uintptr_t i = 0; i < _numaNodeCount; i++) {
+		void *addrBase = (void *)_numaSurvivorReserves[i].alloc;
+		void *addrTop = (void *)_numaSurvivorReserves[i].top;
+		/* a remainder too small for a free entry is filled with holes */
+		if ((addrBase < addrTop) && memoryPool->createFreeEntry(env, addrBase, addrTop, NULL, NULL)) {
+			MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)addrBase;
+			memoryPool->addFreeEntries(env, freeEntry, freeEntry, 1, (uintptr_t)addrTop - (uintptr_t)addrBase);
+		}
+	}
+
+	_numaNodeCount = 0;
+}
+
+bool
+MM_Scavenger::allocateFromNUMASurvivorReserves(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t preferredSize, void* &addrBase, void* &addrTop)
+{
+	uintptr_t nodeIndex = getNUMANodeIndex(env);
+
+	for (uintptr_t i = 0; i < _numaNodeCount; i++) {
+		NUMASurvivorReserve *reserve = &_numaSurvivorReserves[(nodeIndex + i) % _numaNodeCount];
+		uintptr_t alloc = reserve->alloc;
+		while ((reserve->top - alloc) >= minimumSize) {
+			uintptr_t size = OMR_MIN(preferredSize, reserve->top - alloc);
+			uintptr_t oldAlloc = MM_AtomicOperations::lockCompareExchange(&reserve->alloc, alloc, alloc + size);
+			if (oldAlloc == alloc) {
+				addrBase = (void *)alloc;
+				addrTop = (void *)(alloc + size);
+				return true;
+			}
+			alloc = oldAlloc;
+		}
+	}
+
+	return false;
 }
 
 uintptr_t
@@ -569,6 +704,17 @@ MM_Scavenger::calculateRecommendedWorkingThreads(MM_EnvironmentStandard *env)
 	Trc_MM_Scavenger_calculateRecommendedWorkingThreads_setRecommendedThreads(env->getLanguageVMThread(), scavengeTotalTime, totalStallTime, (percentStall*100), totalThreads, idealThreads, adjustedAverage, (adjustedAverage +  _extensions->adaptiveThreadBooster), _recommendedThreads);
 }
 
+uintptr_t
+MM_Scavenger::getEstimatedScavengeWork(MM_EnvironmentBase *env)
+{
+	uintptr_t work = 0;
+	if (!_extensions->isConcurrentScavengerEnabled() && (0 != _lastCopiedObjects)) {
+		uintptr_t averageObjectSize = _lastCopiedBytes / _lastCopiedObjects;
+		work = _lastCopiedBytes + (_extensions->rememberedSet.countElements() * averageObjectSize);
+	}
+	return work;
+}
+
 /**
  * Run a scavenge.
  */
@@ -785,6 +931,10 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 											 finalGCStats->_failedTenureLargest);
 	finalGCStats->_failedFlipCount += scavStats->_failedFlipCount;
 	finalGCStats->_failedFlipBytes += scavStats->_failedFlipBytes;
+	finalGCStats->_numaRemoteCopyBytes += scavStats->_numaRemoteCopyBytes;
+	finalGCStats->_numaRemoteScanCacheCount += scavStats->_numaRemoteScanCacheCount;
+	finalGCStats->_hotFieldSampleCount += scavStats->_hotFieldSampleCount;
+	finalGCStats->_hotFieldLearnedCopyCount += scavStats->_hotFieldLearnedCopyCount;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	finalGCStats->_acquireFreeListCount += scavStats->_acquireFreeListCount;
@@ -825,6 +975,10 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_tenureExpandedCount += scavStats->_tenureExpandedCount;
 	finalGCStats->_tenureExpandedTime += scavStats->_tenureExpandedTime;
 
+	finalGCStats->_rememberedSetObjectCount += scavStats->_rememberedSetObjectCount;
+	finalGCStats->_rememberedSetScanTime += scavStats->_rememberedSetScanTime;
+	finalGCStats->_sizeIndexAllocCount += scavStats->_sizeIndexAllocCount;
+
 #if defined(OMR_SCAVENGER_TRACK_COPY_DISTANCE)
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_DISTANCE_BINS; i++) {
 		finalGCStats->_copy_distance_counts[i] += scavStats->_copy_distance_counts[i];
@@ -841,6 +995,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_workStallCount += scavStats->_workStallCount;
 	finalGCStats->_completeStallCount += scavStats->_completeStallCount;
 	_extensions->scavengerStats._syncStallCount += scavStats->_syncStallCount;
+	finalGCStats->_syncSpinWaitCount += scavStats->_syncSpinWaitCount;
+	finalGCStats->_syncParkWaitCount += scavStats->_syncParkWaitCount;
 
 	/* Adaptive Threading Stats */
 	finalGCStats->_startTime += scavStats->_startTime;
@@ -868,6 +1024,15 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 	/* Merge language specific statistics. No known interesting data per increment - they are merged directly to aggregate cycle stats */
 	_delegate.mergeGCStats_mergeLangStats(env);
 
+	if (NULL != _hotFieldTable) {
+		/* the stats mutex also serializes merging of hot field samples */
+		MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+		if (0 != envStandard->_hotFieldSampleCount) {
+			_hotFieldTable->mergeSamples(envStandard->_hotFieldSamples, envStandard->_hotFieldSampleCount);
+			envStandard->_hotFieldSampleCount = 0;
+		}
+	}
+
 	uint64_t timeToStartCollection =  omrtime_hires_delta(_cycleTimes.cycleStart, scavStats->_startTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 	uint64_t scanStall =  omrtime_hires_delta(0, (scavStats->_workStallTime + scavStats->_completeStallTime), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 	uint64_t syncStall = omrtime_hires_delta(0, (scavStats->_adjustedSyncStallTime), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
@@ -1170,21 +1335,29 @@ retry:
 				env->_survivorTLHRemainderTop = NULL;
 				activateDeferredCopyScanCache(env);
 			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
-				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
-
-				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
+				if ((0 != _numaNodeCount) && allocateFromNUMASurvivorReserves(env, cacheSize, cacheSize, addrBase, addrTop)) {
 					allocateResult = true;
+				} else {
+					MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
+
+					addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
+					}
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
-				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if ((0 != _numaNodeCount) && allocateFromNUMASurvivorReserves(env, cacheSize, OMR_MAX(scanCacheSize, cacheSize), addrBase, addrTop)) {
+					allocateResult = true;
+				} else {
+					MM_AllocateDescription allocDescription(0, 0, false, true);
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1217,6 +1390,9 @@ retry:
 				/* clear all flags except "allocated in heap" might be set already*/
 				copyCache->flags &= OMR_SCAVENGER_CACHE_TYPE_HEAP;
 				copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_SEMISPACE | OMR_SCAVENGER_CACHE_TYPE_COPY;
+				if ((0 != _numaNodeCount) && (getNUMANodeIndexForAddress(env, addrBase) != getNUMANodeIndex(env))) {
+					copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE;
+				}
 				copyCache->reinitCache(addrBase, addrTop);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
@@ -1471,30 +1647,40 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
  * @return true if the new location of the object is in new space
  * @return false otherwise
  */
+template <bool compressed>
 MMINLINE bool
 MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObject)
 {
-	omrobjectptr_t oldSlot = slotObject->readReferenceFromSlot();
+	omrobjectptr_t oldSlot = slotObject->readReferenceFromSlot<compressed>();
 	omrobjectptr_t slot = oldSlot;
 	bool result = copyAndForward(env, &slot);
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (concurrent_phase_scan == _concurrentPhase) {
 		if (oldSlot != slot) {
-			slotObject->atomicWriteReferenceToSlot(oldSlot, slot);
+			slotObject->atomicWriteReferenceToSlot<compressed>(oldSlot, slot);
 		}
 	} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	{
-		slotObject->writeReferenceToSlot(slot);
+		slotObject->writeReferenceToSlot<compressed>(slot);
 	}
 #if defined(OMR_SCAVENGER_TRACK_COPY_DISTANCE)
 	if (NULL != env->_effectiveCopyScanCache) {
-		env->_scavengerStats.countCopyDistance((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)slotObject->readReferenceFromSlot());
+		env->_scavengerStats.countCopyDistance((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)slotObject->readReferenceFromSlot<compressed>());
 	}
 #endif /* OMR_SCAVENGER_TRACK_COPY_DISTANCE */
 	return result;
 }
 
+MMINLINE bool
+MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObject)
+{
+	if (_extensions->compressObjectReferences()) {
+		return copyAndForward<true>(env, slotObject);
+	}
+	return copyAndForward<false>(env, slotObject);
+}
+
 bool
 MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, volatile omrobjectptr_t *slotPtr)
 {
@@ -1568,6 +1754,9 @@ MM_Scavenger::forwardingSucceeded(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 		scavStats->_flipCount += 1;
 		scavStats->_flipBytes += objectCopySizeInBytes;
 		scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
+		if (0 != (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE)) {
+			scavStats->_numaRemoteCopyBytes += objectCopySizeInBytes;
+		}
 	}
 }
 
@@ -1842,8 +2031,20 @@ MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader
 					copyHotField(env, destinationObjectPtr, hotFieldOffset3);
 				}
 			}
-		} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
-			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+		} else {
+			/* no hot fields from the language, use the ones learned for the class if any */
+			const uint8_t *learnedHotFieldOffsets = NULL;
+			if (NULL != _hotFieldTable) {
+				learnedHotFieldOffsets = _hotFieldTable->getHotFieldOffsets(_delegate.getHotFieldClassKey(env, destinationObjectPtr));
+			}
+			if (NULL != learnedHotFieldOffsets) {
+				for (uintptr_t i = 0; (i < SCAVENGER_HOT_FIELD_COUNT) && (U_8_MAX != learnedHotFieldOffsets[i]); i++) {
+					copyHotField(env, destinationObjectPtr, learnedHotFieldOffsets[i]);
+					env->_scavengerStats._hotFieldLearnedCopyCount += 1;
+				}
+			} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+				copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+			}
 		}
 	}
 }
@@ -1864,6 +2065,44 @@ MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinati
 	}
 }
 
+MMINLINE uintptr_t
+MM_Scavenger::getHotFieldSampleClassKey(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, bool resumed)
+{
+	uintptr_t classKey = 0;
+	if ((NULL != env->_hotFieldSamples) && (env->_hotFieldSampleCount < SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE)) {
+		if (resumed) {
+			if (objectPtr == env->_hotFieldSampleObject) {
+				classKey = env->_hotFieldSampleClassKey;
+			}
+		} else {
+			env->_hotFieldSampleCountdown -= 1;
+			if (0 == env->_hotFieldSampleCountdown) {
+				env->_hotFieldSampleCountdown = SCAVENGER_HOT_FIELD_SAMPLE_INTERVAL;
+				classKey = _delegate.getHotFieldClassKey(env, objectPtr);
+				env->_hotFieldSampleObject = objectPtr;
+				env->_hotFieldSampleClassKey = classKey;
+			}
+		}
+	}
+	return classKey;
+}
+
+MMINLINE void
+MM_Scavenger::recordHotFieldSample(MM_EnvironmentStandard *env, uintptr_t classKey, omrobjectptr_t objectPtr, GC_SlotObject *slotObject)
+{
+	if (env->_hotFieldSampleCount < SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE) {
+		/* hot fields are identified by slot index, as for the offsets supplied by the language */
+		intptr_t slotIndex = GC_SlotObject::subtractSlotAddresses(slotObject->readAddressFromSlot(), (fomrobject_t *)objectPtr, _extensions->compressObjectReferences());
+		if ((0 <= slotIndex) && (slotIndex < U_8_MAX)) {
+			MM_ScavengerHotFieldSample *sample = &env->_hotFieldSamples[env->_hotFieldSampleCount];
+			sample->classKey = classKey;
+			sample->slotIndex = (uintptr_t)slotIndex;
+			env->_hotFieldSampleCount += 1;
+			env->_scavengerStats._hotFieldSampleCount += 1;
+		}
+	}
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -1967,6 +2206,7 @@ MM_Scavenger::flushCopyScanCounts(MM_EnvironmentBase* env, bool majorFlush)
 	}
 }
 
+template <bool compressed>
 MMINLINE bool
 MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot)
 {
@@ -2011,14 +2251,23 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	uint64_t slotsScanned = 0;
 	bool shouldRemember = false;
 	GC_SlotObject *slotObject = NULL;
+	uintptr_t hotFieldClassKey = 0;
+	if (!objectScanner->isIndexableObject()) {
+		hotFieldClassKey = getHotFieldSampleClassKey(env, objectPtr, false);
+	}
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+	while (NULL != (slotObject = objectScanner->getNextSlot<compressed>())) {
+		/* A young child is sampled whether it is copied now or was already depth copied with its parent */
+		bool sampleSlot = (0 != hotFieldClassKey) && isObjectInEvacuateMemory(slotObject->readReferenceFromSlot<compressed>());
+		bool isSlotObjectInNewSpace = copyAndForward<compressed>(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
 		if (NULL != *copyCache) {
 			slotsCopied += 1;
 		}
+		if (sampleSlot) {
+			recordHotFieldSample(env, hotFieldClassKey, objectPtr, slotObject);
+		}
 		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
@@ -2042,6 +2291,16 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	return shouldRemember;
 }
 
+MMINLINE bool
+MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot)
+{
+	/* the reference mode is fixed for the life of the VM, so this is the same branch for every object */
+	if (_extensions->compressObjectReferences()) {
+		return scavengeObjectSlots<true>(env, scanCache, objectPtr, flags, rememberedSetSlot);
+	}
+	return scavengeObjectSlots<false>(env, scanCache, objectPtr, flags, rememberedSetSlot);
+}
+
 void
 MM_Scavenger::deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2)
 {
@@ -2097,6 +2356,7 @@ MM_Scavenger::deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t object
  * @param objectPtr current object being scanned
  * @param nextScanCache the updated scanCache after re-aliasing.
  */
+template <bool compressed>
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard *scanCache)
 {
@@ -2146,12 +2406,20 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	GC_SlotObject *slotObject;
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
+	uintptr_t hotFieldClassKey = 0;
+	if (!objectScanner->isIndexableObject()) {
+		hotFieldClassKey = getHotFieldSampleClassKey(env, objectPtr, scanCache->_hasPartiallyScannedObject);
+	}
 
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+	while (NULL != (slotObject = objectScanner->getNextSlot<compressed>())) {
+		bool sampleSlot = (0 != hotFieldClassKey) && isObjectInEvacuateMemory(slotObject->readReferenceFromSlot<compressed>());
 		/* If the object should be remembered and it is in old space, remember it */
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+		bool isSlotObjectInNewSpace = copyAndForward<compressed>(env, slotObject);
 		scanCache->_shouldBeRemembered |= isSlotObjectInNewSpace;
 		slotsScanned += 1;
+		if (sampleSlot) {
+			recordHotFieldSample(env, hotFieldClassKey, objectPtr, slotObject);
+		}
 
 		MM_CopyScanCacheStandard *copyCache = env->_effectiveCopyScanCache;
 		if (NULL != copyCache) {
@@ -2194,6 +2462,15 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	return NULL;
 }
 
+MMINLINE MM_CopyScanCacheStandard *
+MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard *scanCache)
+{
+	if (_extensions->compressObjectReferences()) {
+		return incrementalScavengeObjectSlots<true>(env, objectPtr, scanCache);
+	}
+	return incrementalScavengeObjectSlots<false>(env, objectPtr, scanCache);
+}
+
 /****************************************
  * Scan completion routines
  ****************************************
@@ -2817,6 +3094,19 @@ MM_Scavenger::scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr
 	return shouldBeRemembered;
 }
 
+MMINLINE void
+MM_Scavenger::prefetchRememberedObject(GC_SublistSlotIterator *remSetSlotIterator)
+{
+	uintptr_t distance = _extensions->scavengerRememberedSetPrefetchDistance;
+	if (0 != distance) {
+		/* the entry may carry the deferred removal flag, but the object it refers to is the same */
+		uintptr_t aheadEntry = remSetSlotIterator->peekSlot(distance) & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG;
+		if (0 != aheadEntry) {
+			MM_PREFETCH_WRITE(aheadEntry);
+		}
+	}
+}
+
 void
 MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 {
@@ -2845,9 +3135,12 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 		 * Objects that no longer need remembering will be pruned at the end of the scavenge.
 		 */
 		omrobjectptr_t objectPtr = NULL;
+		uintptr_t rememberedObjects = 0;
 		while (NULL != (objectPtr = rememberedSetOverflow.nextObject())) {
 			scavengeRememberedObject(env, objectPtr);
+			rememberedObjects += 1;
 		}
+		env->_scavengerStats._rememberedSetObjectCount += rememberedObjects;
 
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -3030,10 +3323,14 @@ MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
 	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
+		/* the indirect refs pass has already removed the empty slots, so every slot holds a remembered object */
+		uintptr_t rememberedObjects = 0;
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
 		omrobjectptr_t *slotPtr;
 		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
 			omrobjectptr_t objectPtr = *slotPtr;
+			prefetchRememberedObject(&remSetSlotIterator);
+			rememberedObjects += 1;
 
 			/* Ignore flaged for removal by the indirect refs pass */
 			if (0 == ((uintptr_t)objectPtr & DEFERRED_RS_REMOVE_FLAG)) {
@@ -3050,6 +3347,8 @@ MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
 			}
 		}
 
+		/* objects scanned by either pass are counted here, once per scavenge */
+		env->_scavengerStats._rememberedSetObjectCount += rememberedObjects;
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
 	}
 
@@ -3069,6 +3368,7 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 		omrobjectptr_t *slotPtr;
 		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
 			omrobjectptr_t objectPtr = *slotPtr;
+			prefetchRememberedObject(&remSetSlotIterator);
 
 			if(NULL != objectPtr) {
 				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
@@ -3111,6 +3411,7 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 		omrobjectptr_t *slotPtr;
 		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
 			omrobjectptr_t objectPtr = *slotPtr;
+			prefetchRememberedObject(&remSetSlotIterator);
 
 			if(NULL != objectPtr) {
 				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
@@ -3137,6 +3438,7 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 			}
 		}
 
+		env->_scavengerStats._rememberedSetObjectCount += numElements;
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
 	}
 
@@ -3149,6 +3451,9 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
 	if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -3173,6 +3478,8 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 		}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	}
+
+	env->_scavengerStats._rememberedSetScanTime += (omrtime_hires_clock() - startTime);
 }
 
 void
@@ -3369,7 +3676,7 @@ MM_Scavenger::releaseLocalCopyCache(MM_EnvironmentStandard *env, MM_CopyScanCach
 				/* We have two copy caches (deferred and current). Do they create contiguous memory with no objects (fully or partially) scanned in between? */
 				if ((env->_deferredCopyCache->cacheAlloc == cache->scanCurrent) && !cache->_hasPartiallyScannedObject) {
 					/* append current copy cache to the deferred one. yet, decide whether to keep deferring it or push it for scanning */
-					Assert_MM_true((cache->flags & ~OMR_SCAVENGER_CACHE_TYPE_HEAP) == (env->_deferredCopyCache->flags & ~OMR_SCAVENGER_CACHE_TYPE_HEAP));
+					Assert_MM_true((cache->flags & ~(OMR_SCAVENGER_CACHE_TYPE_HEAP | OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE)) == (env->_deferredCopyCache->flags & ~(OMR_SCAVENGER_CACHE_TYPE_HEAP | OMR_SCAVENGER_CACHE_TYPE_NUMA_REMOTE)));
 					Assert_MM_false(cache->flags & OMR_SCAVENGER_CACHE_TYPE_SPLIT_ARRAY);
 					if (remainderCreated) {
 						/* keep deferring the joint copy cache, there might be more appends to come */
@@ -3575,7 +3882,12 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	if (0 != _numaNodeCount) {
+		/* queue the work on the node that holds the objects to be scanned */
+		_scavengeCacheScanList.pushCacheForNode(env, newCacheEntry, getNUMANodeIndexForAddress(env, newCacheEntry->scanCurrent), _numaNodeCount);
+	} else {
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	}
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3654,6 +3966,14 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
+	if (0 != _numaNodeCount) {
+		bool remote = false;
+		MM_CopyScanCacheStandard *cache = _scavengeCacheScanList.popCacheForNode(env, getNUMANodeIndex(env), _numaNodeCount, &remote);
+		if (remote) {
+			env->_scavengerStats._numaRemoteScanCacheCount += 1;
+		}
+		return cache;
+	}
 	return _scavengeCacheScanList.popCache(env);
 }
 
@@ -4221,6 +4541,16 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	{
 		scavenge(env);
+		if (0 != _numaNodeCount) {
+			releaseNUMASurvivorReserves(env);
+		}
+	}
+
+	if (_extensions->freeListSizeIndex) {
+		/* Pool statistics cover both mutator and collector allocations until they are reset at the end of the scavenge */
+		MM_HeapStats heapStats;
+		_extensions->heap->mergeHeapStats(&heapStats);
+		_extensions->incrementScavengerStats._sizeIndexAllocCount = heapStats._allocSizeIndexCount;
 	}
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -4239,6 +4569,11 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 		/* defer to collector language interface */
 		_delegate.mainThreadGarbageCollect_scavengeComplete(env);
 
+		if (NULL != _hotFieldTable) {
+			/* no thread is copying, so hot fields learned in this cycle can be published for the next one */
+			_hotFieldTable->publish(env);
+		}
+
 		/* Reset the resizable flag of the semi space.
 		 * NOTE: Must be done before we attempt to resize the new space.
 		 */
@@ -4250,6 +4585,10 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 
 			calculateRecommendedWorkingThreads(env);
 
+			/* Cycle stats are cleared before the next scavenge task is dispatched, keep what it needs to estimate its work */
+			_lastCopiedBytes = _extensions->scavengerStats._flipBytes + _extensions->scavengerStats._tenureAggregateBytes;
+			_lastCopiedObjects = _extensions->scavengerStats._flipCount + _extensions->scavengerStats._tenureAggregateCount;
+
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -42,9 +42,11 @@
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "ScavengerHotFieldTable.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
+class GC_SublistSlotIterator;
 class MM_AllocateDescription;
 class MM_CollectorLanguageInterface;
 class MM_EnvironmentBase;
@@ -110,6 +112,8 @@ private:
 	uintptr_t _minTenureFailureSize;
 	uintptr_t _minSemiSpaceFailureSize;
 	uintptr_t _recommendedThreads; /** Number of threads recommended to the dispatcher for the Scavenge task */
+	uintptr_t _lastCopiedBytes; /**< Bytes copied (flipped and tenured) by the last successful scavenge */
+	uintptr_t _lastCopiedObjects; /**< Objects copied (flipped and tenured) by the last successful scavenge */
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
@@ -131,6 +135,22 @@ private:
 	void *_heapTop;  /**< Cached top pointer of heap */
 	MM_HeapRegionManager *_regionManager;
 
+	/**
+	 * Survivor memory set aside for the GC threads of one NUMA node for the duration of a scavenge.
+	 * Copy caches are bump allocated from the reserve with CAS, so the reserve is padded to its own cache line.
+	 */
+	struct NUMASurvivorReserve {
+		volatile uintptr_t alloc; /**< next free byte of the reserve */
+		uintptr_t top; /**< end of the reserve (exclusive) */
+		uintptr_t base; /**< start of the reserve, used to map survivor addresses back to their node */
+		uint8_t padding[64 - (3 * sizeof(uintptr_t))];
+	};
+	NUMASurvivorReserve *_numaSurvivorReserves; /**< one reserve per NUMA node (NULL unless scavengerNumaAware is set and there is more than one node) */
+	uintptr_t _numaReserveCapacity; /**< number of entries in _numaSurvivorReserves */
+	uintptr_t _numaNodeCount; /**< number of reserves carved for the current scavenge, 0 if NUMA aware copying is not active */
+
+	MM_ScavengerHotFieldTable *_hotFieldTable; /**< hot fields learned from scanning (NULL unless scavengerLearnHotFields is set) */
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	MM_MainGCThread _mainGCThread; /**< An object which manages the state of the main GC thread */
 	
@@ -256,6 +276,50 @@ public:
 	uintptr_t calculateCopyScanCacheSizeForWaitingThreads(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t waitingThreads);
 	uintptr_t calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t scanCacheCount);
 	MMINLINE uintptr_t calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env);
+	/**
+	 * Carve the free survivor memory into one reserve per NUMA node. Called by the main thread before the scavenge task is dispatched.
+	 * Leaves NUMA aware copying inactive for this scavenge if the survivor space can not be split.
+	 * @param env[in] the main GC thread
+	 */
+	void setupNUMASurvivorReserves(MM_EnvironmentStandard *env);
+
+	/**
+	 * Return the unused part of each NUMA survivor reserve to the survivor memory pool. Called by the main thread after the scavenge task completes.
+	 * @param env[in] the main GC thread
+	 */
+	void releaseNUMASurvivorReserves(MM_EnvironmentStandard *env);
+
+	/**
+	 * Allocate survivor memory for a copy cache from the NUMA reserve of the calling thread, or from the reserve of another node if the local one is exhausted.
+	 * @param env[in] the current GC thread
+	 * @param minimumSize[in] minimum number of bytes required
+	 * @param preferredSize[in] number of bytes to allocate if available (at least minimumSize)
+	 * @param addrBase[out] base of the allocated memory
+	 * @param addrTop[out] top of the allocated memory
+	 * @return true if memory was allocated
+	 */
+	bool allocateFromNUMASurvivorReserves(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t preferredSize, void* &addrBase, void* &addrTop);
+
+	/**
+	 * @return the zero based NUMA node index the GC thread works for during this scavenge
+	 */
+	MMINLINE uintptr_t getNUMANodeIndex(MM_EnvironmentBase *env) { return env->getWorkerID() % _numaNodeCount; }
+
+	/**
+	 * Find the NUMA node whose survivor reserve contains an address.
+	 * @return the zero based node index, or the node of the calling thread if the address is not in any reserve (e.g. tenure memory)
+	 */
+	MMINLINE uintptr_t
+	getNUMANodeIndexForAddress(MM_EnvironmentBase *env, void *addr)
+	{
+		for (uintptr_t i = 0; i < _numaNodeCount; i++) {
+			if (((uintptr_t)addr >= _numaSurvivorReserves[i].base) && ((uintptr_t)addr < _numaSurvivorReserves[i].top)) {
+				return i;
+			}
+		}
+		return getNUMANodeIndex(env);
+	}
+
 	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 	MM_CopyScanCacheStandard *reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 
@@ -267,6 +331,12 @@ public:
 	 */
 	MMINLINE bool copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObject);
 
+	/**
+	 * @see copyAndForward(MM_EnvironmentStandard *, GC_SlotObject *)
+	 * @tparam compressed must be the value of compressObjectReferences()
+	 */
+	template <bool compressed> MMINLINE bool copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObject);
+
 	MMINLINE bool copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_t *objectPtrIndirect);
 
 	/**
@@ -304,6 +374,20 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/* Decide whether the slots of an object about to be scanned are sampled for hot field learning.
+	 * @param objectPtr The object to be scanned
+	 * @param resumed True if the scan of the object is resumed, in which case it is sampled if it was when its scan started
+	 * @return the class key to record samples of the object with, 0 if the object is not sampled
+	 */
+	MMINLINE uintptr_t getHotFieldSampleClassKey(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, bool resumed);
+
+	/* Record that a child in evacuate space was reached through a slot of a sampled object.
+	 * @param classKey The class key of the sampled object
+	 * @param objectPtr The sampled object
+	 * @param slotObject The slot through which the child was reached
+	 */
+	MMINLINE void recordHotFieldSample(MM_EnvironmentStandard *env, uintptr_t classKey, omrobjectptr_t objectPtr, GC_SlotObject *slotObject);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -317,6 +401,14 @@ public:
 	 */
 	MMINLINE bool scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot);
 	MMINLINE MM_CopyScanCacheStandard *incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache);	
+
+	/**
+	 * The slot scanning loops of scavengeObjectSlots() and incrementalScavengeObjectSlots(), instantiated for
+	 * each reference mode so that the mode is tested once per object instead of for every slot.
+	 * @tparam compressed must be the value of compressObjectReferences()
+	 */
+	template <bool compressed> MMINLINE bool scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot);
+	template <bool compressed> MMINLINE MM_CopyScanCacheStandard *incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache);
 	
 	/**
 	 * For fast traversal of deep structure nodes - scan objects with self referencing fields with priority
@@ -355,6 +447,12 @@ public:
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	/**
+	 * Prefetch the object of the remembered set entry scavengerRememberedSetPrefetchDistance entries ahead of the scan,
+	 * so that its header and first slots are in cache by the time the scan reaches it.
+	 * @param[in] remSetSlotIterator iterator over the puddle being scanned
+	 */
+	MMINLINE void prefetchRememberedObject(GC_SublistSlotIterator *remSetSlotIterator);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
@@ -708,6 +806,14 @@ public:
 	virtual void kill(MM_EnvironmentBase *env);
 
 	MM_ScavengerDelegate* getDelegate() { return &_delegate; }
+	MM_ScavengerHotFieldTable* getHotFieldTable() { return _hotFieldTable; }
+
+	/**
+	 * Estimate the work of the next scavenge for the dispatcher: the bytes copied by the last successful
+	 * scavenge, plus the remembered objects to scan, each counted as an object of the last average copied size.
+	 * @return the estimated work in bytes, or 0 before the first scavenge completes or with concurrent scavenger
+	 */
+	uintptr_t getEstimatedScavengeWork(MM_EnvironmentBase *env);
 
 	/* Read Barrier Verifier specific methods */
 #if defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS)
@@ -931,6 +1037,8 @@ public:
 		, _minTenureFailureSize(UDATA_MAX)
 		, _minSemiSpaceFailureSize(UDATA_MAX)
 		, _recommendedThreads(UDATA_MAX)
+		, _lastCopiedBytes(0)
+		, _lastCopiedObjects(0)
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
@@ -947,6 +1055,10 @@ public:
 		, _heapBase(NULL)
 		, _heapTop(NULL)
 		, _regionManager(regionManager)
+		, _numaSurvivorReserves(NULL)
+		, _numaReserveCapacity(0)
+		, _numaNodeCount(0)
+		, _hotFieldTable(NULL)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _mainGCThread(env)
 		, _concurrentPhase(concurrent_phase_idle)
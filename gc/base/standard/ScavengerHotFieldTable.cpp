@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ScavengerHotFieldTable.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+MM_ScavengerHotFieldTable *
+MM_ScavengerHotFieldTable::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ScavengerHotFieldTable *table = (MM_ScavengerHotFieldTable *)env->getForge()->allocate(sizeof(MM_ScavengerHotFieldTable), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != table) {
+		new(table) MM_ScavengerHotFieldTable();
+		if (!table->initialize(env)) {
+			table->kill(env);
+			table = NULL;
+		}
+	}
+	return table;
+}
+
+void
+MM_ScavengerHotFieldTable::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerHotFieldTable::initialize(MM_EnvironmentBase *env)
+{
+	_entries = (Entry *)env->getForge()->allocate(SCAVENGER_HOT_FIELD_TABLE_SIZE * sizeof(Entry), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _entries) {
+		return false;
+	}
+
+	memset(_entries, 0, SCAVENGER_HOT_FIELD_TABLE_SIZE * sizeof(Entry));
+	for (uintptr_t i = 0; i < SCAVENGER_HOT_FIELD_TABLE_SIZE; i++) {
+		memset(_entries[i].candidateOffsets, U_8_MAX, sizeof(_entries[i].candidateOffsets));
+		memset(_entries[i].hotFieldOffsets, U_8_MAX, sizeof(_entries[i].hotFieldOffsets));
+	}
+
+	return true;
+}
+
+void
+MM_ScavengerHotFieldTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _entries) {
+		env->getForge()->free(_entries);
+		_entries = NULL;
+	}
+}
+
+MM_ScavengerHotFieldTable::Entry *
+MM_ScavengerHotFieldTable::findOrAddEntry(uintptr_t classKey)
+{
+	uintptr_t index = hash(classKey);
+	for (uintptr_t probe = 0; probe < SCAVENGER_HOT_FIELD_PROBE_LIMIT; probe++) {
+		Entry *entry = &_entries[(index + probe) & (SCAVENGER_HOT_FIELD_TABLE_SIZE - 1)];
+		if (classKey == entry->classKey) {
+			return entry;
+		}
+		if (0 == entry->classKey) {
+			/* offsets of a free entry are already unused, so a concurrent lookup finds nothing to copy */
+			entry->classKey = classKey;
+			return entry;
+		}
+	}
+	/* table is full around this class: it goes without hot fields */
+	return NULL;
+}
+
+void
+MM_ScavengerHotFieldTable::addSample(Entry *entry, uintptr_t slotIndex)
+{
+	uintptr_t minimumCandidate = 0;
+	for (uintptr_t i = 0; i < SCAVENGER_HOT_FIELD_CANDIDATES; i++) {
+		if (slotIndex == entry->candidateOffsets[i]) {
+			entry->candidateCounts[i] += 1;
+			return;
+		}
+		if (entry->candidateCounts[i] < entry->candidateCounts[minimumCandidate]) {
+			minimumCandidate = i;
+		}
+	}
+
+	/* space saving: the new field replaces the least counted candidate and inherits its count */
+	entry->candidateOffsets[minimumCandidate] = (uint8_t)slotIndex;
+	entry->candidateCounts[minimumCandidate] += 1;
+}
+
+void
+MM_ScavengerHotFieldTable::mergeSamples(MM_ScavengerHotFieldSample *samples, uintptr_t sampleCount)
+{
+	Entry *entry = NULL;
+	for (uintptr_t i = 0; i < sampleCount; i++) {
+		/* samples of one parent are recorded together */
+		if ((NULL == entry) || (samples[i].classKey != entry->classKey)) {
+			entry = findOrAddEntry(samples[i].classKey);
+		}
+		if (NULL != entry) {
+			addSample(entry, samples[i].slotIndex);
+		}
+	}
+}
+
+void
+MM_ScavengerHotFieldTable::publish(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < SCAVENGER_HOT_FIELD_TABLE_SIZE; i++) {
+		Entry *entry = &_entries[i];
+		if (0 == entry->classKey) {
+			continue;
+		}
+
+		uintptr_t totalCount = 0;
+		for (uintptr_t c = 0; c < SCAVENGER_HOT_FIELD_CANDIDATES; c++) {
+			totalCount += entry->candidateCounts[c];
+		}
+
+		if (totalCount >= SCAVENGER_HOT_FIELD_MINIMUM_SAMPLES) {
+			/* select the most counted candidates, in order, which take a large enough share of the samples */
+			bool selected[SCAVENGER_HOT_FIELD_CANDIDATES] = { false };
+			for (uintptr_t h = 0; h < SCAVENGER_HOT_FIELD_COUNT; h++) {
+				uintptr_t best = SCAVENGER_HOT_FIELD_CANDIDATES;
+				for (uintptr_t c = 0; c < SCAVENGER_HOT_FIELD_CANDIDATES; c++) {
+					if (!selected[c] && (U_8_MAX != entry->candidateOffsets[c])
+						&& ((SCAVENGER_HOT_FIELD_CANDIDATES == best) || (entry->candidateCounts[c] > entry->candidateCounts[best]))
+					) {
+						best = c;
+					}
+				}
+				if ((SCAVENGER_HOT_FIELD_CANDIDATES == best) || ((entry->candidateCounts[best] * SCAVENGER_HOT_FIELD_MINIMUM_SHARE) < totalCount)) {
+					for (; h < SCAVENGER_HOT_FIELD_COUNT; h++) {
+						entry->hotFieldOffsets[h] = U_8_MAX;
+					}
+					break;
+				}
+				selected[best] = true;
+				entry->hotFieldOffsets[h] = entry->candidateOffsets[best];
+			}
+		}
+
+		for (uintptr_t c = 0; c < SCAVENGER_HOT_FIELD_CANDIDATES; c++) {
+			entry->candidateCounts[c] /= 2;
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SCAVENGERHOTFIELDTABLE_HPP_)
+#define SCAVENGERHOTFIELDTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+#define SCAVENGER_HOT_FIELD_TABLE_SIZE 512 /**< entries in the table, must be a power of two */
+#define SCAVENGER_HOT_FIELD_PROBE_LIMIT 8 /**< entries probed for a class before giving up */
+#define SCAVENGER_HOT_FIELD_CANDIDATES 4 /**< field offsets counted for each class */
+#define SCAVENGER_HOT_FIELD_COUNT 3 /**< hot field offsets published for each class, as for the language supplied ones */
+#define SCAVENGER_HOT_FIELD_SAMPLE_INTERVAL 32 /**< one in this many scanned objects is sampled */
+#define SCAVENGER_HOT_FIELD_SAMPLE_BUFFER_SIZE 128 /**< samples a thread records in each scavenge */
+#define SCAVENGER_HOT_FIELD_MINIMUM_SAMPLES 16 /**< samples a class needs before its hot fields are published */
+#define SCAVENGER_HOT_FIELD_MINIMUM_SHARE 4 /**< a hot field accounts for at least 1/N of the samples of its class */
+
+/**
+ * A parent/child copy pair observed while scanning: the class of the parent and the slot through which a
+ * child in evacuate space was reached.
+ */
+struct MM_ScavengerHotFieldSample {
+	uintptr_t classKey;
+	uintptr_t slotIndex;
+};
+
+/**
+ * Hot fields learned by the scavenger, for languages which do not supply hot field offsets of their own.
+ * Scanning threads sample the fields through which young children are reached, classes being identified by
+ * the key returned by MM_ScavengerDelegate::getHotFieldClassKey(). At the end of each scavenge the most
+ * frequent fields of each class are published and are then depth copied with their parent by the following
+ * scavenges. Counts decay at each publication so that the table follows changes in the object graph.
+ *
+ * Samples are merged by one thread at a time while other threads may look up published offsets. Entries are
+ * never removed and published offsets only change while no thread is copying.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerHotFieldTable : public MM_BaseVirtual
+{
+private:
+	struct Entry {
+		volatile uintptr_t classKey; /**< key of the class, 0 if the entry is free */
+		uint32_t candidateCounts[SCAVENGER_HOT_FIELD_CANDIDATES]; /**< samples counted for each candidate */
+		uint8_t candidateOffsets[SCAVENGER_HOT_FIELD_CANDIDATES]; /**< slot index of each candidate, U_8_MAX if unused */
+		uint8_t hotFieldOffsets[SCAVENGER_HOT_FIELD_COUNT]; /**< published hot field slot indexes, U_8_MAX terminated */
+	};
+
+	Entry *_entries;
+
+protected:
+public:
+
+private:
+	MMINLINE uintptr_t hash(uintptr_t classKey) const
+	{
+		return ((classKey >> 3) ^ (classKey >> 12) ^ (classKey >> 21)) & (SCAVENGER_HOT_FIELD_TABLE_SIZE - 1);
+	}
+
+	Entry *findOrAddEntry(uintptr_t classKey);
+	void addSample(Entry *entry, uintptr_t slotIndex);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerHotFieldTable *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Count the samples recorded by a thread. Must not be called by more than one thread at a time.
+	 * @param[in] samples the samples
+	 * @param[in] sampleCount number of samples
+	 */
+	void mergeSamples(MM_ScavengerHotFieldSample *samples, uintptr_t sampleCount);
+
+	/**
+	 * Publish the hot fields of each class from its counts, then decay the counts.
+	 * Must only be called while no thread is copying.
+	 */
+	void publish(MM_EnvironmentBase *env);
+
+	/**
+	 * @param[in] classKey key of the class of an object
+	 * @return the hot field slot indexes of the class, U_8_MAX terminated, or NULL if none were published
+	 */
+	MMINLINE const uint8_t *
+	getHotFieldOffsets(uintptr_t classKey) const
+	{
+		if (0 != classKey) {
+			uintptr_t index = hash(classKey);
+			for (uintptr_t probe = 0; probe < SCAVENGER_HOT_FIELD_PROBE_LIMIT; probe++) {
+				const Entry *entry = &_entries[(index + probe) & (SCAVENGER_HOT_FIELD_TABLE_SIZE - 1)];
+				if (classKey == entry->classKey) {
+					return (U_8_MAX != entry->hotFieldOffsets[0]) ? entry->hotFieldOffsets : NULL;
+				}
+				if (0 == entry->classKey) {
+					break;
+				}
+			}
+		}
+		return NULL;
+	}
+
+	MM_ScavengerHotFieldTable()
+		: MM_BaseVirtual()
+		, _entries(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* SCAVENGERHOTFIELDTABLE_HPP_ */
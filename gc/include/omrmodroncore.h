@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2014, 2018 IBM Corp. and others
+ * Copyright (c) 2014, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -105,7 +105,7 @@ typedef U_8 Card;
 #define OMRVMSTATE_GC_COLLECTOR_METRONOME (J9VMSTATE_GC | 0x0018)
 #define OMRVMSTATE_GC_ALLOCATE_OBJECT (J9VMSTATE_GC | 0x0019)
 #define OMRVMSTATE_GC_ALLOCATE_INDEXABLE_OBJECT (J9VMSTATE_GC | 0x001A)
-#define OMRVMSTATE_GC_THIS_STATE_CAN_BE_REUSED_001B (J9VMSTATE_GC | 0x001B)
+#define OMRVMSTATE_GC_PRETOUCH_HEAP (J9VMSTATE_GC | 0x001B)
 #define OMRVMSTATE_GC_THIS_STATE_CAN_BE_REUSED_001C (J9VMSTATE_GC | 0x001C)
 #define OMRVMSTATE_GC_THIS_STATE_CAN_BE_REUSED_001D (J9VMSTATE_GC | 0x001D)
 #define OMRVMSTATE_GC_CONCURRENT_MARK_COMPLETE_TRACING (J9VMSTATE_GC | 0x001E)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2015, 2017 IBM Corp. and others
+ * Copyright (c) 2015, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -24,6 +24,7 @@
 #include "omr.h"
 #include "mminitcore.h"
 #include "objectdescription.h"
+#include "mmprivatehook.h"
 
 #include "AllocateDescription.hpp"
 #include "AtomicOperations.hpp"
@@ -43,6 +44,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParallelPreTouchTask.hpp"
 #include "VerboseManager.hpp"
 
 /* ****************
@@ -73,6 +75,33 @@ collectorCreationHelper(OMR_VM *omrVM, MM_EnvironmentBase *env)
 	return rc;
 }
 
+/**
+ * Fault in the committed memory of the heap on the GC threads, so that the first allocations
+ * and collections do not pay for it one page fault at a time.
+ */
+static void
+preTouchHeap(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uint64_t startTime = omrtime_hires_clock();
+
+	MM_ParallelPreTouchTask preTouchTask(env, extensions->dispatcher, extensions->heap);
+	extensions->dispatcher->run(env, &preTouchTask);
+
+	uint64_t endTime = omrtime_hires_clock();
+	TRIGGER_J9HOOK_MM_PRIVATE_HEAP_PRETOUCH(
+		extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		endTime,
+		J9HOOK_MM_PRIVATE_HEAP_PRETOUCH,
+		preTouchTask.getBytesTouched(),
+		preTouchTask.getThreadCount(),
+		extensions->heap->getPageSize(),
+		omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS)
+	);
+}
+
 static omr_error_t
 heapCreationHelper(OMR_VM *omrVM, MM_StartupManager *startupManager, bool createCollector)
 {
@@ -220,6 +249,9 @@ OMR_GC_InitializeDispatcherThreads(OMR_VMThread* omrVMThread)
 	if (!extensions->dispatcher->startUpThreads()) {
 		extensions->dispatcher->shutDownThreads();
 		rc = OMR_ERROR_INTERNAL;
+	} else if (extensions->preTouchHeap) {
+		/* nothing can allocate yet, so the heap can be touched in place */
+		preTouchHeap(MM_EnvironmentBase::getEnvironment(omrVMThread));
 	}
 
 	return rc;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -35,6 +35,8 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhFlushedBytes = 0;
+	_tlhIdleTrimCount = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -59,6 +61,7 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhFlushedBytes, stats->_tlhFlushedBytes);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -42,6 +42,8 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhFlushedBytes; 		/**< The amount of memory left unused in current and abandoned TLHs when they were flushed. */
+	uintptr_t _tlhIdleTrimCount; 		/**< Number of TLHs whose refresh size was trimmed at GC start because their thread was idle (added atomically to the global stats by each thread). */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -94,6 +96,8 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhFlushedBytes(0),
+		_tlhIdleTrimCount(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -27,11 +27,14 @@
 
 #include "CardCleaningStats.hpp"
 
+#include "AtomicOperations.hpp"
+
 void
 MM_CardCleaningStats::clear()
 {
 	_cardCleaningTime = 0;
 	_cardsCleaned = 0;
+	_cardsScanned = 0;
 }
 
 void
@@ -39,4 +42,13 @@ MM_CardCleaningStats::merge(MM_CardCleaningStats *statsToMerge)
 {
 	_cardCleaningTime += statsToMerge->_cardCleaningTime;
 	_cardsCleaned += statsToMerge->_cardsCleaned;
+	_cardsScanned += statsToMerge->_cardsScanned;
+}
+
+void
+MM_CardCleaningStats::mergeAtomic(MM_CardCleaningStats *statsToMerge)
+{
+	MM_AtomicOperations::addU64(&_cardCleaningTime, statsToMerge->_cardCleaningTime);
+	MM_AtomicOperations::add(&_cardsCleaned, statsToMerge->_cardsCleaned);
+	MM_AtomicOperations::add(&_cardsScanned, statsToMerge->_cardsScanned);
 }
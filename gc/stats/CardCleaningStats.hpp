@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,6 +34,7 @@ class MM_CardCleaningStats : public MM_Base
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardsScanned; /**< The number of cards examined while looking for cards to clean */
 	
 /* Function Members */
 public:
@@ -56,6 +57,24 @@ public:
 	 * @param[in] statsToMerge	Card cleaning statistics to merge with the receiver
 	 */
 	void merge(MM_CardCleaningStats *statsToMerge);
+
+	/**
+	 * Same as merge(), for a receiver which other threads merge into concurrently.
+	 *
+	 * @param[in] statsToMerge	Card cleaning statistics to merge with the receiver
+	 */
+	void mergeAtomic(MM_CardCleaningStats *statsToMerge);
+
+	/**
+	 * @param hiresClockFrequency ticks per second of omrtime_hires_clock()
+	 * @return the number of cards scanned per second of card cleaning time, or 0 if no time was recorded.
+	 * Card cleaning time is summed over threads, so this is the rate of a single thread.
+	 */
+	MMINLINE uint64_t
+	getCardsScannedPerSecond(uint64_t hiresClockFrequency)
+	{
+		return (0 == _cardCleaningTime) ? 0 : (((uint64_t)_cardsScanned * hiresClockFrequency) / _cardCleaningTime);
+	}
 	
 	MM_CardCleaningStats() :
 		MM_Base()
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -38,6 +38,7 @@ public:
 	uintptr_t _allocBytes;
 	uintptr_t _allocDiscardedBytes;
 	uintptr_t _allocSearchCount;
+	uintptr_t _allocSizeIndexCount; /**< Number of allocations whose free entry was found through the free list size index */
 	
 	/* Number of bytes free at end of last GC */
 	uintptr_t _lastFreeBytes;
@@ -54,6 +55,7 @@ public:
 		_allocBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeIndexCount(0),
 		_lastFreeBytes(0),
 		_activeFreeEntryCount(0),
 		_inactiveFreeEntryCount(0)
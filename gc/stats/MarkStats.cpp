@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -36,6 +36,10 @@ MM_MarkStats::clear()
 	_objectsScanned = 0;
 	_bytesScanned = 0;
 
+	_markMapClearTime = 0;
+	_markMapBytesCleared = 0;
+	_markMapBytesSkipped = 0;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
 	_syncStallTime = 0;
@@ -53,6 +57,10 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
 
+	_markMapClearTime += statsToMerge->_markMapClearTime;
+	_markMapBytesCleared += statsToMerge->_markMapBytesCleared;
+	_markMapBytesSkipped += statsToMerge->_markMapBytesSkipped;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
 	_syncStallCount += statsToMerge->_syncStallCount;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -49,6 +49,10 @@ public:
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
 
+	uint64_t _markMapClearTime; /**< The time, in hi-res ticks, spent clearing the mark map by the owning thread (or all threads) */
+	uintptr_t _markMapBytesCleared; /**< The number of mark map bytes cleared before marking */
+	uintptr_t _markMapBytesSkipped; /**< The number of mark map bytes left alone since sweep found them already clear */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
 	uint64_t _syncStallTime; /**< The time, in hi-res ticks, the thread spent stalled at a sync point */
@@ -103,6 +107,20 @@ public:
 	 */
 	MMINLINE uint64_t getScanTime() { return _scanTime; }
 
+	/**
+	 * Estimate the time saved by not clearing the mark map ranges which were already clear,
+	 * assuming they would have been cleared at the rate measured for the rest of the map.
+	 * @return the time saved, in hi-res ticks summed over all threads
+	 */
+	MMINLINE uint64_t
+	getMarkMapClearTimeSaved()
+	{
+		if (0 == _markMapBytesCleared) {
+			return 0;
+		}
+		return (uint64_t)((double)_markMapClearTime * ((double)_markMapBytesSkipped / (double)_markMapBytesCleared));
+	}
+
 	MM_MarkStats() :
 		MM_Base()
 		,_scanTime(0)
@@ -110,6 +128,9 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_markMapClearTime(0)
+		,_markMapBytesCleared(0)
+		,_markMapBytesSkipped(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		,_syncStallCount(0)
 		,_syncStallTime(0)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -43,6 +43,10 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_failedTenureLargest(0)
 	,_failedFlipCount(0)
 	,_failedFlipBytes(0)
+	,_numaRemoteCopyBytes(0)
+	,_numaRemoteScanCacheCount(0)
+	,_hotFieldSampleCount(0)
+	,_hotFieldLearnedCopyCount(0)
 	,_tenureAge(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	,_releaseScanListCount(0)
@@ -59,6 +63,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_workStallTime(0)
 	,_completeStallTime(0)
 	,_syncStallTime(0)
+	,_syncSpinWaitCount(0)
+	,_syncParkWaitCount(0)
 	,_totalDeepStructures(0)
 	,_totalObjsDeepScanned(0)
 	,_depthDeepestStructure(0)
@@ -89,6 +95,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
+	,_sizeIndexAllocCount(0)
+	,_rememberedSetObjectCount(0)
+	,_rememberedSetScanTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
@@ -145,6 +154,10 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_flipBytes = 0;
 	_tenureAggregateCount = 0;
 	_tenureAggregateBytes = 0;
+	_numaRemoteCopyBytes = 0;
+	_numaRemoteScanCacheCount = 0;
+	_hotFieldSampleCount = 0;
+	_hotFieldLearnedCopyCount = 0;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
 	_tenureLOACount = 0;
 	_tenureLOABytes = 0;
@@ -171,6 +184,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_workStallTime = 0;
 	_completeStallTime = 0;
 	_syncStallTime = 0;
+	_syncSpinWaitCount = 0;
+	_syncParkWaitCount = 0;
 	_totalDeepStructures = 0;
 	_totalObjsDeepScanned = 0;
 	_depthDeepestStructure = 0;
@@ -194,6 +209,11 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
 
+	_sizeIndexAllocCount = 0;
+
+	_rememberedSetObjectCount = 0;
+	_rememberedSetScanTime = 0;
+
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 
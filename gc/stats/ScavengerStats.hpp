@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -74,6 +74,10 @@ public:
 	uintptr_t _failedTenureLargest;
 	uintptr_t _failedFlipCount;
 	uintptr_t _failedFlipBytes;
+	uintptr_t _numaRemoteCopyBytes; /**< Bytes copied into survivor memory reserved for a NUMA node other than the copying thread's (-Xgc:scavengerNumaAware) */
+	uintptr_t _numaRemoteScanCacheCount; /**< Scan caches taken from the scan lists of another NUMA node (-Xgc:scavengerNumaAware) */
+	uintptr_t _hotFieldSampleCount; /**< Parent/child copy pairs sampled for hot field learning (-Xgc:scavengerLearnHotFields) */
+	uintptr_t _hotFieldLearnedCopyCount; /**< Learned hot fields followed to depth copy the children of copied objects (-Xgc:scavengerLearnHotFields) */
 	uintptr_t _tenureAge;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _releaseScanListCount;
@@ -90,6 +94,8 @@ public:
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
 	uint64_t _syncStallTime; /**< The time, in hi-res ticks, the thread spent stalled at a sync point */
+	uintptr_t _syncSpinWaitCount; /**< The number of sync point waits that ended while spinning (-Xgc:syncSpinCount) */
+	uintptr_t _syncParkWaitCount; /**< The number of sync point waits that ended parked on the synchronize monitor (-Xgc:syncSpinCount) */
 	uintptr_t _totalDeepStructures; /**<  The number of deep structures that are scanned with priority (number of deepScanOutline function calls) */
 	uintptr_t _totalObjsDeepScanned; /**< The total number of deep structure objects that are special treated (number of copyAndForward with priority)*/
 	uintptr_t _depthDeepestStructure; /**< Length of longest deep structure that is special treated */
@@ -140,6 +146,10 @@ public:
 	uintptr_t _tenureExpandedBytes; /**< Bytes by which the heap expanded in order to complete the collection */
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
+	uintptr_t _sizeIndexAllocCount; /**< Heap allocations since the previous collection that found their free entry through the free list size index (-Xgc:freeListSizeIndex) */
+
+	uintptr_t _rememberedSetObjectCount; /**< The number of remembered objects scanned from the remembered set list */
+	uint64_t _rememberedSetScanTime; /**< The time, in hi-res ticks, spent scanning the remembered set (summed over threads) */
 
 	uint64_t _leafObjectCount;
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
@@ -204,6 +214,18 @@ public:
 		_notifyStallTime += (endTime - startTime);
 	}
 
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	MMINLINE void
+	addToSyncWaitCount(bool parked)
+	{
+		if (parked) {
+			_syncParkWaitCount += 1;
+		} else {
+			_syncSpinWaitCount += 1;
+		}
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
 	/**
 	 * Get the total stall time
 	 * @return the time in hi-res ticks
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -57,6 +57,18 @@ public:
 
 	void *nextSlot();
 	void removeSlot();
+
+	/**
+	 * Peek at a slot ahead of the scan without consuming it, so that callers can prefetch what it refers to.
+	 * Slots may still be removed or modified before the scan reaches them, so the value is only a hint.
+	 * @param distance number of slots past the one most recently returned by nextSlot()
+	 * @return the contents of that slot, or 0 if it is beyond the end of the puddle
+	 */
+	MMINLINE uintptr_t
+	peekSlot(uintptr_t distance)
+	{
+		return (distance <= (uintptr_t)(_puddle->_listCurrent - _scanPtr)) ? _scanPtr[distance - 1] : 0;
+	}
 };
 
 #endif /* SUBLISTSLOTITERATOR_HPP_ */
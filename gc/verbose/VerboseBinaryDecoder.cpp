@@ -0,0 +1,587 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryDecoder.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Bytes of the log mapped at a time by default */
+#define DECODER_DEFAULT_WINDOW_SIZE ((uintptr_t)64 * 1024 * 1024)
+/* Windows start at a multiple of this, the allocation granularity of file mappings on all platforms */
+#define DECODER_WINDOW_ALIGNMENT ((uintptr_t)64 * 1024)
+/* Bytes of XML buffered by writeXML() */
+#define DECODER_XML_BUFFER_SIZE ((uintptr_t)64 * 1024)
+
+MM_VerboseBinaryDecoder::MM_VerboseBinaryDecoder(OMRPortLibrary *portLibrary, uintptr_t windowSize)
+	: MM_Base()
+	,_portLibrary(portLibrary)
+	,_windowSize(windowSize)
+	,_file(-1)
+	,_fileSize(0)
+	,_mapping(NULL)
+	,_readBuffer(NULL)
+	,_readBufferSize(0)
+	,_window(NULL)
+	,_windowOffset(0)
+	,_windowLength(0)
+	,_nextRecordOffset(0)
+	,_cursor(NULL)
+	,_recordEnd(NULL)
+	,_strings(NULL)
+	,_stringsUsed(0)
+	,_stringsSize(0)
+	,_dictionary(NULL)
+	,_dictionaryCount(0)
+	,_dictionarySize(0)
+	,_lastTimestamp(0)
+	,_tokenType(0)
+	,_name(NULL)
+	,_nameLength(0)
+	,_attributeCount(0)
+	,_failed(false)
+{
+	if (0 == _windowSize) {
+		_windowSize = DECODER_DEFAULT_WINDOW_SIZE;
+	}
+	_windowSize = ((_windowSize + DECODER_WINDOW_ALIGNMENT - 1) / DECODER_WINDOW_ALIGNMENT) * DECODER_WINDOW_ALIGNMENT;
+}
+
+MM_VerboseBinaryDecoder *
+MM_VerboseBinaryDecoder::newInstance(OMRPortLibrary *portLibrary, uintptr_t windowSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	MM_VerboseBinaryDecoder *decoder = (MM_VerboseBinaryDecoder *)omrmem_allocate_memory(sizeof(MM_VerboseBinaryDecoder), OMRMEM_CATEGORY_MM);
+	if (NULL != decoder) {
+		new(decoder) MM_VerboseBinaryDecoder(portLibrary, windowSize);
+		if (!decoder->initialize()) {
+			decoder->kill();
+			decoder = NULL;
+		}
+	}
+	return decoder;
+}
+
+void
+MM_VerboseBinaryDecoder::kill()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	tearDown();
+	omrmem_free_memory(this);
+}
+
+bool
+MM_VerboseBinaryDecoder::initialize()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	_stringsSize = 4096;
+	_strings = (char *)omrmem_allocate_memory(_stringsSize, OMRMEM_CATEGORY_MM);
+	_dictionarySize = 256;
+	_dictionary = (DictionaryEntry *)omrmem_allocate_memory(sizeof(DictionaryEntry) * _dictionarySize, OMRMEM_CATEGORY_MM);
+
+	return (NULL != _strings) && (NULL != _dictionary);
+}
+
+void
+MM_VerboseBinaryDecoder::tearDown()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	close();
+	omrmem_free_memory(_readBuffer);
+	_readBuffer = NULL;
+	omrmem_free_memory(_strings);
+	_strings = NULL;
+	omrmem_free_memory(_dictionary);
+	_dictionary = NULL;
+}
+
+bool
+MM_VerboseBinaryDecoder::isBinaryLog(OMRPortLibrary *portLibrary, const char *filename)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	bool result = false;
+
+	intptr_t file = omrfile_open(filename, EsOpenRead, 0);
+	if (-1 != file) {
+		char magic[VERBOSE_BINARY_MAGIC_LENGTH];
+		if (VERBOSE_BINARY_MAGIC_LENGTH == omrfile_read(file, magic, VERBOSE_BINARY_MAGIC_LENGTH)) {
+			result = (0 == memcmp(magic, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH));
+		}
+		omrfile_close(file);
+	}
+	return result;
+}
+
+bool
+MM_VerboseBinaryDecoder::open(const char *filename)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	close();
+	_failed = false;
+	_file = omrfile_open(filename, EsOpenRead, 0);
+	if (-1 == _file) {
+		return false;
+	}
+
+	int64_t fileSize = omrfile_flength(_file);
+	const uint8_t *magic = NULL;
+	if (fileSize > 0) {
+		_fileSize = (uint64_t)fileSize;
+		magic = map(0, VERBOSE_BINARY_MAGIC_LENGTH);
+	}
+	if ((NULL == magic) || (0 != memcmp(magic, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH))) {
+		close();
+		return false;
+	}
+
+	_nextRecordOffset = VERBOSE_BINARY_MAGIC_LENGTH;
+	return true;
+}
+
+void
+MM_VerboseBinaryDecoder::close()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	unmap();
+	if (-1 != _file) {
+		omrfile_close(_file);
+		_file = -1;
+	}
+	_fileSize = 0;
+	_cursor = NULL;
+	_recordEnd = NULL;
+	_stringsUsed = 0;
+	_dictionaryCount = 0;
+	_lastTimestamp = 0;
+	_tokenType = 0;
+}
+
+const uint8_t *
+MM_VerboseBinaryDecoder::map(uint64_t offset, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if ((offset + length) > _fileSize) {
+		return NULL;
+	}
+	if ((NULL != _window) && (offset >= _windowOffset) && ((offset + length) <= (_windowOffset + _windowLength))) {
+		return _window + (offset - _windowOffset);
+	}
+
+	unmap();
+	uint64_t windowOffset = offset - (offset % DECODER_WINDOW_ALIGNMENT);
+	uint64_t windowLength = OMR_MAX((uint64_t)_windowSize, (offset - windowOffset) + length);
+	windowLength = OMR_MIN(windowLength, _fileSize - windowOffset);
+
+	_mapping = omrmmap_map_file(_file, windowOffset, (uintptr_t)windowLength, NULL, OMRPORT_MMAP_FLAG_READ, OMRMEM_CATEGORY_MM);
+	if (NULL != _mapping) {
+		_window = (const uint8_t *)_mapping->pointer;
+	} else {
+		/* read the window instead */
+		if (_readBufferSize < windowLength) {
+			omrmem_free_memory(_readBuffer);
+			_readBuffer = (uint8_t *)omrmem_allocate_memory((uintptr_t)windowLength, OMRMEM_CATEGORY_MM);
+			_readBufferSize = (NULL == _readBuffer) ? 0 : (uintptr_t)windowLength;
+			if (NULL == _readBuffer) {
+				return NULL;
+			}
+		}
+		if ((int64_t)windowOffset != omrfile_seek(_file, (int64_t)windowOffset, EsSeekSet)) {
+			return NULL;
+		}
+		uintptr_t bytesRead = 0;
+		while (bytesRead < windowLength) {
+			intptr_t result = omrfile_read(_file, _readBuffer + bytesRead, (intptr_t)(windowLength - bytesRead));
+			if (result <= 0) {
+				return NULL;
+			}
+			bytesRead += result;
+		}
+		_window = _readBuffer;
+	}
+	_windowOffset = windowOffset;
+	_windowLength = (uintptr_t)windowLength;
+
+	return _window + (offset - _windowOffset);
+}
+
+void
+MM_VerboseBinaryDecoder::unmap()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if (NULL != _mapping) {
+		omrmmap_unmap_file(_mapping);
+		_mapping = NULL;
+	}
+	_window = NULL;
+	_windowOffset = 0;
+	_windowLength = 0;
+}
+
+bool
+MM_VerboseBinaryDecoder::nextRecord()
+{
+	if (-1 == _file) {
+		return false;
+	}
+
+	/* a record cut short is the end of a log still being written */
+	uintptr_t available = (uintptr_t)OMR_MIN((uint64_t)VERBOSE_BINARY_VARINT_MAXIMUM_LENGTH, _fileSize - _nextRecordOffset);
+	if (0 == available) {
+		return false;
+	}
+	const uint8_t *header = map(_nextRecordOffset, available);
+	uint64_t payloadLength = 0;
+	uintptr_t headerLength = (NULL == header) ? 0 : MM_VerboseBinaryFormat::readVarint(header, header + available, &payloadLength);
+	if ((0 == headerLength) || ((_nextRecordOffset + headerLength + payloadLength) > _fileSize)) {
+		return false;
+	}
+
+	const uint8_t *record = map(_nextRecordOffset, (uintptr_t)(headerLength + payloadLength));
+	if (NULL == record) {
+		_failed = true;
+		return false;
+	}
+	_cursor = record + headerLength;
+	_recordEnd = _cursor + payloadLength;
+	_nextRecordOffset += headerLength + payloadLength;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::readVarint(uint64_t *value)
+{
+	uintptr_t length = MM_VerboseBinaryFormat::readVarint(_cursor, _recordEnd, value);
+	_cursor += length;
+	return 0 != length;
+}
+
+bool
+MM_VerboseBinaryDecoder::readString(uint64_t id, const char **string, uintptr_t *length)
+{
+	if (id >= _dictionaryCount) {
+		return false;
+	}
+	*string = _strings + _dictionary[id].offset;
+	*length = _dictionary[id].length;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::defineString(const uint8_t *string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	if ((_stringsSize - _stringsUsed) < length) {
+		uintptr_t newSize = OMR_MAX(2 * _stringsSize, _stringsUsed + length);
+		char *newStrings = (char *)omrmem_allocate_memory(newSize, OMRMEM_CATEGORY_MM);
+		if (NULL == newStrings) {
+			return false;
+		}
+		memcpy(newStrings, _strings, _stringsUsed);
+		omrmem_free_memory(_strings);
+		_strings = newStrings;
+		_stringsSize = newSize;
+	}
+	if (_dictionaryCount == _dictionarySize) {
+		uintptr_t newSize = 2 * _dictionarySize;
+		DictionaryEntry *newDictionary = (DictionaryEntry *)omrmem_allocate_memory(sizeof(DictionaryEntry) * newSize, OMRMEM_CATEGORY_MM);
+		if (NULL == newDictionary) {
+			return false;
+		}
+		memcpy(newDictionary, _dictionary, sizeof(DictionaryEntry) * _dictionaryCount);
+		omrmem_free_memory(_dictionary);
+		_dictionary = newDictionary;
+		_dictionarySize = newSize;
+	}
+
+	memcpy(_strings + _stringsUsed, string, length);
+	_dictionary[_dictionaryCount].offset = _stringsUsed;
+	_dictionary[_dictionaryCount].length = length;
+	_stringsUsed += length;
+	_dictionaryCount += 1;
+	return true;
+}
+
+bool
+MM_VerboseBinaryDecoder::nextToken()
+{
+	_tokenType = 0;
+	_attributeCount = 0;
+
+	while (!_failed) {
+		if (_cursor == _recordEnd) {
+			if (!nextRecord()) {
+				return false;
+			}
+			continue;
+		}
+
+		uintptr_t type = *_cursor++;
+		uint64_t value = 0;
+		switch (type) {
+		case MM_VerboseBinaryFormat::TOKEN_DEFINE:
+			if (!readVarint(&value) || (value > (uint64_t)(_recordEnd - _cursor)) || !defineString(_cursor, (uintptr_t)value)) {
+				_failed = true;
+				break;
+			}
+			_cursor += value;
+			continue;
+		case MM_VerboseBinaryFormat::TOKEN_TEXT:
+			if (!readVarint(&value) || (value > (uint64_t)(_recordEnd - _cursor))) {
+				_failed = true;
+				break;
+			}
+			_name = (const char *)_cursor;
+			_nameLength = (uintptr_t)value;
+			_cursor += value;
+			_tokenType = type;
+			return true;
+		case MM_VerboseBinaryFormat::TOKEN_START:
+		case MM_VerboseBinaryFormat::TOKEN_EMPTY:
+		case MM_VerboseBinaryFormat::TOKEN_END:
+		{
+			uint64_t attributeCount = 0;
+			if (!readVarint(&value) || !readString(value, &_name, &_nameLength)) {
+				_failed = true;
+				break;
+			}
+			if (MM_VerboseBinaryFormat::TOKEN_END != type) {
+				if (!readVarint(&attributeCount) || (attributeCount > VERBOSE_BINARY_MAXIMUM_ATTRIBUTES)) {
+					_failed = true;
+					break;
+				}
+			}
+			for (uintptr_t i = 0; !_failed && (i < attributeCount); i++) {
+				Attribute *attribute = &_attributes[i];
+				if (!readVarint(&value) || !readString(value, &attribute->name, &attribute->nameLength) || (_cursor == _recordEnd)) {
+					_failed = true;
+					break;
+				}
+				attribute->type = *_cursor++;
+				attribute->scale = 0;
+				attribute->string = NULL;
+				attribute->stringLength = 0;
+				switch (attribute->type) {
+				case MM_VerboseBinaryFormat::VALUE_UNSIGNED:
+					_failed = !readVarint(&attribute->value);
+					break;
+				case MM_VerboseBinaryFormat::VALUE_DECIMAL:
+					_failed = !readVarint(&attribute->value) || (_cursor == _recordEnd);
+					if (!_failed) {
+						attribute->scale = *_cursor++;
+						_failed = (attribute->scale > 19);
+					}
+					break;
+				case MM_VerboseBinaryFormat::VALUE_STRING:
+					_failed = !readVarint(&value) || (value > (uint64_t)(_recordEnd - _cursor));
+					if (!_failed) {
+						attribute->string = (const char *)_cursor;
+						attribute->stringLength = (uintptr_t)value;
+						_cursor += value;
+					}
+					break;
+				case MM_VerboseBinaryFormat::VALUE_INTERNED:
+					_failed = !readVarint(&value) || !readString(value, &attribute->string, &attribute->stringLength);
+					break;
+				case MM_VerboseBinaryFormat::VALUE_TIMESTAMP:
+					_failed = !readVarint(&value);
+					if (!_failed) {
+						_lastTimestamp += MM_VerboseBinaryFormat::zigzagDecode(value);
+						attribute->value = (uint64_t)_lastTimestamp;
+						attribute->string = attribute->timestamp;
+						attribute->stringLength = MM_VerboseBinaryFormat::printTimestamp(_lastTimestamp, attribute->timestamp);
+					}
+					break;
+				default:
+					_failed = true;
+					break;
+				}
+			}
+			if (_failed) {
+				break;
+			}
+			_attributeCount = (uintptr_t)attributeCount;
+			_tokenType = type;
+			return true;
+		}
+		default:
+			_failed = true;
+			break;
+		}
+	}
+
+	return false;
+}
+
+const MM_VerboseBinaryDecoder::Attribute *
+MM_VerboseBinaryDecoder::findAttribute(const char *name)
+{
+	uintptr_t length = strlen(name);
+	for (uintptr_t i = 0; i < _attributeCount; i++) {
+		if ((length == _attributes[i].nameLength) && (0 == memcmp(name, _attributes[i].name, length))) {
+			return &_attributes[i];
+		}
+	}
+	return NULL;
+}
+
+double
+MM_VerboseBinaryDecoder::attributeAsDouble(const Attribute *attribute)
+{
+	double result = 0.0;
+	switch (attribute->type) {
+	case MM_VerboseBinaryFormat::VALUE_UNSIGNED:
+	case MM_VerboseBinaryFormat::VALUE_DECIMAL:
+		result = MM_VerboseBinaryFormat::numberToDouble(attribute->value, attribute->scale);
+		break;
+	case MM_VerboseBinaryFormat::VALUE_TIMESTAMP:
+		result = (double)(int64_t)attribute->value;
+		break;
+	default:
+		/* the value is followed by other data, so copy it to terminate it */
+		if (attribute->stringLength < 64) {
+			char value[64];
+			memcpy(value, attribute->string, attribute->stringLength);
+			value[attribute->stringLength] = '\0';
+			result = strtod(value, NULL);
+		}
+		break;
+	}
+	return result;
+}
+
+/**
+ * Output buffer of writeXML().
+ */
+class MM_VerboseBinaryXMLOutput
+{
+public:
+	OMRPortLibrary *_portLibrary;
+	intptr_t _file;
+	char *_buffer;
+	uintptr_t _used;
+	bool _failed;
+
+	MM_VerboseBinaryXMLOutput(OMRPortLibrary *portLibrary, intptr_t file, char *buffer)
+		: _portLibrary(portLibrary)
+		, _file(file)
+		, _buffer(buffer)
+		, _used(0)
+		, _failed(false)
+	{}
+
+	void
+	flush()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		if ((0 != _used) && ((intptr_t)_used != omrfile_write(_file, _buffer, (intptr_t)_used))) {
+			_failed = true;
+		}
+		_used = 0;
+	}
+
+	void
+	append(const char *bytes, uintptr_t length)
+	{
+		if (length > (DECODER_XML_BUFFER_SIZE - _used)) {
+			flush();
+			if (length > DECODER_XML_BUFFER_SIZE) {
+				OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+				if ((intptr_t)length != omrfile_write(_file, bytes, (intptr_t)length)) {
+					_failed = true;
+				}
+				return;
+			}
+		}
+		memcpy(_buffer + _used, bytes, length);
+		_used += length;
+	}
+};
+
+bool
+MM_VerboseBinaryDecoder::writeXML(intptr_t outputFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+	char *buffer = (char *)omrmem_allocate_memory(DECODER_XML_BUFFER_SIZE, OMRMEM_CATEGORY_MM);
+	if (NULL == buffer) {
+		return false;
+	}
+	MM_VerboseBinaryXMLOutput output(_portLibrary, outputFile, buffer);
+
+	/* elements are indented by their depth below the root element, as written by the verbose handlers */
+	uintptr_t depth = 0;
+	while (!output._failed && nextToken()) {
+		if (MM_VerboseBinaryFormat::TOKEN_END == _tokenType) {
+			depth = (0 == depth) ? 0 : (depth - 1);
+		}
+		for (uintptr_t i = 1; i < depth; i++) {
+			output.append("  ", 2);
+		}
+
+		switch (_tokenType) {
+		case MM_VerboseBinaryFormat::TOKEN_TEXT:
+			output.append(_name, _nameLength);
+			break;
+		case MM_VerboseBinaryFormat::TOKEN_END:
+			output.append("</", 2);
+			output.append(_name, _nameLength);
+			output.append(">", 1);
+			break;
+		default:
+			output.append("<", 1);
+			output.append(_name, _nameLength);
+			for (uintptr_t i = 0; i < _attributeCount; i++) {
+				Attribute *attribute = &_attributes[i];
+				output.append(" ", 1);
+				output.append(attribute->name, attribute->nameLength);
+				output.append("=\"", 2);
+				if ((MM_VerboseBinaryFormat::VALUE_UNSIGNED == attribute->type) || (MM_VerboseBinaryFormat::VALUE_DECIMAL == attribute->type)) {
+					char number[24];
+					output.append(number, MM_VerboseBinaryFormat::printNumber(attribute->value, attribute->scale, number));
+				} else {
+					output.append(attribute->string, attribute->stringLength);
+				}
+				output.append("\"", 1);
+			}
+			if (MM_VerboseBinaryFormat::TOKEN_EMPTY == _tokenType) {
+				output.append(" />", 3);
+			} else {
+				output.append(">", 1);
+				depth += 1;
+			}
+			break;
+		}
+		output.append("\n", 1);
+	}
+	output.flush();
+	omrmem_free_memory(buffer);
+
+	return !_failed && !output._failed;
+}
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYDECODER_HPP_)
+#define VERBOSEBINARYDECODER_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "Base.hpp"
+#include "VerboseBinaryFormat.hpp"
+
+/**
+ * Streaming decoder for binary verbose GC logs (see VerboseBinaryFormat.hpp).
+ *
+ * The log is mapped a window at a time, so a log of any size is read in memory bounded by the window
+ * size (or by the largest record, if that is larger). Tokens are returned one at a time; the strings of
+ * a token are only valid until the next call to nextToken().
+ *
+ * The decoder only needs a port library, so tools can use it outside of a VM.
+ */
+class MM_VerboseBinaryDecoder : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+public:
+	struct Attribute {
+		const char *name;
+		uintptr_t nameLength;
+		uintptr_t type; /**< MM_VerboseBinaryFormat::VALUE_* */
+		uint64_t value; /**< VALUE_UNSIGNED and VALUE_DECIMAL (scaled by 10 to the power scale), milliseconds since 1970 for VALUE_TIMESTAMP */
+		uintptr_t scale;
+		const char *string; /**< VALUE_STRING, VALUE_INTERNED and VALUE_TIMESTAMP, as written in the XML (still escaped) */
+		uintptr_t stringLength;
+		char timestamp[VERBOSE_BINARY_TIMESTAMP_LENGTH]; /**< the text of a VALUE_TIMESTAMP */
+	};
+
+protected:
+private:
+	struct DictionaryEntry {
+		uintptr_t offset; /**< offset of the string in _strings */
+		uintptr_t length;
+	};
+
+	OMRPortLibrary *_portLibrary;
+	uintptr_t _windowSize; /**< bytes of the log mapped at a time */
+
+	intptr_t _file;
+	uint64_t _fileSize;
+	J9MmapHandle *_mapping; /**< the window when the file can be mapped */
+	uint8_t *_readBuffer; /**< the window when the file can not be mapped */
+	uintptr_t _readBufferSize;
+	const uint8_t *_window;
+	uint64_t _windowOffset; /**< file offset of the window */
+	uintptr_t _windowLength;
+
+	uint64_t _nextRecordOffset; /**< file offset of the record following the current one */
+	const uint8_t *_cursor; /**< the next token of the current record */
+	const uint8_t *_recordEnd;
+
+	char *_strings; /**< the strings defined in the log so far */
+	uintptr_t _stringsUsed;
+	uintptr_t _stringsSize;
+	DictionaryEntry *_dictionary;
+	uintptr_t _dictionaryCount;
+	uintptr_t _dictionarySize;
+	int64_t _lastTimestamp; /**< the last timestamp read from the log, timestamps are relative to it */
+
+	uintptr_t _tokenType; /**< MM_VerboseBinaryFormat::TOKEN_* of the current token */
+	const char *_name; /**< element name, or the text of a TOKEN_TEXT */
+	uintptr_t _nameLength;
+	uintptr_t _attributeCount;
+	Attribute _attributes[VERBOSE_BINARY_MAXIMUM_ATTRIBUTES];
+	bool _failed;
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * @param[in] windowSize bytes of the log to map at a time, 0 for the default
+	 */
+	static MM_VerboseBinaryDecoder *newInstance(OMRPortLibrary *portLibrary, uintptr_t windowSize = 0);
+	void kill();
+
+	/**
+	 * @return true if the file starts with the magic bytes of a binary verbose GC log
+	 */
+	static bool isBinaryLog(OMRPortLibrary *portLibrary, const char *filename);
+
+	bool open(const char *filename);
+	void close();
+
+	/**
+	 * Advance to the next token of the log.
+	 * @return false at the end of the log or if the log is corrupt (see hasFailed())
+	 */
+	bool nextToken();
+
+	/**
+	 * Convert the rest of the log to XML.
+	 * @param[in] outputFile file descriptor to write the XML to
+	 * @return false if the log is corrupt or the XML could not be written
+	 */
+	bool writeXML(intptr_t outputFile);
+
+	/**
+	 * @return the attribute of the current element with the given name, or NULL
+	 */
+	const Attribute *findAttribute(const char *name);
+
+	/**
+	 * @return the value of an attribute as a double (milliseconds since 1970 for a timestamp), 0 if it is not a number
+	 */
+	static double attributeAsDouble(const Attribute *attribute);
+
+	MMINLINE bool hasFailed() { return _failed; }
+	MMINLINE uintptr_t getTokenType() { return _tokenType; }
+	MMINLINE const char *getName() { return _name; }
+	MMINLINE uintptr_t getNameLength() { return _nameLength; }
+	MMINLINE uintptr_t getAttributeCount() { return _attributeCount; }
+	MMINLINE const Attribute *getAttribute(uintptr_t index) { return &_attributes[index]; }
+
+protected:
+	MM_VerboseBinaryDecoder(OMRPortLibrary *portLibrary, uintptr_t windowSize);
+	bool initialize();
+	void tearDown();
+
+private:
+	/**
+	 * Make a range of the file available in the window.
+	 * @return the range, or NULL if it could not be read
+	 */
+	const uint8_t *map(uint64_t offset, uintptr_t length);
+	void unmap();
+
+	/**
+	 * Move to the next record of the log.
+	 * @return false at the end of the log, or if it is corrupt
+	 */
+	bool nextRecord();
+
+	bool readVarint(uint64_t *value);
+	bool readString(uint64_t id, const char **string, uintptr_t *length);
+	bool defineString(const uint8_t *string, uintptr_t length);
+};
+
+#endif /* VERBOSEBINARYDECODER_HPP_ */
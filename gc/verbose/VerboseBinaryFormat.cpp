@@ -0,0 +1,352 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryFormat.hpp"
+
+#include <string.h>
+
+static MMINLINE bool
+isMarkupSpace(char c)
+{
+	return (' ' == c) || ('\n' == c) || ('\r' == c) || ('\t' == c);
+}
+
+static MMINLINE bool
+isMarkupNameChar(char c)
+{
+	return !isMarkupSpace(c) && ('=' != c) && ('>' != c) && ('/' != c) && ('"' != c) && ('<' != c);
+}
+
+static MMINLINE bool
+isMarkupDigit(char c)
+{
+	return ('0' <= c) && ('9' >= c);
+}
+
+/**
+ * Find the end of a markup item which is not a tag.
+ * @return the character after terminator, or NULL if the text ends first
+ */
+static const char *
+findMarkupEnd(const char *cursor, const char *end, const char *terminator)
+{
+	uintptr_t terminatorLength = strlen(terminator);
+	while ((uintptr_t)(end - cursor) >= terminatorLength) {
+		if (0 == memcmp(cursor, terminator, terminatorLength)) {
+			return cursor + terminatorLength;
+		}
+		cursor += 1;
+	}
+	return NULL;
+}
+
+MM_VerboseBinaryFormat::MarkupResult
+MM_VerboseBinaryFormat::parseMarkup(const char *cursor, const char *end, bool complete, Markup *markup, const char **next)
+{
+	while ((cursor < end) && isMarkupSpace(*cursor)) {
+		cursor += 1;
+	}
+	if (cursor == end) {
+		*next = end;
+		return MARKUP_NONE;
+	}
+
+	markup->attributeCount = 0;
+	markup->name = cursor;
+	markup->type = TOKEN_TEXT;
+
+	if ('<' != *cursor) {
+		const char *textEnd = (const char *)memchr(cursor, '<', end - cursor);
+		if (NULL == textEnd) {
+			if (!complete) {
+				return MARKUP_INCOMPLETE;
+			}
+			textEnd = end;
+		}
+		*next = textEnd;
+		while (isMarkupSpace(textEnd[-1])) {
+			textEnd -= 1;
+		}
+		markup->nameLength = textEnd - cursor;
+		return MARKUP_FOUND;
+	}
+
+	const char *itemEnd = NULL;
+	if (((cursor + 1) < end) && (('?' == cursor[1]) || ('!' == cursor[1]))) {
+		/* declarations and comments are kept as text, comments may contain '>' */
+		const char *terminator = (((end - cursor) >= 4) && (0 == memcmp(cursor, "<!--", 4))) ? "-->" : ">";
+		itemEnd = findMarkupEnd(cursor + 2, end, terminator);
+	} else {
+		const char *p = cursor + 1;
+		bool isEndTag = (p < end) && ('/' == *p);
+		if (isEndTag) {
+			p += 1;
+		}
+		markup->name = p;
+		while ((p < end) && isMarkupNameChar(*p)) {
+			p += 1;
+		}
+		markup->nameLength = p - markup->name;
+		bool malformed = (0 == markup->nameLength);
+
+		while (!malformed && (p < end)) {
+			while ((p < end) && isMarkupSpace(*p)) {
+				p += 1;
+			}
+			if (p == end) {
+				break;
+			}
+			if ('>' == *p) {
+				markup->type = isEndTag ? TOKEN_END : TOKEN_START;
+				*next = p + 1;
+				return MARKUP_FOUND;
+			}
+			if (isEndTag) {
+				malformed = true;
+				break;
+			}
+			if ('/' == *p) {
+				if ((p + 1) == end) {
+					break;
+				}
+				if ('>' == p[1]) {
+					markup->type = TOKEN_EMPTY;
+					*next = p + 2;
+					return MARKUP_FOUND;
+				}
+				malformed = true;
+				break;
+			}
+
+			/* attribute="value" */
+			Markup::Attribute *attribute = &markup->attributes[markup->attributeCount];
+			attribute->name = p;
+			while ((p < end) && isMarkupNameChar(*p)) {
+				p += 1;
+			}
+			attribute->nameLength = p - attribute->name;
+			while ((p < end) && isMarkupSpace(*p)) {
+				p += 1;
+			}
+			if (p == end) {
+				break;
+			}
+			if ((0 == attribute->nameLength) || ('=' != *p) || (VERBOSE_BINARY_MAXIMUM_ATTRIBUTES == markup->attributeCount)) {
+				malformed = true;
+				break;
+			}
+			p += 1;
+			while ((p < end) && isMarkupSpace(*p)) {
+				p += 1;
+			}
+			if (p == end) {
+				break;
+			}
+			if ('"' != *p) {
+				malformed = true;
+				break;
+			}
+			p += 1;
+			const char *quote = (const char *)memchr(p, '"', end - p);
+			if (NULL == quote) {
+				p = end;
+				break;
+			}
+			attribute->value = p;
+			attribute->valueLength = quote - p;
+			markup->attributeCount += 1;
+			p = quote + 1;
+		}
+
+		/* the tag is malformed or the text ends within it, keep what there is of it as text */
+		markup->type = TOKEN_TEXT;
+		markup->name = cursor;
+		markup->attributeCount = 0;
+		itemEnd = malformed ? findMarkupEnd(cursor + 1, end, ">") : NULL;
+	}
+
+	if (NULL == itemEnd) {
+		if (!complete) {
+			return MARKUP_INCOMPLETE;
+		}
+		itemEnd = end;
+	}
+	markup->nameLength = itemEnd - cursor;
+	*next = itemEnd;
+	return MARKUP_FOUND;
+}
+
+bool
+MM_VerboseBinaryFormat::parseNumber(const char *value, uintptr_t length, uintptr_t *type, uint64_t *mantissa, uintptr_t *scale)
+{
+	/* up to 19 digits always fit in a uint64_t */
+	uintptr_t digits = 0;
+	uintptr_t fractionDigits = 0;
+	uint64_t result = 0;
+	uintptr_t i = 0;
+
+	while ((i < length) && isMarkupDigit(value[i])) {
+		if (19 == digits) {
+			return false;
+		}
+		result = (result * 10) + (value[i] - '0');
+		digits += 1;
+		i += 1;
+	}
+	/* a leading zero would not print back */
+	if ((0 == digits) || ((1 < digits) && ('0' == value[0]))) {
+		return false;
+	}
+	if (i < length) {
+		if ('.' != value[i]) {
+			return false;
+		}
+		i += 1;
+		while ((i < length) && isMarkupDigit(value[i])) {
+			if (19 == digits) {
+				return false;
+			}
+			result = (result * 10) + (value[i] - '0');
+			digits += 1;
+			fractionDigits += 1;
+			i += 1;
+		}
+		if ((0 == fractionDigits) || (i < length)) {
+			return false;
+		}
+	}
+
+	*type = (0 == fractionDigits) ? VALUE_UNSIGNED : VALUE_DECIMAL;
+	*mantissa = result;
+	*scale = fractionDigits;
+	return true;
+}
+
+uintptr_t
+MM_VerboseBinaryFormat::printNumber(uint64_t mantissa, uintptr_t scale, char *buffer)
+{
+	char digits[20];
+	uintptr_t digitCount = 0;
+	do {
+		digits[digitCount++] = (char)('0' + (mantissa % 10));
+		mantissa /= 10;
+	} while (0 != mantissa);
+	while (digitCount <= scale) {
+		digits[digitCount++] = '0';
+	}
+
+	uintptr_t length = 0;
+	while (0 != digitCount) {
+		if (digitCount == scale) {
+			buffer[length++] = '.';
+		}
+		buffer[length++] = digits[--digitCount];
+	}
+	return length;
+}
+
+bool
+MM_VerboseBinaryFormat::parseTimestamp(const char *value, uintptr_t length, int64_t *millis)
+{
+	/* digit positions of YYYY-MM-DDTHH:MM:SS.mmm, the other positions must hold the separators */
+	static const char layout[] = "0000-00-00T00:00:00.000";
+	if (VERBOSE_BINARY_TIMESTAMP_LENGTH != length) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < VERBOSE_BINARY_TIMESTAMP_LENGTH; i++) {
+		if (('0' == layout[i]) ? !isMarkupDigit(value[i]) : (layout[i] != value[i])) {
+			return false;
+		}
+	}
+
+	int64_t year = ((value[0] - '0') * 1000) + ((value[1] - '0') * 100) + ((value[2] - '0') * 10) + (value[3] - '0');
+	int64_t month = ((value[5] - '0') * 10) + (value[6] - '0');
+	int64_t day = ((value[8] - '0') * 10) + (value[9] - '0');
+	int64_t hour = ((value[11] - '0') * 10) + (value[12] - '0');
+	int64_t minute = ((value[14] - '0') * 10) + (value[15] - '0');
+	int64_t second = ((value[17] - '0') * 10) + (value[18] - '0');
+	int64_t milli = ((value[20] - '0') * 100) + ((value[21] - '0') * 10) + (value[22] - '0');
+
+	/* days from 1970-01-01 in the proleptic Gregorian calendar */
+	int64_t yearOfMarch = year - ((month <= 2) ? 1 : 0);
+	int64_t era = yearOfMarch / 400;
+	int64_t yearOfEra = yearOfMarch - (era * 400);
+	int64_t dayOfYear = (((153 * (month + ((month > 2) ? -3 : 9))) + 2) / 5) + day - 1;
+	int64_t dayOfEra = (yearOfEra * 365) + (yearOfEra / 4) - (yearOfEra / 100) + dayOfYear;
+	int64_t days = (era * 146097) + dayOfEra - 719468;
+
+	*millis = (((((days * 24) + hour) * 60 + minute) * 60 + second) * 1000) + milli;
+
+	/* out of range fields (month 13, February 30, ...) would not print back */
+	char printed[VERBOSE_BINARY_TIMESTAMP_LENGTH];
+	printTimestamp(*millis, printed);
+	return 0 == memcmp(printed, value, VERBOSE_BINARY_TIMESTAMP_LENGTH);
+}
+
+uintptr_t
+MM_VerboseBinaryFormat::printTimestamp(int64_t millis, char *buffer)
+{
+	int64_t days = millis / 86400000;
+	int64_t milliOfDay = millis % 86400000;
+	if (milliOfDay < 0) {
+		milliOfDay += 86400000;
+		days -= 1;
+	}
+
+	/* civil date of a day from 1970-01-01 in the proleptic Gregorian calendar */
+	days += 719468;
+	int64_t era = ((days >= 0) ? days : (days - 146096)) / 146097;
+	int64_t dayOfEra = days - (era * 146097);
+	int64_t yearOfEra = (dayOfEra - (dayOfEra / 1460) + (dayOfEra / 36524) - (dayOfEra / 146096)) / 365;
+	int64_t dayOfYear = dayOfEra - ((365 * yearOfEra) + (yearOfEra / 4) - (yearOfEra / 100));
+	int64_t monthOfMarch = ((5 * dayOfYear) + 2) / 153;
+	int64_t day = dayOfYear - (((153 * monthOfMarch) + 2) / 5) + 1;
+	int64_t month = (monthOfMarch < 10) ? (monthOfMarch + 3) : (monthOfMarch - 9);
+	int64_t year = yearOfEra + (era * 400) + ((month <= 2) ? 1 : 0);
+
+	int64_t fields[] = { year, month, day, milliOfDay / 3600000, (milliOfDay / 60000) % 60, (milliOfDay / 1000) % 60, milliOfDay % 1000 };
+	static const uintptr_t widths[] = { 4, 2, 2, 2, 2, 2, 3 };
+	static const char separators[] = "--T::.";
+	uintptr_t length = 0;
+	for (uintptr_t field = 0; field < 7; field++) {
+		int64_t fieldValue = fields[field];
+		for (uintptr_t digit = widths[field]; digit > 0; digit--) {
+			buffer[length + digit - 1] = (char)('0' + ((fieldValue % 10 + 10) % 10));
+			fieldValue /= 10;
+		}
+		length += widths[field];
+		if (field < 6) {
+			buffer[length++] = separators[field];
+		}
+	}
+	return length;
+}
+
+double
+MM_VerboseBinaryFormat::numberToDouble(uint64_t mantissa, uintptr_t scale)
+{
+	double divisor = 1.0;
+	for (uintptr_t i = 0; i < scale; i++) {
+		divisor *= 10.0;
+	}
+	return (double)mantissa / divisor;
+}
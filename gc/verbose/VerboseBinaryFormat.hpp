@@ -0,0 +1,199 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/**
+ * Layout of binary verbose GC logs (-Xgc:binaryLogging).
+ *
+ * A binary log starts with the VERBOSE_BINARY_MAGIC bytes followed by records. Each record is the varint
+ * length of its payload followed by the payload, a sequence of tokens describing the XML markup of one
+ * flush of the verbose writer chain:
+ *
+ *   TOKEN_DEFINE  varint length, bytes     adds a string to the dictionary of the file, ids count up from 0
+ *   TOKEN_START   varint name id, varint attribute count, attributes    opens an element
+ *   TOKEN_EMPTY   as TOKEN_START           an element without content
+ *   TOKEN_END     varint name id           closes an element
+ *   TOKEN_TEXT    varint length, bytes     any other markup (declarations, comments) or text, verbatim
+ *
+ * An attribute is the varint id of its name, a value type byte and the value:
+ *
+ *   VALUE_UNSIGNED  varint                 a decimal integer
+ *   VALUE_DECIMAL   varint mantissa, byte number of fractional digits
+ *   VALUE_STRING    varint length, bytes   the value as written in the XML (still escaped)
+ *   VALUE_INTERNED  varint id              a string held in the dictionary
+ *   VALUE_TIMESTAMP zigzag varint          a YYYY-MM-DDTHH:MM:SS.mmm timestamp, as milliseconds from the previous
+ *                                          timestamp of the file (from 0 for the first)
+ *
+ * Numbers are only encoded as such when printing them back gives the original text, so a log converts
+ * back to the XML it was encoded from, except for whitespace between markup. Every file of a rotating
+ * log has its own dictionary and can be decoded on its own.
+ */
+#define VERBOSE_BINARY_MAGIC "OMRVGCB\001"
+#define VERBOSE_BINARY_MAGIC_LENGTH 8
+/* Longest encoding of a varint holding a uint64_t */
+#define VERBOSE_BINARY_VARINT_MAXIMUM_LENGTH 10
+/* Length of a YYYY-MM-DDTHH:MM:SS.mmm timestamp */
+#define VERBOSE_BINARY_TIMESTAMP_LENGTH 23
+/* Most attributes an element may have to be encoded as an element rather than text */
+#define VERBOSE_BINARY_MAXIMUM_ATTRIBUTES 64
+
+class MM_VerboseBinaryFormat
+{
+public:
+	enum {
+		TOKEN_DEFINE = 1,
+		TOKEN_START = 2,
+		TOKEN_EMPTY = 3,
+		TOKEN_END = 4,
+		TOKEN_TEXT = 5
+	};
+
+	enum {
+		VALUE_UNSIGNED = 1,
+		VALUE_DECIMAL = 2,
+		VALUE_STRING = 3,
+		VALUE_INTERNED = 4,
+		VALUE_TIMESTAMP = 5
+	};
+
+	/**
+	 * One markup item of verbose XML text, pointing into the text it was parsed from.
+	 */
+	struct Markup {
+		struct Attribute {
+			const char *name;
+			uintptr_t nameLength;
+			const char *value;
+			uintptr_t valueLength;
+		};
+
+		uintptr_t type; /**< TOKEN_START, TOKEN_EMPTY, TOKEN_END or TOKEN_TEXT */
+		const char *name; /**< element name, or the text of a TOKEN_TEXT */
+		uintptr_t nameLength;
+		uintptr_t attributeCount;
+		Attribute attributes[VERBOSE_BINARY_MAXIMUM_ATTRIBUTES];
+	};
+
+	typedef enum {
+		MARKUP_FOUND = 0, /**< a markup item was parsed */
+		MARKUP_NONE, /**< only whitespace remains */
+		MARKUP_INCOMPLETE /**< the text ends within a markup item */
+	} MarkupResult;
+
+	/**
+	 * Parse the next markup item of verbose XML text. Markup which is not a plain start, empty or end tag
+	 * (declarations, comments, malformed tags) and text between tags are returned as TOKEN_TEXT.
+	 * @param[in] cursor start of the text
+	 * @param[in] end end of the text
+	 * @param[in] complete true if the text ends at end, false if more may follow (the item is then reported incomplete)
+	 * @param[out] markup the item parsed
+	 * @param[out] next where parsing should continue
+	 * @return MARKUP_FOUND, MARKUP_NONE or MARKUP_INCOMPLETE
+	 */
+	static MarkupResult parseMarkup(const char *cursor, const char *end, bool complete, Markup *markup, const char **next);
+
+	/**
+	 * Parse an attribute value as a number which prints back to the same text.
+	 * @param[out] type VALUE_UNSIGNED or VALUE_DECIMAL
+	 * @param[out] mantissa the value, scaled by 10 to the power scale
+	 * @param[out] scale number of fractional digits
+	 * @return true if the value is such a number
+	 */
+	static bool parseNumber(const char *value, uintptr_t length, uintptr_t *type, uint64_t *mantissa, uintptr_t *scale);
+
+	/**
+	 * Print a number as parsed by parseNumber.
+	 * @return number of characters written, at most 22
+	 */
+	static uintptr_t printNumber(uint64_t mantissa, uintptr_t scale, char *buffer);
+
+	/**
+	 * Parse an attribute value as a YYYY-MM-DDTHH:MM:SS.mmm timestamp which prints back to the same text.
+	 * @param[out] millis milliseconds since 1970-01-01T00:00:00.000
+	 * @return true if the value is such a timestamp
+	 */
+	static bool parseTimestamp(const char *value, uintptr_t length, int64_t *millis);
+
+	/**
+	 * Print a timestamp as parsed by parseTimestamp.
+	 * @return number of characters written, VERBOSE_BINARY_TIMESTAMP_LENGTH
+	 */
+	static uintptr_t printTimestamp(int64_t millis, char *buffer);
+
+	/**
+	 * @return the number as parsed by parseNumber, as a double
+	 */
+	static double numberToDouble(uint64_t mantissa, uintptr_t scale);
+
+	static MMINLINE uintptr_t
+	writeVarint(uint8_t *cursor, uint64_t value)
+	{
+		uintptr_t length = 0;
+		while (value >= 0x80) {
+			cursor[length++] = (uint8_t)(value | 0x80);
+			value >>= 7;
+		}
+		cursor[length++] = (uint8_t)value;
+		return length;
+	}
+
+	static MMINLINE uint64_t
+	zigzagEncode(int64_t value)
+	{
+		return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+	}
+
+	static MMINLINE int64_t
+	zigzagDecode(uint64_t value)
+	{
+		return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+	}
+
+	/**
+	 * Read a varint.
+	 * @return number of bytes read, 0 if the varint does not end before end or is too long
+	 */
+	static MMINLINE uintptr_t
+	readVarint(const uint8_t *cursor, const uint8_t *end, uint64_t *value)
+	{
+		uint64_t result = 0;
+		uintptr_t length = 0;
+		while ((cursor + length < end) && (length < VERBOSE_BINARY_VARINT_MAXIMUM_LENGTH)) {
+			uint8_t byte = cursor[length];
+			result |= ((uint64_t)(byte & 0x7F)) << (7 * length);
+			length += 1;
+			if (0 == (byte & 0x80)) {
+				*value = result;
+				return length;
+			}
+		}
+		return 0;
+	}
+};
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2022 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -40,6 +40,9 @@
 
 static void verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerTaskThreadCount(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerHeapPreTouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerHeapUncommit(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -103,6 +106,9 @@ MM_VerboseHandlerOutput::enableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_TASK_THREAD_COUNT, verboseHandlerTaskThreadCount, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_PRETOUCH, verboseHandlerHeapPreTouch, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_UNCOMMIT, verboseHandlerHeapUncommit, OMR_GET_CALLSITE(), (void *)this);
 
 	return ;
 }
@@ -113,6 +119,9 @@ MM_VerboseHandlerOutput::disableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_TASK_THREAD_COUNT, verboseHandlerTaskThreadCount, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_PRETOUCH, verboseHandlerHeapPreTouch, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_UNCOMMIT, verboseHandlerHeapUncommit, NULL);
 
 	return ;
 }
@@ -315,8 +324,37 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	}
 
 	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
+	if (_extensions->workPacketDeques) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"workPacketDeques\" value=\"true\" />");
+	}
+	if (0 != _extensions->gcThreadSyncSpinCount) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"syncSpinCount\" value=\"%zu\" />", _extensions->gcThreadSyncSpinCount);
+	}
+	if (0 != _extensions->dispatcherHotWindow) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"dispatcherHotWindow\" value=\"%zu\" />", _extensions->dispatcherHotWindow);
+	}
+	if (_extensions->taskThreadCountModel) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"taskThreadCountModel\" value=\"true\" />");
+	}
+	if (_extensions->transparentHugePages) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePages\" value=\"true\" />");
+	}
+	if (_extensions->preTouchHeap) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"preTouchHeap\" value=\"true\" />");
+	}
+	if (_extensions->deferredHeapUncommit) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"deferredHeapUncommit\" value=\"true\" />");
+		buffer->formatAndOutput(env, 1, "<attribute name=\"heapUncommitRate\" value=\"%zu\" />", _extensions->heapUncommitRate);
+	}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	buffer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
+	if (_extensions->scavengerNumaAware) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerNumaAware\" value=\"true\" />");
+	}
+	if (_extensions->scavengerLearnHotFields) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerLearnHotFields\" value=\"true\" />");
+	}
+	buffer->formatAndOutput(env, 1, "<attribute name=\"scavengerRememberedSetPrefetchDistance\" value=\"%zu\" />", _extensions->scavengerRememberedSetPrefetchDistance);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	buffer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", _extensions->_numaManager.getAffinityLeaderCount());
@@ -819,6 +857,10 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		if (_extensions->tlhAdaptiveSizing) {
+			writer->formatAndOutput(env, 1, "<tlh-stats refreshes=\"%zu\" reused=\"%zu\" discardedBytes=\"%zu\" flushedBytes=\"%zu\" idleTrimmed=\"%zu\" />",
+					systemStats->_tlhRefreshCountFresh, systemStats->_tlhRefreshCountReused, systemStats->_tlhDiscardedBytes, systemStats->_tlhFlushedBytes, systemStats->_tlhIdleTrimCount);
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -1030,6 +1072,62 @@ MM_VerboseHandlerOutput::outputCollectorHeapResizeInfo(MM_EnvironmentBase *env,
 	writer->formatAndOutput(env, indent, "<heap-resize type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" />", resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString);
 }
 
+void
+MM_VerboseHandlerOutput::handleTaskThreadCount(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_TaskThreadCountEvent* event = (MM_TaskThreadCountEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	char tagTemplate[200];
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
+	writer->formatAndOutput(env, _manager->getIndentLevel(), "<task-threads id=\"%zu\" task=\"%s\" work=\"%zu\" threads=\"%zu\" maxthreads=\"%zu\" timems=\"%llu.%03llu\" wakeupcostus=\"%.3f\" workrate=\"%.3f\" %s />",
+			_manager->getIdAndIncrement(), event->taskName, event->workSize, event->threadCount, event->maxThreadCount,
+			event->durationMicros / 1000, event->durationMicros % 1000, event->wakeupCost, event->workRate, tagTemplate);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+void
+MM_VerboseHandlerOutput::handleHeapPreTouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapPreTouchEvent* event = (MM_HeapPreTouchEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	/* startup covers everything from the heap being initialized until it is ready for the first allocation */
+	uint64_t startupMicros = omrtime_hires_delta(_manager->getInitializedTime(), event->timestamp, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	char tagTemplate[200];
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
+	writer->formatAndOutput(env, _manager->getIndentLevel(), "<heap-pretouch id=\"%zu\" bytes=\"%zu\" threads=\"%zu\" pagesize=\"%zu\" timems=\"%llu.%03llu\" startupms=\"%llu.%03llu\" %s />",
+			_manager->getIdAndIncrement(), event->bytesTouched, event->threadCount, event->pageSize,
+			event->durationMicros / 1000, event->durationMicros % 1000, startupMicros / 1000, startupMicros % 1000, tagTemplate);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+void
+MM_VerboseHandlerOutput::handleHeapUncommit(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapUncommitEvent* event = (MM_HeapUncommitEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	char tagTemplate[200];
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
+	writer->formatAndOutput(env, _manager->getIndentLevel(), "<heap-uncommit id=\"%zu\" deferred=\"%zu\" pending=\"%zu\" uncommitted=\"%zu\" cancelled=\"%zu\" uncommitms=\"%llu.%03llu\" %s />",
+			_manager->getIdAndIncrement(), event->deferredBytes, event->pendingBytes, event->uncommittedBytes, event->cancelledBytes,
+			event->uncommitMicros / 1000, event->uncommitMicros % 1000, tagTemplate);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 const char *
 MM_VerboseHandlerOutput::getSubSpaceType(uintptr_t typeFlags)
 {
@@ -1100,6 +1198,24 @@ verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* event
 	((MM_VerboseHandlerOutput*)userData)->handleHeapResize(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerTaskThreadCount(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleTaskThreadCount(hook, eventNum, eventData);
+}
+
+void
+verboseHandlerHeapPreTouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleHeapPreTouch(hook, eventNum, eventData);
+}
+
+void
+verboseHandlerHeapUncommit(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleHeapUncommit(hook, eventNum, eventData);
+}
+
 void
 MM_VerboseHandlerOutput::handleGCOPOuterStanzaStart(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess)
 {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -510,6 +510,30 @@ public:
 
 	void handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the verbose line for a task run with the thread count chosen by the task thread count model.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleTaskThreadCount(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Write the verbose line for the committed heap memory faulted in by the GC threads at startup.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleHeapPreTouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Write the verbose line for memory removed from the heap and queued for the background uncommit thread.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleHeapUncommit(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
 	/**
 	 * Write the verbose stanza for the excessive gc raised event.
 	 * @param hook Hook interface used by the JVM.
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -116,6 +116,12 @@ public:
 	 */
 	virtual void closeStreams(MM_EnvironmentBase *env);
 
+	/**
+	 * Wait until all output mechanisms on the receiver have written out what has been reported so far.
+	 * @param env vm thread.
+	 */
+	virtual void flushStreams(MM_EnvironmentBase *env);
+
 	MMINLINE MM_VerboseWriterChain* getWriterChain() { return _writerChain; }
 	MM_VerboseHandlerOutput* getVerboseHandlerOutput() { return _verboseHandlerOutput; }
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -35,7 +35,9 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 7
 } WriterType;
 
 /**
@@ -75,6 +77,12 @@ public:
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Wait until output written so far has reached the stream. Only writers which write from
+	 * another thread need to do anything.
+	 */
+	virtual void flushStream(MM_EnvironmentBase *env) {}
+
 	MMINLINE WriterType getType(void) { return _type; }
 
 	MMINLINE bool isActive(void) { return _isActive; }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2016 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -294,6 +294,15 @@ MM_VerboseWriterFileLogging::closeStream(MM_EnvironmentBase *env)
 	closeFile(env);
 }
 
+/**
+ * @return true if output rotates through several files
+ */
+bool
+MM_VerboseWriterFileLogging::isRotatingFiles()
+{
+	return rotating_files == _mode;
+}
+
 /**
  * Flushes the verbose buffer to the output stream.
  * Also cycles the output files if necessary.
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -77,6 +77,8 @@ protected:
 	bool initializeFilename(MM_EnvironmentBase *env, const char *filename);
 	bool initializeTokens(MM_EnvironmentBase *env);
 	char* expandFilename(MM_EnvironmentBase *env, uintptr_t currentFile);
+
+	bool isRotatingFiles();
 private:
 };
 
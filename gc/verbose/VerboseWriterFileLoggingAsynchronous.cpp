@@ -0,0 +1,441 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrutil.h"
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+/* Ring record header asking the writer thread to move on to the next rotating log file */
+#define ASYNC_RECORD_ROTATE UDATA_MAX
+/* Longest time the writer thread waits before looking at the ring again, as reporting threads never block to wake it */
+#define ASYNC_WRITER_POLL_MILLIS 100
+/* Smallest ring, room for a few typical stanzas */
+#define ASYNC_RING_MINIMUM_SIZE ((uintptr_t)64 * 1024)
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_ringHead(0)
+	,_ringTail(0)
+	,_droppedRecords(0)
+	,_droppedBytes(0)
+	,_reportedDroppedRecords(0)
+	,_reportedDroppedBytes(0)
+	,_writerMonitor(NULL)
+	,_threadState(STATE_NOT_STARTED)
+	,_writerWaiting(false)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance and starts the writer thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (NULL == _writerMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_writerMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_writerMonitor")) {
+			return false;
+		}
+	}
+
+	if (NULL == _ring) {
+		uintptr_t ringSize = ASYNC_RING_MINIMUM_SIZE;
+		while (ringSize < extensions->asyncLoggingBufferSize) {
+			ringSize <<= 1;
+		}
+		_ring = (char *)extensions->getForge()->allocate(ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+		_ringSize = ringSize;
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startWriterThread(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the writer thread once it has written everything queued.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (NULL != _writerMonitor) {
+		stopWriterThread(env);
+		omrthread_monitor_destroy(_writerMonitor);
+		_writerMonitor = NULL;
+	}
+	closeFile(env);
+	extensions->getForge()->free(_ring);
+	_ring = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * Only called before the writer thread starts or by the writer thread itself.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	const char *header = getHeader(env);
+	omrfile_write_text(_logFileDescriptor, header, strlen(header));
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			writeToFile(env, buffer->contents(), strlen(buffer->contents()));
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ * Only called while the writer thread is not running or by the writer thread itself.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		const char *footer = getFooter(env);
+		omrfile_write_text(_logFileDescriptor, footer, strlen(footer));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeToFile(MM_EnvironmentBase *env, const char *bytes, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/* as for the synchronous writer, try again to open a file that failed to open */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, bytes, (intptr_t)length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, bytes, (intptr_t)length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+	enqueueRecord(env, length, string, length);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (isRotatingFiles()) {
+		_currentCycle = (_currentCycle + 1) % _numCycles;
+		if (0 == _currentCycle) {
+			/* the writer thread moves on to the next file once it has written the stanzas of this cycle */
+			enqueueRecord(env, ASYNC_RECORD_ROTATE, NULL, 0);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::enqueueRecord(MM_EnvironmentBase *env, uintptr_t header, const char *string, uintptr_t length)
+{
+	uintptr_t recordSize = sizeof(uintptr_t) + MM_Math::roundToCeiling(sizeof(uintptr_t), length);
+	uintptr_t head = _ringHead;
+	uintptr_t tail = _ringTail;
+	/* the writer thread must have finished reading the space freed by the tail before it is overwritten */
+	MM_AtomicOperations::readWriteBarrier();
+
+	if ((STATE_RUNNING != _threadState) || (recordSize > (_ringSize - (head - tail)))) {
+		/* never wait for the writer thread */
+		_droppedBytes += length;
+		/* the bytes of a dropped record must be visible once the record is counted */
+		MM_AtomicOperations::writeBarrier();
+		_droppedRecords += 1;
+		return;
+	}
+
+	uintptr_t mask = _ringSize - 1;
+	*(uintptr_t *)(_ring + (head & mask)) = header;
+	uintptr_t offset = (head + sizeof(uintptr_t)) & mask;
+	uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+	memcpy(_ring + offset, string, firstPart);
+	memcpy(_ring, string + firstPart, length - firstPart);
+
+	/* publish the record only once its contents are visible */
+	MM_AtomicOperations::writeBarrier();
+	_ringHead = head + recordSize;
+
+	if (_writerWaiting && (0 == omrthread_monitor_try_enter(_writerMonitor))) {
+		omrthread_monitor_notify_all(_writerMonitor);
+		omrthread_monitor_exit(_writerMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drainRing(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t head = _ringHead;
+	MM_AtomicOperations::readBarrier();
+	uintptr_t tail = _ringTail;
+	uintptr_t mask = _ringSize - 1;
+
+	uintptr_t droppedRecords = _droppedRecords;
+	if (droppedRecords != _reportedDroppedRecords) {
+		MM_AtomicOperations::readBarrier();
+		uintptr_t droppedBytes = _droppedBytes;
+		char note[128];
+		uintptr_t noteLength = omrstr_printf(note, sizeof(note), "<!-- %zu verbose stanzas (%zu bytes) dropped, the log file could not keep up -->\n",
+				droppedRecords - _reportedDroppedRecords, droppedBytes - _reportedDroppedBytes);
+		writeToFile(env, note, noteLength);
+		_reportedDroppedRecords = droppedRecords;
+		_reportedDroppedBytes = droppedBytes;
+	}
+
+	while (tail != head) {
+		uintptr_t header = *(uintptr_t *)(_ring + (tail & mask));
+		uintptr_t length = 0;
+		if (ASYNC_RECORD_ROTATE == header) {
+			closeFile(env);
+			_currentFile = (_currentFile + 1) % _numFiles;
+			openFile(env, true);
+		} else {
+			length = header;
+			uintptr_t offset = (tail + sizeof(uintptr_t)) & mask;
+			uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+			writeToFile(env, _ring + offset, firstPart);
+			if (firstPart < length) {
+				writeToFile(env, _ring, length - firstPart);
+			}
+		}
+		tail += sizeof(uintptr_t) + MM_Math::roundToCeiling(sizeof(uintptr_t), length);
+
+		/* the record must have been read before the reporting thread may reuse its space */
+		MM_AtomicOperations::readWriteBarrier();
+		_ringTail = tail;
+	}
+}
+
+/**
+ * Closes the log file once the writer thread has written everything queued.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	stopWriterThread(env);
+	closeFile(env);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::flushStream(MM_EnvironmentBase *env)
+{
+	uintptr_t target = _ringHead;
+
+	omrthread_monitor_enter(_writerMonitor);
+	while ((STATE_RUNNING == _threadState) && ((intptr_t)(target - _ringTail) > 0)) {
+		omrthread_monitor_notify_all(_writerMonitor);
+		omrthread_monitor_wait(_writerMonitor);
+	}
+	omrthread_monitor_exit(_writerMonitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	/* the file is only used by the writer thread while it runs */
+	stopWriterThread(env);
+	return MM_VerboseWriterFileLogging::reconfigure(env, filename, numFiles, numCycles);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::writer_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	/* this method will NOT return, the thread exits once it is asked to terminate */
+	writer->writerThreadEntryPoint();
+	return 0;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startWriterThread(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it cannot report its state before we wait for it */
+	omrthread_monitor_enter(_writerMonitor);
+	_threadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		writer_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _threadState) {
+			omrthread_monitor_wait(_writerMonitor);
+		}
+		success = (STATE_RUNNING == _threadState);
+	} else {
+		_threadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_writerMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopWriterThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_writerMonitor);
+	if (STATE_RUNNING == _threadState) {
+		_threadState = STATE_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_writerMonitor);
+		while (STATE_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_writerMonitor);
+		}
+	}
+	omrthread_monitor_exit(_writerMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_writerMonitor);
+	_threadState = STATE_RUNNING;
+	omrthread_monitor_notify_all(_writerMonitor);
+
+	while (true) {
+		if (_ringTail != _ringHead) {
+			omrthread_monitor_exit(_writerMonitor);
+			drainRing(&env);
+			omrthread_monitor_enter(_writerMonitor);
+			/* wake threads flushing the stream */
+			omrthread_monitor_notify_all(_writerMonitor);
+		} else if (STATE_TERMINATION_REQUESTED == _threadState) {
+			/* everything queued before the request has been written */
+			break;
+		} else {
+			_writerWaiting = true;
+			omrthread_monitor_wait_timed(_writerMonitor, ASYNC_WRITER_POLL_MILLIS, 0);
+			_writerWaiting = false;
+		}
+	}
+
+	_threadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_writerMonitor);
+	omrthread_exit(_writerMonitor);
+}
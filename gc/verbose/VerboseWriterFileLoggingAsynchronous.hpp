@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a background thread.
+ *
+ * Stanzas are copied into a ring buffer and the writer thread writes them to the file, so the thread
+ * reporting the stanza (typically a GC thread inside a pause) never waits for file I/O. The reporting
+ * threads are serialized by the verbose handler, so the ring has a single producer and a single consumer
+ * and needs no lock. A stanza that does not fit in the free space of the ring is dropped and counted,
+ * and the writer thread notes the number of dropped stanzas in the log.
+ *
+ * Log file rotation is queued in the ring with the stanzas, so that each file receives the stanzas of
+ * its own cycles.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum WriterThreadState {
+		STATE_NOT_STARTED = 0,
+		STATE_ERROR,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} WriterThreadState;
+
+	OMR_VM *_omrVM; /**< used to build the environment of the writer thread */
+	intptr_t _logFileDescriptor; /**< the file being written to, only used by the writer thread once it is running */
+	char *_ring; /**< records queued for the writer thread, each a uintptr_t length (or rotation marker) followed by the padded string */
+	uintptr_t _ringSize; /**< size of the ring in bytes, a power of two */
+	volatile uintptr_t _ringHead; /**< bytes ever queued, only advanced by the reporting thread */
+	volatile uintptr_t _ringTail; /**< bytes ever consumed, only advanced by the writer thread */
+	volatile uintptr_t _droppedRecords; /**< stanzas dropped because the ring was full or the writer thread was not running, only advanced by the reporting thread */
+	volatile uintptr_t _droppedBytes; /**< bytes of the dropped stanzas */
+	uintptr_t _reportedDroppedRecords; /**< dropped stanzas already noted in the log by the writer thread */
+	uintptr_t _reportedDroppedBytes; /**< bytes of the dropped stanzas already noted in the log by the writer thread */
+	omrthread_monitor_t _writerMonitor; /**< used to wait for records and for the writer thread to start, stop and catch up */
+	volatile WriterThreadState _threadState;
+	volatile bool _writerWaiting; /**< true while the writer thread waits for records */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait until the writer thread has written everything queued before the call.
+	 */
+	virtual void flushStream(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+	void writeToFile(MM_EnvironmentBase *env, const char *bytes, uintptr_t length);
+
+	/**
+	 * Queue a record in the ring, or count it as dropped if it does not fit.
+	 * @param[in] header the length of string, or the rotation marker
+	 * @param[in] string the bytes of the record (NULL for the rotation marker)
+	 * @param[in] length number of bytes of string
+	 */
+	void enqueueRecord(MM_EnvironmentBase *env, uintptr_t header, const char *string, uintptr_t length);
+
+	/**
+	 * Write out (or act on) every record queued so far. Called by the writer thread without the monitor.
+	 */
+	void drainRing(MM_EnvironmentBase *env);
+
+	bool startWriterThread(MM_EnvironmentBase *env);
+	void stopWriterThread(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC writer_thread_proc(void *info);
+	void writerThreadEntryPoint();
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -0,0 +1,398 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#include "VerboseBuffer.hpp"
+#include "VerboseHandlerOutput.hpp"
+
+/* Most distinct strings in one file, a log needs a few hundred */
+#define DICTIONARY_MAXIMUM_COUNT 4096
+#define DICTIONARY_INDEX_SIZE (2 * DICTIONARY_MAXIMUM_COUNT)
+#define DICTIONARY_STRINGS_SIZE ((uintptr_t)64 * 1024)
+/* Longest value interned in the dictionary, values with digits are never interned */
+#define DICTIONARY_MAXIMUM_VALUE_LENGTH 64
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_logFileDescriptor(-1)
+	,_encodeBuffer(NULL)
+	,_encodeBufferSize(0)
+	,_dictionaryStrings(NULL)
+	,_dictionaryStringsUsed(0)
+	,_dictionary(NULL)
+	,_dictionaryCount(0)
+	,_dictionaryIndex(NULL)
+	,_lastTimestamp(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (NULL == _dictionary) {
+		_dictionaryStrings = (char *)extensions->getForge()->allocate(DICTIONARY_STRINGS_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		_dictionary = (DictionaryEntry *)extensions->getForge()->allocate(sizeof(DictionaryEntry) * DICTIONARY_MAXIMUM_COUNT, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		_dictionaryIndex = (uint32_t *)extensions->getForge()->allocate(sizeof(uint32_t) * DICTIONARY_INDEX_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if ((NULL == _dictionaryStrings) || (NULL == _dictionary) || (NULL == _dictionaryIndex)) {
+			return false;
+		}
+		resetDictionary();
+	}
+
+	if (!ensureEncodeBuffer(env, INITIAL_BUFFER_SIZE * 8)) {
+		return false;
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	closeFile(env);
+	extensions->getForge()->free(_encodeBuffer);
+	_encodeBuffer = NULL;
+	extensions->getForge()->free(_dictionaryStrings);
+	_dictionaryStrings = NULL;
+	extensions->getForge()->free(_dictionary);
+	_dictionary = NULL;
+	extensions->getForge()->free(_dictionaryIndex);
+	_dictionaryIndex = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and writes the magic bytes and the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	/* every file can be decoded on its own */
+	resetDictionary();
+	omrfile_write(_logFileDescriptor, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH);
+	writeRecord(env, getHeader(env));
+	/* Print an Initialized Stanza in new file */
+	if (printInitializedHeader) {
+		MM_VerboseBuffer* buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL != buffer) {
+			_manager->getVerboseHandlerOutput()->outputInitializedStanza(env, buffer);
+			writeRecord(env, buffer->contents());
+			buffer->kill(env);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Writes the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		writeRecord(env, getFooter(env));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/**
+		 * Under normal circumstances, new file should be opened during endOfCycle call.
+		 * This path works as one backup, in case we failed to open the file,  we’ll attempt to open it again before outputting the string.
+		 */
+		openFile(env);
+	}
+
+	if(-1 != _logFileDescriptor){
+		writeRecord(env, string);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, string, strlen(string));
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeRecord(MM_EnvironmentBase *env, const char *string)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t length = strlen(string);
+
+	/* no item encodes to more than twice its text, plus its definitions which are at most as long again */
+	if (!ensureEncodeBuffer(env, VERBOSE_BINARY_VARINT_MAXIMUM_LENGTH + (3 * length) + 64)) {
+		omrfile_write_text(OMRPORT_TTY_ERR, string, length);
+		return;
+	}
+
+	/* leave room to prefix the payload with its length */
+	uint8_t *payload = _encodeBuffer + VERBOSE_BINARY_VARINT_MAXIMUM_LENGTH;
+	uint8_t *cursor = payload;
+	const char *text = string;
+	const char *textEnd = string + length;
+	MM_VerboseBinaryFormat::Markup markup;
+	const char *next = NULL;
+	while (MM_VerboseBinaryFormat::MARKUP_FOUND == MM_VerboseBinaryFormat::parseMarkup(text, textEnd, true, &markup, &next)) {
+		cursor = encodeMarkup(&markup, text, next, cursor);
+		text = next;
+	}
+
+	if (cursor != payload) {
+		uint8_t lengthBytes[VERBOSE_BINARY_VARINT_MAXIMUM_LENGTH];
+		uintptr_t lengthSize = MM_VerboseBinaryFormat::writeVarint(lengthBytes, cursor - payload);
+		uint8_t *record = payload - lengthSize;
+		memcpy(record, lengthBytes, lengthSize);
+		omrfile_write(_logFileDescriptor, record, cursor - record);
+	}
+}
+
+uint8_t *
+MM_VerboseWriterFileLoggingBinary::encodeMarkup(MM_VerboseBinaryFormat::Markup *markup, const char *itemStart, const char *itemEnd, uint8_t *cursor)
+{
+	if (MM_VerboseBinaryFormat::TOKEN_TEXT != markup->type) {
+		uintptr_t nameId = 0;
+		uintptr_t attributeNameIds[VERBOSE_BINARY_MAXIMUM_ATTRIBUTES];
+		uintptr_t valueTypes[VERBOSE_BINARY_MAXIMUM_ATTRIBUTES];
+		uint64_t values[VERBOSE_BINARY_MAXIMUM_ATTRIBUTES];
+		uintptr_t scales[VERBOSE_BINARY_MAXIMUM_ATTRIBUTES];
+		int64_t lastTimestamp = _lastTimestamp;
+		bool defined = lookupString(markup->name, markup->nameLength, &nameId, &cursor);
+
+		for (uintptr_t i = 0; defined && (i < markup->attributeCount); i++) {
+			MM_VerboseBinaryFormat::Markup::Attribute *attribute = &markup->attributes[i];
+			defined = lookupString(attribute->name, attribute->nameLength, &attributeNameIds[i], &cursor);
+			scales[i] = 0;
+			int64_t timestamp = 0;
+			if (MM_VerboseBinaryFormat::parseNumber(attribute->value, attribute->valueLength, &valueTypes[i], &values[i], &scales[i])) {
+				/* encoded as a number */
+			} else if (MM_VerboseBinaryFormat::parseTimestamp(attribute->value, attribute->valueLength, &timestamp)) {
+				valueTypes[i] = MM_VerboseBinaryFormat::VALUE_TIMESTAMP;
+				values[i] = MM_VerboseBinaryFormat::zigzagEncode(timestamp - lastTimestamp);
+				lastTimestamp = timestamp;
+			} else {
+				valueTypes[i] = MM_VerboseBinaryFormat::VALUE_STRING;
+				/* intern enumeration-like values, which repeat, but not addresses, times or names with numbers */
+				if (attribute->valueLength <= DICTIONARY_MAXIMUM_VALUE_LENGTH) {
+					bool hasDigit = false;
+					for (uintptr_t c = 0; c < attribute->valueLength; c++) {
+						if (('0' <= attribute->value[c]) && ('9' >= attribute->value[c])) {
+							hasDigit = true;
+							break;
+						}
+					}
+					if (!hasDigit) {
+						uintptr_t valueId = 0;
+						if (lookupString(attribute->value, attribute->valueLength, &valueId, &cursor)) {
+							valueTypes[i] = MM_VerboseBinaryFormat::VALUE_INTERNED;
+							values[i] = valueId;
+						}
+					}
+				}
+			}
+		}
+
+		if (defined) {
+			_lastTimestamp = lastTimestamp;
+			*cursor++ = (uint8_t)markup->type;
+			cursor += MM_VerboseBinaryFormat::writeVarint(cursor, nameId);
+			if (MM_VerboseBinaryFormat::TOKEN_END != markup->type) {
+				cursor += MM_VerboseBinaryFormat::writeVarint(cursor, markup->attributeCount);
+				for (uintptr_t i = 0; i < markup->attributeCount; i++) {
+					cursor += MM_VerboseBinaryFormat::writeVarint(cursor, attributeNameIds[i]);
+					*cursor++ = (uint8_t)valueTypes[i];
+					switch (valueTypes[i]) {
+					case MM_VerboseBinaryFormat::VALUE_STRING:
+						cursor += MM_VerboseBinaryFormat::writeVarint(cursor, markup->attributes[i].valueLength);
+						memcpy(cursor, markup->attributes[i].value, markup->attributes[i].valueLength);
+						cursor += markup->attributes[i].valueLength;
+						break;
+					case MM_VerboseBinaryFormat::VALUE_DECIMAL:
+						cursor += MM_VerboseBinaryFormat::writeVarint(cursor, values[i]);
+						*cursor++ = (uint8_t)scales[i];
+						break;
+					default:
+						cursor += MM_VerboseBinaryFormat::writeVarint(cursor, values[i]);
+						break;
+					}
+				}
+			}
+			return cursor;
+		}
+
+		/* the dictionary is full, keep the item as text */
+		markup->name = itemStart;
+		markup->nameLength = itemEnd - itemStart;
+	}
+
+	*cursor++ = (uint8_t)MM_VerboseBinaryFormat::TOKEN_TEXT;
+	cursor += MM_VerboseBinaryFormat::writeVarint(cursor, markup->nameLength);
+	memcpy(cursor, markup->name, markup->nameLength);
+	return cursor + markup->nameLength;
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::lookupString(const char *string, uintptr_t length, uintptr_t *id, uint8_t **cursor)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261U;
+	for (uintptr_t i = 0; i < length; i++) {
+		hash = (hash ^ (uint8_t)string[i]) * 16777619U;
+	}
+
+	uintptr_t slot = hash & (DICTIONARY_INDEX_SIZE - 1);
+	while (0 != _dictionaryIndex[slot]) {
+		uintptr_t candidate = _dictionaryIndex[slot] - 1;
+		DictionaryEntry *entry = &_dictionary[candidate];
+		if ((entry->length == length) && (0 == memcmp(_dictionaryStrings + entry->offset, string, length))) {
+			*id = candidate;
+			return true;
+		}
+		slot = (slot + 1) & (DICTIONARY_INDEX_SIZE - 1);
+	}
+
+	if ((DICTIONARY_MAXIMUM_COUNT == _dictionaryCount) || ((DICTIONARY_STRINGS_SIZE - _dictionaryStringsUsed) < length)) {
+		return false;
+	}
+
+	DictionaryEntry *entry = &_dictionary[_dictionaryCount];
+	entry->offset = _dictionaryStringsUsed;
+	entry->length = length;
+	memcpy(_dictionaryStrings + _dictionaryStringsUsed, string, length);
+	_dictionaryStringsUsed += length;
+	*id = _dictionaryCount;
+	_dictionaryCount += 1;
+	_dictionaryIndex[slot] = (uint32_t)_dictionaryCount;
+
+	uint8_t *definition = *cursor;
+	*definition++ = (uint8_t)MM_VerboseBinaryFormat::TOKEN_DEFINE;
+	definition += MM_VerboseBinaryFormat::writeVarint(definition, length);
+	memcpy(definition, string, length);
+	*cursor = definition + length;
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::resetDictionary()
+{
+	_dictionaryCount = 0;
+	_dictionaryStringsUsed = 0;
+	_lastTimestamp = 0;
+	memset(_dictionaryIndex, 0, sizeof(uint32_t) * DICTIONARY_INDEX_SIZE);
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::ensureEncodeBuffer(MM_EnvironmentBase *env, uintptr_t size)
+{
+	if (size > _encodeBufferSize) {
+		MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+		uintptr_t newSize = OMR_MAX(size, 2 * _encodeBufferSize);
+		uint8_t *newBuffer = (uint8_t *)extensions->getForge()->allocate(newSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == newBuffer) {
+			return false;
+		}
+		extensions->getForge()->free(_encodeBuffer);
+		_encodeBuffer = newBuffer;
+		_encodeBufferSize = newSize;
+	}
+	return true;
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseManager;
+
+/**
+ * Output agent which directs verbosegc output to file in the binary format described in VerboseBinaryFormat.hpp.
+ * Element and attribute names and enumeration-like values are written once per file and then referred to by id,
+ * and numbers are written as varints, so the log is several times smaller than the XML and much faster to scan.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	struct DictionaryEntry {
+		uintptr_t offset; /**< offset of the string in _dictionaryStrings */
+		uintptr_t length;
+	};
+
+	intptr_t _logFileDescriptor; /**< the file being written to */
+
+	uint8_t *_encodeBuffer; /**< the record being encoded */
+	uintptr_t _encodeBufferSize;
+
+	char *_dictionaryStrings; /**< the strings defined in the current file */
+	uintptr_t _dictionaryStringsUsed;
+	DictionaryEntry *_dictionary; /**< the strings defined in the current file, indexed by id */
+	uintptr_t _dictionaryCount;
+	uint32_t *_dictionaryIndex; /**< open addressing hash table of id + 1 (0 for an empty slot) */
+	int64_t _lastTimestamp; /**< the last timestamp written to the current file, timestamps are written relative to it */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Encode verbose XML text as one record and write it to the log file.
+	 */
+	void writeRecord(MM_EnvironmentBase *env, const char *string);
+
+	/**
+	 * Encode one markup item, defining the strings it uses first.
+	 * @return the end of the encoded item
+	 */
+	uint8_t *encodeMarkup(MM_VerboseBinaryFormat::Markup *markup, const char *itemStart, const char *itemEnd, uint8_t *cursor);
+
+	/**
+	 * Find the id of a string, adding it to the dictionary (and encoding its definition at *cursor) if it is new.
+	 * @return false if the dictionary is full
+	 */
+	bool lookupString(const char *string, uintptr_t length, uintptr_t *id, uint8_t **cursor);
+
+	void resetDictionary();
+	bool ensureEncodeBuffer(MM_EnvironmentBase *env, uintptr_t size);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -27,6 +27,7 @@
 
 #include "ConcurrentGCStats.hpp"
 #include "ConcurrentMarkPhaseStats.hpp"
+#include "ConcurrentPacingController.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -72,6 +73,7 @@ static void verboseHandlerConcurrentKickoff(J9HookInterface** hook, uintptr_t ev
 static void verboseHandlerConcurrentHalted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentCollectionStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerConcurrentPacing(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 MM_VerboseHandlerOutput *
@@ -151,6 +153,7 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_HALTED, verboseHandlerConcurrentHalted, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_START, verboseHandlerConcurrentCollectionStart, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, verboseHandlerConcurrentAborted, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PACING, verboseHandlerConcurrentPacing, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_REMEMBERED_SET_SCAN_END, verboseHandlerConcurrentRememberedSetScanEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, OMR_GET_CALLSITE(), (void *)this);
@@ -210,6 +213,7 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_HALTED, verboseHandlerConcurrentHalted, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_START, verboseHandlerConcurrentCollectionStart, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, verboseHandlerConcurrentAborted, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PACING, verboseHandlerConcurrentPacing, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_REMEMBERED_SET_SCAN_END, verboseHandlerConcurrentRememberedSetScanEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, NULL);
@@ -297,6 +301,18 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if ((0 != markStats->_markMapBytesCleared) || (0 != markStats->_markMapBytesSkipped)) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		writer->formatAndOutput(env, 1, "<markmap-clear clearedbytes=\"%zu\" skippedbytes=\"%zu\" timems=\"%.3f\" savedms=\"%.3f\" />",
+				markStats->_markMapBytesCleared, markStats->_markMapBytesSkipped,
+				omrtime_hires_delta(0, markStats->_markMapClearTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0,
+				omrtime_hires_delta(0, markStats->getMarkMapClearTimeSaved(), OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0);
+	}
+	if (extensions->workPacketDeques) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<work-packets acquired=\"%zu\" popped=\"%zu\" stolen=\"%zu\" />",
+				workPacketStats->workPacketsAcquired, workPacketStats->workPacketsPopped, workPacketStats->workPacketsStolen);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -430,6 +446,26 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (extensions->scavengerNumaAware) {
+		writer->formatAndOutput(env, 1, "<numa-copy remotebytes=\"%zu\" remotescancaches=\"%zu\" />",
+				scavengerStats->_numaRemoteCopyBytes, scavengerStats->_numaRemoteScanCacheCount);
+	}
+	if (0 != extensions->gcThreadSyncSpinCount) {
+		writer->formatAndOutput(env, 1, "<sync-waits spincount=\"%zu\" spun=\"%zu\" parked=\"%zu\" />",
+				extensions->gcThreadSyncSpinCount, scavengerStats->_syncSpinWaitCount, scavengerStats->_syncParkWaitCount);
+	}
+	if (extensions->scavengerLearnHotFields) {
+		writer->formatAndOutput(env, 1, "<hot-fields samples=\"%zu\" learnedcopies=\"%zu\" />",
+				scavengerStats->_hotFieldSampleCount, scavengerStats->_hotFieldLearnedCopyCount);
+	}
+	if (extensions->freeListSizeIndex) {
+		writer->formatAndOutput(env, 1, "<free-list-size-index minimumsize=\"%zu\" allocations=\"%zu\" />",
+				extensions->freeListSizeIndexMinimumSize, scavengerStats->_sizeIndexAllocCount);
+	}
+	uint64_t rememberedSetScanMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	writer->formatAndOutput(env, 1, "<remembered-set-scan objects=\"%zu\" prefetchdistance=\"%zu\" threadtimems=\"%llu.%03llu\" />",
+			scavengerStats->_rememberedSetObjectCount, extensions->scavengerRememberedSetPrefetchDistance,
+			rememberedSetScanMicros / 1000, rememberedSetScanMicros % 1000);
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -609,8 +645,8 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 	handleGCOPOuterStanzaStart(env, "card-cleaning", env->_cycleState->_verboseContextID, durationUs, true);
 
 	writer->formatAndOutput(
-			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
-			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" cardsScanned=\"%zu\" cardsScannedPerSecond=\"%llu\" />",
+			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount, event->cardsScanned, event->cardsScannedPerSecond);
 
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
@@ -698,6 +734,9 @@ MM_VerboseHandlerOutputStandard::getConcurrentKickoffReason(void *eventData)
 	case NEXT_SCAVENGE_WILL_PERCOLATE:
 		reasonString = "next scavenge will percolate";
 		break;
+	case KICKOFF_PACING_PREDICTED:
+		reasonString = "pacing predicted";
+		break;
 	case NO_KICKOFF_REASON:
 		/* Should never be the case */
 		reasonString = "none";
@@ -867,6 +906,29 @@ MM_VerboseHandlerOutputStandard::handleConcurrentAbortedInternal(MM_EnvironmentB
 {
 	/* Empty stub */
 }
+
+void
+MM_VerboseHandlerOutputStandard::handleConcurrentPacing(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ConcurrentPacingEvent* event = (MM_ConcurrentPacingEvent*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	char tagTemplate[100];
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-pacing %s>", tagTemplate);
+
+	const char* decision = (MM_ConcurrentPacingController::PACING_KICKOFF == event->decision) ? "kickoff" : "cycle end";
+	writer->formatAndOutput(
+			env, 1, "<pacing decision=\"%s\" allocationRate=\"%llu\" allocationRateDeviation=\"%llu\" traceRate=\"%llu\" kickoffScale=\"%.3f\" taxScale=\"%.3f\" cycleError=\"%.3f\" />",
+			decision, event->allocationRate, event->allocationRateDeviation, event->traceRate, event->kickoffScale, event->taxScale, event->cycleError);
+
+	writer->formatAndOutput(env, 0, "</concurrent-pacing>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 bool
@@ -1139,6 +1201,12 @@ verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void
 {
 	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentAborted(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerConcurrentPacing(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentPacing(hook, eventNum, eventData);
+}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 void
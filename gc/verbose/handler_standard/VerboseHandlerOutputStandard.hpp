@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -216,6 +216,14 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Write verbose stanza for concurrent pacing event.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleConcurrentPacing(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 };
 
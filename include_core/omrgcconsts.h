@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2021 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -237,6 +237,18 @@ struct ModronLnrlOptions {
 #define MMINLINE_DEBUG inline
 #endif /* OMR_OS_WINDOWS */
 
+/**
+ * Hint that the cache line holding address will soon be read (MM_PREFETCH_READ) or written (MM_PREFETCH_WRITE).
+ * The address need not be valid; on compilers without a prefetch builtin these expand to nothing.
+ */
+#if ((__GNUC__ > 3) || (__GNUC__ == 3 && __GNUC_MINOR__ >= 1))
+#define MM_PREFETCH_READ(address) __builtin_prefetch((const void *)(address), 0, 3)
+#define MM_PREFETCH_WRITE(address) __builtin_prefetch((const void *)(address), 1, 3)
+#else /* __GNUC__ */
+#define MM_PREFETCH_READ(address)
+#define MM_PREFETCH_WRITE(address)
+#endif /* __GNUC__ */
+
 /**
  * Lightweight Non-Reentrant Locks (LWNR) Spinlock Support
  * We can't use spinlocks on platforms that do not support semaphores.
@@ -274,6 +286,11 @@ struct ModronLnrlOptions {
 #define DEFAULT_MINIMUM_CONTRACTION_RATIO	10
 
 #define DESIRED_SUBAREA_SIZE		((uintptr_t)(4*1024*1024))
+#define TRANSPARENT_HUGE_PAGE_SIZE	((uintptr_t)(2*1024*1024))
+#define HEAP_PRETOUCH_CHUNK_SIZE	TRANSPARENT_HUGE_PAGE_SIZE
+#define INCREMENTAL_COMPACT_FIXUP_CARD_SHIFT	12
+#define INCREMENTAL_COMPACT_INITIAL_BYTES_PER_MILLI	((uintptr_t)(4*1024*1024))
+#define INCREMENTAL_COMPACT_FRAGMENTATION_THRESHOLD	((float)0.05)
 
 typedef enum {
 	COMPACT_NONE = 0,
@@ -287,7 +304,8 @@ typedef enum {
 	COMPACT_CONTRACT = 11,
 	COMPACT_AGGRESSIVE= 12,
 	COMPACT_PAGE = 13,
-	COMPACT_MICRO_FRAG = 14
+	COMPACT_MICRO_FRAG = 14,
+	COMPACT_INCREMENTAL = 15
 } CompactReason;
 
 typedef enum {
@@ -334,7 +352,8 @@ typedef enum {
 	NO_KICKOFF_REASON=1,
 	KICKOFF_THRESHOLD_REACHED,
 	NEXT_SCAVENGE_WILL_PERCOLATE,
-	LANGUAGE_DEFINED_REASON
+	LANGUAGE_DEFINED_REASON,
+	KICKOFF_PACING_PREDICTED
 } ConcurrentKickoffReason;
 
 /**
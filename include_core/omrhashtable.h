@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -51,6 +51,7 @@ extern "C" {
 #define J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32	0x00000004	/*!< Allocate table elements using the malloc32 function */
 #define J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION	0x00000008	/*!< Allow space optimized hashTable, some functions not supported */
 #define J9HASH_TABLE_DO_NOT_REHASH	0x00000010	/*!< Do not rehash the table while set */
+#define J9HASH_TABLE_OPEN_ADDRESSING	0x00000020	/*!< Store entries inline in an open addressed table probed by groups of control bytes */
 
 /*
  * This used to include a cast to uintptr_t, but ddrgen doesn't
@@ -86,7 +87,8 @@ extern "C" {
 /**
 * Hash table state queries
 */
-#define hashTableIsSpaceOptimized(table) (NULL == table->listNodePool)
+#define hashTableIsOpenAddressing(table) (J9HASH_TABLE_OPEN_ADDRESSING == ((table)->flags & J9HASH_TABLE_OPEN_ADDRESSING))
+#define hashTableIsSpaceOptimized(table) ((NULL == (table)->listNodePool) && !hashTableIsOpenAddressing(table))
 
 
 struct J9HashTable; /* Forward struct declaration */
@@ -120,6 +122,8 @@ typedef struct J9HashTable {
 	void *equalFnUserData;
 	void *hashFnUserData;
 	struct J9HashTable *previous;
+	uint32_t numberOfDeletedNodes;
+	uint8_t *controlBytes;
 } J9HashTable;
 
 typedef struct J9HashTableState {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -60,6 +60,7 @@ typedef struct J9HookInterface {
 	intptr_t (*J9HookIsEnabled)(struct J9HookInterface **hookInterface, uintptr_t eventNum);
 	uintptr_t (*J9HookAllocateAgentID)(struct J9HookInterface **hookInterface);
 	void (*J9HookDeallocateAgentID)(struct J9HookInterface **hookInterface, uintptr_t agentID);
+	void (*J9HookAggregateEventCounts)(struct J9HookInterface **hookInterface);
 } J9HookInterface;
 
 
@@ -95,7 +96,7 @@ typedef struct OMRHookInfo4Dump {
 typedef struct OMREventInfo4Dump {
 	struct OMRHookInfo4Dump longestHook;
 	struct OMRHookInfo4Dump lastHook;
-	volatile uintptr_t count;
+	volatile uintptr_t count;		/* listener calls of the event, folded in from per thread shards during dispatch; exact after J9HookAggregateEventCounts() */
 	volatile uintptr_t totalTime;
 }OMREventInfo4Dump;
 
@@ -103,11 +104,18 @@ typedef struct J9CommonHookInterface {
 	struct J9HookInterface *hookInterface;
 	uintptr_t size;
 	omrthread_monitor_t lock;
-	struct J9Pool *pool;
+	struct J9Pool *pool;				/* unused, the records of each event are allocated as a J9HookRecordArray */
 	uintptr_t nextAgentID;
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	volatile uintptr_t *eventCounts;	/* per thread shards of OMREventInfo4Dump::count and of the dispatches in progress on threads without J9HookThreadDispatches */
+	uintptr_t eventCountsStride;		/* counters from one shard to the next, padded so shards never share a cache line */
+	volatile uintptr_t dispatchEpoch;	/* 0 or 1, which count of dispatches in progress new dispatches increment */
+	omrthread_tls_key_t threadDispatchesKey;	/* the J9HookThreadDispatches of each thread, 0 if no key could be allocated */
+	struct J9HookThreadDispatches *threadDispatches;	/* of every thread which has dispatched, linked under the lock */
+	struct J9HookRecordArray *retiredRecords;		/* arrays replaced since the last change of dispatchEpoch */
+	struct J9HookRecordArray *reclaimableRecords;	/* arrays replaced before it, freed once the previous epoch drains */
 } J9CommonHookInterface;
 
 
@@ -126,6 +134,20 @@ typedef struct J9HookRecord {
 	uintptr_t agentID;
 } J9HookRecord;
 
+/* the listeners of an event are published as an immutable array of length records following this header */
+typedef struct J9HookRecordArray {
+	struct J9HookRecordArray *nextRetired;
+	uintptr_t length;
+} J9HookRecordArray;
+
+/* the dispatches in progress in each epoch on one thread, which are only updated by that thread */
+typedef struct J9HookThreadDispatches {
+	volatile uintptr_t dispatching[2];
+	struct J9CommonHookInterface *commonInterface;
+	struct J9HookThreadDispatches *next;
+	struct J9HookThreadDispatches *previous;
+} J9HookThreadDispatches;
+
 
 /* magic hooks supported by every hook interface */
 
@@ -0,0 +1,243 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Allocation throughput microbenchmark for segregated heap region refill.
+ *
+ * Every thread allocates fixed size cells by bumping through its current region. When a region is exhausted it is
+ * handed back to the shared free list, as an immediate sweep would, and the thread refills from a private reserve
+ * that it tops up from the shared list a batch of regions at a time. The shared list is either a monitor protected
+ * stack, as MM_LockingFreeHeapRegionList is, or the MM_LockFreeRegionStack behind MM_LockFreeHeapRegionList.
+ * Allocations per second are reported for each list, refill batch and thread count.
+ */
+
+#include <new>
+#include <stdio.h>
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "AtomicOperations.hpp"
+#include "LockFreeRegionStack.hpp"
+
+#define REGION_COUNT 1024
+#define REGION_SIZE (16 * 1024)
+#define CELL_SIZE 64
+#define ALLOCATIONS_PER_THREAD (4 * 1024 * 1024)
+#define MAX_THREADS 16
+#define MAX_BATCH 16
+
+/**
+ * Shared list of free region indices, lock-free or monitor protected.
+ */
+class RegionList
+{
+public:
+	bool _lockFree;
+	MM_LockFreeRegionStack _stack;
+	volatile uint32_t _links[REGION_COUNT];
+	omrthread_monitor_t _monitor;
+	uintptr_t _lockedIndices[REGION_COUNT];
+	uintptr_t _lockedCount;
+
+	void
+	push(uintptr_t index)
+	{
+		if (_lockFree) {
+			_stack.push(index);
+		} else {
+			omrthread_monitor_enter(_monitor);
+			_lockedIndices[_lockedCount++] = index;
+			omrthread_monitor_exit(_monitor);
+		}
+	}
+
+	/**
+	 * Take up to count indices. The monitor protected list hands out a whole batch per lock acquisition,
+	 * as MM_LockingHeapRegionQueue::dequeue(target, count) does.
+	 */
+	uintptr_t
+	pop(uintptr_t *indices, uintptr_t count)
+	{
+		uintptr_t taken = 0;
+		if (_lockFree) {
+			while ((taken < count) && _stack.pop(&indices[taken])) {
+				taken += 1;
+			}
+		} else {
+			omrthread_monitor_enter(_monitor);
+			while ((taken < count) && (0 < _lockedCount)) {
+				indices[taken++] = _lockedIndices[--_lockedCount];
+			}
+			omrthread_monitor_exit(_monitor);
+		}
+		return taken;
+	}
+};
+
+struct BenchmarkState {
+	RegionList *list;
+	uint8_t *heap;
+	uintptr_t batch;
+	volatile uintptr_t running;
+	omrthread_monitor_t doneMonitor;
+};
+
+static int J9THREAD_PROC
+allocationThread(void *arg)
+{
+	BenchmarkState *state = (BenchmarkState *)arg;
+	RegionList *list = state->list;
+	uintptr_t reserve[MAX_BATCH];
+	uintptr_t reserveCount = 0;
+	uintptr_t region = 0;
+	uint8_t *current = NULL;
+	uint8_t *top = NULL;
+
+	for (uintptr_t i = 0; i < ALLOCATIONS_PER_THREAD; i++) {
+		if (current >= top) {
+			if (NULL != top) {
+				list->push(region);
+			}
+			while (0 == reserveCount) {
+				reserveCount = list->pop(reserve, state->batch);
+			}
+			region = reserve[--reserveCount];
+			current = state->heap + (region * REGION_SIZE);
+			top = current + REGION_SIZE;
+		}
+		/* format the cell header, as a real allocation would */
+		*(uintptr_t *)current = i;
+		current += CELL_SIZE;
+	}
+
+	/* return the current region and the rest of the reserve */
+	list->push(region);
+	while (0 < reserveCount) {
+		list->push(reserve[--reserveCount]);
+	}
+
+	omrthread_monitor_enter(state->doneMonitor);
+	state->running -= 1;
+	omrthread_monitor_notify_all(state->doneMonitor);
+	omrthread_monitor_exit(state->doneMonitor);
+	return 0;
+}
+
+static void
+runBenchmark(OMRPortLibrary *portLibrary, RegionList *list, uint8_t *heap, uintptr_t threadCount, uintptr_t batch)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	BenchmarkState state;
+	state.list = list;
+	state.heap = heap;
+	state.batch = batch;
+	state.running = threadCount;
+	omrthread_monitor_init_with_name(&state.doneMonitor, 0, "allocation benchmark done");
+
+	uint64_t startTime = omrtime_hires_clock();
+	omrthread_monitor_enter(state.doneMonitor);
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, allocationThread, &state);
+	}
+	while (0 != state.running) {
+		omrthread_monitor_wait(state.doneMonitor);
+	}
+	omrthread_monitor_exit(state.doneMonitor);
+	uint64_t elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	omrthread_monitor_destroy(state.doneMonitor);
+
+	double allocationsPerSecond = ((double)ALLOCATIONS_PER_THREAD * threadCount * 1000000.0) / (double)OMR_MAX(elapsedMicros, 1);
+	omrtty_printf("%-10s %8d %6d %16.0f\n", list->_lockFree ? "lock-free" : "locking", (int)threadCount, (int)batch, allocationsPerSecond);
+}
+
+int
+main(void)
+{
+	OMRPortLibrary portLibrary;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uint8_t *heap = (uint8_t *)omrmem_allocate_memory(REGION_COUNT * REGION_SIZE, OMRMEM_CATEGORY_MM);
+	RegionList *list = (RegionList *)omrmem_allocate_memory(sizeof(RegionList), OMRMEM_CATEGORY_MM);
+	if ((NULL == heap) || (NULL == list)) {
+		omrtty_printf("Failed to allocate benchmark heap\n");
+		return -1;
+	}
+	new(&list->_stack) MM_LockFreeRegionStack();
+	omrthread_monitor_init_with_name(&list->_monitor, 0, "allocation benchmark region list");
+
+	const uintptr_t threadCounts[] = { 1, 2, 4, 8, 16 };
+	const uintptr_t batches[] = { 1, 4 };
+
+	omrtty_printf("%-10s %8s %6s %16s\n", "list", "threads", "batch", "allocations/s");
+	for (uintptr_t lockFree = 0; lockFree < 2; lockFree++) {
+		for (uintptr_t b = 0; b < sizeof(batches) / sizeof(batches[0]); b++) {
+			for (uintptr_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+				list->_lockFree = (1 == lockFree);
+				list->_stack.initialize(list->_links);
+				list->_lockedCount = 0;
+				for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+					list->push(i);
+				}
+				runBenchmark(&portLibrary, list, heap, threadCounts[t], batches[b]);
+			}
+		}
+	}
+
+	omrthread_monitor_destroy(list->_monitor);
+	omrmem_free_memory(list);
+	omrmem_free_memory(heap);
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
+}
+
+#else /* defined(OMR_GC_SEGREGATED_HEAP) */
+
+int
+main(void)
+{
+	printf("Segregated heap is not enabled in this build, nothing to measure\n");
+	return 0;
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
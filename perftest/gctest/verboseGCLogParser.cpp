@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2016, 2016 IBM Corp. and others
+ * Copyright (c) 2016, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -21,187 +21,412 @@
  *******************************************************************************/
 
 #include <string.h>
-#include <algorithm>
-#include <vector>
-#include <iterator>
-#include <numeric>
 #include <stdio.h>
-
-#include "pugixml.hpp"
+#include <stdlib.h>
+#include <math.h>
 
 #include "omr.h"
 #include "omrport.h"
 #include "omrthread.h"
 
-const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
-const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
-const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
-const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+#include "VerboseBinaryDecoder.hpp"
+#include "VerboseBinaryFormat.hpp"
+
+/*
+ * Summarizes the collection times of verbose GC logs, in the XML or the binary (-Xgc:binaryLogging) format.
+ *
+ * Logs are streamed, XML logs a chunk at a time and binary logs through MM_VerboseBinaryDecoder, and times are
+ * counted in fixed histograms, so logs of any size are summarized in constant memory.
+ *
+ * With no arguments, every VerboseGC* file of the current directory is summarized and deleted. Otherwise the
+ * files named are summarized, or with -xml converted from the binary format to <file>.xml.
+ */
+
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
-double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
-
-int main(void)
+/* Bytes of an XML log read at a time */
+#define XML_CHUNK_SIZE ((uintptr_t)1024 * 1024)
+/* Histogram buckets grow by 2% from 1us, so percentiles are within 2%, and cover up to about 10 minutes */
+#define HISTOGRAM_MINIMUM_MS 0.001
+#define HISTOGRAM_GROWTH 1.02
+#define HISTOGRAM_BUCKETS 1024
+
+/**
+ * Count, extremes, average and percentiles of a series of times, in constant memory.
+ */
+class TimeStatistics
 {
-	int32_t totalFiles = 0;
-	intptr_t rc = 0;
-	char resultBuffer[128];
-	uintptr_t rcFile;
-	uintptr_t handle;
-	OMRPortLibrary portLibrary;
-
-	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
-	if (0 != rc) {
-		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
-		return -1;
+public:
+	uintptr_t count;
+	double sum;
+	double min;
+	double max;
+	uint64_t buckets[HISTOGRAM_BUCKETS];
+
+	TimeStatistics() { reset(); }
+
+	void
+	reset()
+	{
+		count = 0;
+		sum = 0;
+		min = 0;
+		max = 0;
+		memset(buckets, 0, sizeof(buckets));
 	}
 
-	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
-	if (0 != rc) {
-		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
-		return -1;
+	void
+	add(double ms)
+	{
+		uintptr_t index = 0;
+		if (ms > HISTOGRAM_MINIMUM_MS) {
+			index = 1 + (uintptr_t)(log(ms / HISTOGRAM_MINIMUM_MS) / log(HISTOGRAM_GROWTH));
+			if (index >= HISTOGRAM_BUCKETS) {
+				index = HISTOGRAM_BUCKETS - 1;
+			}
+		}
+		buckets[index] += 1;
+		min = ((0 == count) || (ms < min)) ? ms : min;
+		max = ((0 == count) || (ms > max)) ? ms : max;
+		sum += ms;
+		count += 1;
 	}
 
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
-
-	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
-
-	if(rcFile == (uintptr_t)-1) {
-		fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
-		return -1;
+	double
+	average()
+	{
+		return (0 == count) ? 0 : (sum / count);
 	}
 
-	while ((uintptr_t)-1 != rcFile) {
-		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
-			totalFiles++;
-			/* Clean up verbose log file */
-			omrfile_unlink(resultBuffer);
+	/**
+	 * @return the upper bound of the bucket holding the given fraction of the times, no more than the maximum
+	 */
+	double
+	percentile(double fraction)
+	{
+		if (0 == count) {
+			return 0;
 		}
-		rcFile = omrfile_findnext(handle, resultBuffer);
-	}
-	if (handle != (uintptr_t)-1) {
-		omrfile_findclose(handle);
+		uint64_t target = (uint64_t)ceil(fraction * count);
+		uint64_t cumulative = 0;
+		uintptr_t index = 0;
+		for (; index < (HISTOGRAM_BUCKETS - 1); index++) {
+			cumulative += buckets[index];
+			if (cumulative >= target) {
+				break;
+			}
+		}
+		double bound = HISTOGRAM_MINIMUM_MS * pow(HISTOGRAM_GROWTH, (double)index);
+		return (bound < max) ? bound : max;
 	}
+};
+
+enum {
+	STATISTIC_MARK = 0,
+	STATISTIC_SWEEP,
+	STATISTIC_EXPAND,
+	STATISTIC_GCDURATION,
+	STATISTIC_PAUSE,
+	STATISTIC_COUNT
+};
+
+/**
+ * The attributes of a child element of the verbosegc element which are summarized.
+ */
+struct Element {
+	const char *name;
+	uintptr_t nameLength;
+	const char *type;
+	uintptr_t typeLength;
+	double timems;
+	double durationms;
+};
+
+static bool
+matches(const char *string, uintptr_t length, const char *literal)
+{
+	return (strlen(literal) == length) && (0 == memcmp(string, literal, length));
+}
 
-	if(totalFiles < 1) {
-		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
+static void
+recordElement(Element *element, TimeStatistics *statistics)
+{
+	if (matches(element->name, element->nameLength, "gc-op")) {
+		if (matches(element->type, element->typeLength, "mark")) {
+			statistics[STATISTIC_MARK].add(element->timems);
+		} else if (matches(element->type, element->typeLength, "sweep")) {
+			statistics[STATISTIC_SWEEP].add(element->timems);
+		}
+	} else if (matches(element->name, element->nameLength, "heap-resize")) {
+		if (matches(element->type, element->typeLength, "expand")) {
+			statistics[STATISTIC_EXPAND].add(element->timems);
+		}
+	} else if (matches(element->name, element->nameLength, "gc-end")) {
+		if (matches(element->type, element->typeLength, "global")) {
+			statistics[STATISTIC_GCDURATION].add(element->durationms);
+		}
+	} else if (matches(element->name, element->nameLength, "exclusive-end")) {
+		/* the time the collection held exclusive access, the pause seen by the application */
+		statistics[STATISTIC_PAUSE].add(element->durationms);
 	}
-
-	portLibrary.port_shutdown_library(&portLibrary);
-	omrthread_detach(NULL);
 }
 
-double
-getAvg(std::vector<double> v)
+static bool
+analyzeBinary(OMRPortLibrary *portLibrary, const char *fileName, TimeStatistics *statistics)
 {
-	double sum = std::accumulate(v.begin(), v.end(), 0.0);
-	double avg = sum / v.size();
-	return avg;
+	MM_VerboseBinaryDecoder *decoder = MM_VerboseBinaryDecoder::newInstance(portLibrary);
+	if (NULL == decoder) {
+		return false;
+	}
+	bool result = decoder->open(fileName);
+	if (result) {
+		intptr_t depth = 0;
+		while (decoder->nextToken()) {
+			uintptr_t type = decoder->getTokenType();
+			if (MM_VerboseBinaryFormat::TOKEN_END == type) {
+				depth -= 1;
+			} else if (MM_VerboseBinaryFormat::TOKEN_TEXT != type) {
+				if (1 == depth) {
+					Element element = { decoder->getName(), decoder->getNameLength(), "", 0, 0, 0 };
+					const MM_VerboseBinaryDecoder::Attribute *attribute = decoder->findAttribute("type");
+					if ((NULL != attribute) && (NULL != attribute->string)) {
+						element.type = attribute->string;
+						element.typeLength = attribute->stringLength;
+					}
+					attribute = decoder->findAttribute("timems");
+					element.timems = (NULL == attribute) ? 0 : MM_VerboseBinaryDecoder::attributeAsDouble(attribute);
+					attribute = decoder->findAttribute("durationms");
+					element.durationms = (NULL == attribute) ? 0 : MM_VerboseBinaryDecoder::attributeAsDouble(attribute);
+					recordElement(&element, statistics);
+				}
+				if (MM_VerboseBinaryFormat::TOKEN_START == type) {
+					depth += 1;
+				}
+			}
+		}
+		result = !decoder->hasFailed();
+	}
+	decoder->kill();
+	return result;
 }
 
-void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+static bool
+analyzeXML(OMRPortLibrary *portLibrary, const char *fileName, TimeStatistics *statistics)
 {
-	std::vector<double> mark_values;
-	std::vector<double> sweep_values;
-	std::vector<double> expand_values;
-	std::vector<double> gcduration_values;
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
 
-	pugi::xpath_node_set markTimes;
-	pugi::xpath_node_set sweepTimes;
-	pugi::xpath_node_set expandTimes;
-	pugi::xpath_node_set gcTimes;
+	intptr_t file = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == file) {
+		return false;
+	}
+	char *buffer = (char *)omrmem_allocate_memory(XML_CHUNK_SIZE, OMRMEM_CATEGORY_MM);
+	MM_VerboseBinaryFormat::Markup *markup = (MM_VerboseBinaryFormat::Markup *)omrmem_allocate_memory(sizeof(MM_VerboseBinaryFormat::Markup), OMRMEM_CATEGORY_MM);
+	if ((NULL == buffer) || (NULL == markup)) {
+		omrmem_free_memory(buffer);
+		omrmem_free_memory(markup);
+		omrfile_close(file);
+		return false;
+	}
 
-	double maxMark = 0;
-	double minMark = 0;
-	double avgMark = 0;
+	uintptr_t used = 0;
+	bool endOfFile = false;
+	intptr_t depth = 0;
+	while (!endOfFile || (0 != used)) {
+		if (!endOfFile) {
+			intptr_t bytesRead = omrfile_read(file, buffer + used, (intptr_t)(XML_CHUNK_SIZE - used));
+			if (bytesRead <= 0) {
+				endOfFile = true;
+			} else {
+				used += bytesRead;
+			}
+		}
 
-	double maxSweep = 0;
-	double minSweep = 0;
-	double avgSweep = 0;
+		const char *cursor = buffer;
+		const char *end = buffer + used;
+		const char *next = NULL;
+		while (MM_VerboseBinaryFormat::MARKUP_FOUND == MM_VerboseBinaryFormat::parseMarkup(cursor, end, endOfFile, markup, &next)) {
+			if (MM_VerboseBinaryFormat::TOKEN_END == markup->type) {
+				depth -= 1;
+			} else if (MM_VerboseBinaryFormat::TOKEN_TEXT != markup->type) {
+				if (1 == depth) {
+					Element element = { markup->name, markup->nameLength, "", 0, 0, 0 };
+					for (uintptr_t i = 0; i < markup->attributeCount; i++) {
+						MM_VerboseBinaryFormat::Markup::Attribute *attribute = &markup->attributes[i];
+						/* values are followed by their closing quote, which ends the number */
+						if (matches(attribute->name, attribute->nameLength, "type")) {
+							element.type = attribute->value;
+							element.typeLength = attribute->valueLength;
+						} else if (matches(attribute->name, attribute->nameLength, "timems")) {
+							element.timems = strtod(attribute->value, NULL);
+						} else if (matches(attribute->name, attribute->nameLength, "durationms")) {
+							element.durationms = strtod(attribute->value, NULL);
+						}
+					}
+					recordElement(&element, statistics);
+				}
+				if (MM_VerboseBinaryFormat::TOKEN_START == markup->type) {
+					depth += 1;
+				}
+			}
+			cursor = next;
+		}
 
-	double maxExpand = 0;
-	double minExpand = 0;
-	double avgExpand = 0;
+		if (endOfFile) {
+			break;
+		}
+		uintptr_t consumed = cursor - buffer;
+		if ((0 == consumed) && (XML_CHUNK_SIZE == used)) {
+			/* an item larger than the chunk, which is not one of the elements summarized */
+			used = 0;
+		} else {
+			memmove(buffer, cursor, used - consumed);
+			used -= consumed;
+		}
+	}
 
-	double maxGCDuration = 0;
-	double minGCDuration = 0;
-	double avgGCDuration = 0;
+	omrmem_free_memory(buffer);
+	omrmem_free_memory(markup);
+	omrfile_close(file);
+	return true;
+}
 
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+static void
+analyze(const char *fileName, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	static TimeStatistics statistics[STATISTIC_COUNT];
 
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
-	if(!result) {
+	for (uintptr_t i = 0; i < STATISTIC_COUNT; i++) {
+		statistics[i].reset();
+	}
+
+	bool result = false;
+	if (MM_VerboseBinaryDecoder::isBinaryLog(portLibrary, fileName)) {
+		result = analyzeBinary(portLibrary, fileName, statistics);
+	} else {
+		result = analyzeXML(portLibrary, fileName, statistics);
+	}
+	if (!result) {
 		omrtty_printf("Error loading file : %s\n", fileName);
 		return;
-	} else {
-		omrtty_printf("\nResults for : %s\n",fileName);
 	}
 
-	markTimes = doc.select_nodes(XPATH_GET_ALL_MARK_TIME);
-	for (pugi::xpath_node_set::const_iterator it = markTimes.begin(); it != markTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    mark_values.push_back(value);
+	TimeStatistics *mark = &statistics[STATISTIC_MARK];
+	TimeStatistics *sweep = &statistics[STATISTIC_SWEEP];
+	TimeStatistics *expand = &statistics[STATISTIC_EXPAND];
+	TimeStatistics *gcDuration = &statistics[STATISTIC_GCDURATION];
+	TimeStatistics *pause = &statistics[STATISTIC_PAUSE];
+
+	omrtty_printf("\nResults for : %s\n",fileName);
+	omrtty_printf("            Mark           Sweep          Expand        GCDuration     Pause\n");
+	omrtty_printf("-------------------------------------------------------------------------------\n");
+	omrtty_printf("Count   : %-15zu%-15zu%-15zu%-15zu%zu\n",
+			mark->count, sweep->count, expand->count, gcDuration->count, pause->count);
+	omrtty_printf("Max     : %f        %f        %f        %f        %f\n",
+			mark->max, sweep->max, expand->max, gcDuration->max, pause->max);
+	omrtty_printf("Min     : %f        %f        %f        %f        %f\n",
+			mark->min, sweep->min, expand->min, gcDuration->min, pause->min);
+	omrtty_printf("Average : %f        %f        %f        %f        %f\n",
+			mark->average(), sweep->average(), expand->average(), gcDuration->average(), pause->average());
+
+	const double fractions[] = { 0.5, 0.9, 0.99, 0.999 };
+	const char *labels[] = { "50%     ", "90%     ", "99%     ", "99.9%   " };
+	for (uintptr_t i = 0; i < (sizeof(fractions) / sizeof(fractions[0])); i++) {
+		omrtty_printf("%s: %f        %f        %f        %f        %f\n", labels[i],
+				mark->percentile(fractions[i]), sweep->percentile(fractions[i]), expand->percentile(fractions[i]),
+				gcDuration->percentile(fractions[i]), pause->percentile(fractions[i]));
 	}
+	omrtty_printf("\n");
+}
 
-	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
-	for (pugi::xpath_node_set::const_iterator it = sweepTimes.begin(); it != sweepTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    sweep_values.push_back(value);
+static void
+convertToXML(const char *fileName, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char xmlFileName[1024];
+	omrstr_printf(xmlFileName, sizeof(xmlFileName), "%s.xml", fileName);
+
+	bool result = false;
+	MM_VerboseBinaryDecoder *decoder = MM_VerboseBinaryDecoder::newInstance(portLibrary);
+	if (NULL != decoder) {
+		if (decoder->open(fileName)) {
+			intptr_t xmlFile = omrfile_open(xmlFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+			if (-1 != xmlFile) {
+				result = decoder->writeXML(xmlFile);
+				omrfile_close(xmlFile);
+			}
+		}
+		decoder->kill();
 	}
 
-	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
-	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("timems").as_double();
-	    expand_values.push_back(value);
+	if (result) {
+		omrtty_printf("Converted %s to %s\n", fileName, xmlFileName);
+	} else {
+		omrtty_printf("Failed to convert %s, it is not a binary verbose GC log\n", fileName);
 	}
+}
 
-	gcTimes = doc.select_nodes(XPATH_GET_TOTAL_GC_TIME);
-	for (pugi::xpath_node_set::const_iterator it = gcTimes.begin(); it != gcTimes.end(); ++it) {
-	    pugi::xpath_node node = *it;
-	    double value = node.node().attribute("durationms").as_double();
-	    gcduration_values.push_back(value);
-	}
+int main(int argc, char **argv)
+{
+	int32_t totalFiles = 0;
+	intptr_t rc = 0;
+	char resultBuffer[128];
+	uintptr_t rcFile;
+	uintptr_t handle;
+	OMRPortLibrary portLibrary;
 
-	if (!mark_values.empty()) {
-		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
-		minMark = *std::min_element(mark_values.begin(), mark_values.end());
-		avgMark = getAvg(mark_values);
+	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
 	}
 
-	if (!sweep_values.empty()) {
-		maxSweep = *std::max_element(sweep_values.begin(), sweep_values.end());
-		minSweep = *std::min_element(sweep_values.begin(), sweep_values.end());
-		avgSweep = getAvg(sweep_values);
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
 	}
 
-	if (!expand_values.empty()) {
-		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
-		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
-		avgExpand = getAvg(expand_values);
-	}
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
-	if (!gcduration_values.empty()) {
-		maxGCDuration = *std::max_element(gcduration_values.begin(), gcduration_values.end());
-		minGCDuration = *std::min_element(gcduration_values.begin(), gcduration_values.end());
-		avgGCDuration = getAvg(gcduration_values);
-	}
+	if (argc > 1) {
+		bool toXML = (0 == strcmp(argv[1], "-xml"));
+		for (int i = toXML ? 2 : 1; i < argc; i++) {
+			if (toXML) {
+				convertToXML(argv[i], &portLibrary);
+			} else {
+				analyze(argv[i], &portLibrary);
+			}
+			totalFiles++;
+		}
+	} else {
+		rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
+		if(rcFile == (uintptr_t)-1) {
+			fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
+			return -1;
+		}
 
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
+		while ((uintptr_t)-1 != rcFile) {
+			if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
+				analyze(resultBuffer, &portLibrary);
+				totalFiles++;
+				/* Clean up verbose log file */
+				omrfile_unlink(resultBuffer);
+			}
+			rcFile = omrfile_findnext(handle, resultBuffer);
+		}
+		if (handle != (uintptr_t)-1) {
+			omrfile_findclose(handle);
+		}
+	}
 
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	if(totalFiles < 1) {
+		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
 }
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Lookup throughput and memory footprint microbenchmark for J9HashTable.
+ *
+ * The same set of distinct uintptr_t keys is added to a chained table, a collision resilient (list to AVL tree)
+ * table and an open addressing table (J9HASH_TABLE_OPEN_ADDRESSING), all starting from the default size so that
+ * growth is included in the add time. Lookups of present and of absent keys are then timed in a shuffled order,
+ * so that chained tables do not visit their pool allocated nodes in allocation order, and the bytes the table
+ * holds from the port library are reported, including the node pools.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "hashtable_api.h"
+
+#define LOOKUP_PASSES 3
+#define LIST_TO_TREE_THRESHOLD 8
+
+#if defined(OMR_ENV_DATA64)
+#define KEY_MULTIPLIER J9CONST64(0x9E3779B97F4A7C15)
+#else /* OMR_ENV_DATA64 */
+#define KEY_MULTIPLIER 0x9E3779B9
+#endif /* OMR_ENV_DATA64 */
+
+enum TableKind {
+	LIST_TABLE,
+	TREE_TABLE,
+	OPEN_ADDRESSING_TABLE
+};
+
+static const char * const tableKindNames[] = { "list", "tree", "open" };
+
+/**
+ * Allocation header used to account for the bytes a table holds.
+ */
+typedef struct AllocationHeader {
+	uintptr_t size;
+	uintptr_t padding;
+} AllocationHeader;
+
+static void *(*originalAllocateMemory)(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount, const char *callSite, uint32_t category);
+static void (*originalFreeMemory)(struct OMRPortLibrary *portLibrary, void *memoryPointer);
+static uintptr_t liveBytes;
+static uintptr_t peakBytes;
+
+static void *
+countingAllocateMemory(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount, const char *callSite, uint32_t category)
+{
+	AllocationHeader *header = (AllocationHeader *)originalAllocateMemory(portLibrary, byteAmount + sizeof(AllocationHeader), callSite, category);
+	if (NULL == header) {
+		return NULL;
+	}
+	header->size = byteAmount;
+	liveBytes += byteAmount;
+	peakBytes = OMR_MAX(peakBytes, liveBytes);
+	return header + 1;
+}
+
+static void
+countingFreeMemory(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	if (NULL != memoryPointer) {
+		AllocationHeader *header = (AllocationHeader *)memoryPointer - 1;
+		liveBytes -= header->size;
+		originalFreeMemory(portLibrary, header);
+	}
+}
+
+static uintptr_t
+keyHash(void *entry, void *userData)
+{
+	return *(uintptr_t *)entry;
+}
+
+static uintptr_t
+keyEqual(void *leftEntry, void *rightEntry, void *userData)
+{
+	return *(uintptr_t *)leftEntry == *(uintptr_t *)rightEntry;
+}
+
+static intptr_t
+keyCompare(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struct J9AVLTreeNode *rightNode)
+{
+	uintptr_t leftKey = *(uintptr_t *)AVL_NODE_TO_DATA(leftNode);
+	uintptr_t rightKey = *(uintptr_t *)AVL_NODE_TO_DATA(rightNode);
+
+	if (leftKey == rightKey) {
+		return 0;
+	}
+	return (leftKey < rightKey) ? -1 : 1;
+}
+
+static J9HashTable *
+newTable(OMRPortLibrary *portLibrary, TableKind kind)
+{
+	J9HashTable *table = NULL;
+
+	switch (kind) {
+	case LIST_TABLE:
+		table = hashTableNew(portLibrary, OMR_GET_CALLSITE(), 0, sizeof(uintptr_t), 0, 0, OMRMEM_CATEGORY_VM, keyHash, keyEqual, NULL, NULL);
+		break;
+	case TREE_TABLE:
+		table = collisionResilientHashTableNew(portLibrary, OMR_GET_CALLSITE(), 0, sizeof(uintptr_t), 0, OMRMEM_CATEGORY_VM, LIST_TO_TREE_THRESHOLD, keyHash, keyCompare, NULL, NULL);
+		break;
+	case OPEN_ADDRESSING_TABLE:
+		table = hashTableNew(portLibrary, OMR_GET_CALLSITE(), 0, sizeof(uintptr_t), 0, J9HASH_TABLE_OPEN_ADDRESSING, OMRMEM_CATEGORY_VM, keyHash, keyEqual, NULL, NULL);
+		break;
+	}
+	return table;
+}
+
+/**
+ * Look up every key, LOOKUP_PASSES times, and return the number of keys found.
+ */
+static uintptr_t
+findKeys(J9HashTable *table, uintptr_t *keys, uintptr_t count)
+{
+	uintptr_t found = 0;
+
+	for (uintptr_t pass = 0; pass < LOOKUP_PASSES; pass++) {
+		for (uintptr_t i = 0; i < count; i++) {
+			if (NULL != hashTableFind(table, &keys[i])) {
+				found += 1;
+			}
+		}
+	}
+	return found;
+}
+
+static double
+operationsPerSecond(uintptr_t operations, uint64_t elapsedMicros)
+{
+	return ((double)operations * 1000000.0) / (double)OMR_MAX(elapsedMicros, 1);
+}
+
+static void
+runBenchmark(OMRPortLibrary *portLibrary, TableKind kind, uintptr_t *keys, uintptr_t *lookupKeys, uintptr_t *absentKeys, uintptr_t count)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t added = 0;
+	uintptr_t hits = 0;
+	uintptr_t misses = 0;
+	uintptr_t tableBytes = 0;
+	uintptr_t tablePeakBytes = 0;
+
+	/* only the table allocates while the port library is counting */
+	liveBytes = 0;
+	peakBytes = 0;
+	originalAllocateMemory = portLibrary->mem_allocate_memory;
+	originalFreeMemory = portLibrary->mem_free_memory;
+	portLibrary->mem_allocate_memory = countingAllocateMemory;
+	portLibrary->mem_free_memory = countingFreeMemory;
+
+	J9HashTable *table = newTable(portLibrary, kind);
+	if (NULL != table) {
+		uint64_t startTime = omrtime_hires_clock();
+		for (uintptr_t i = 0; i < count; i++) {
+			if (NULL != hashTableAdd(table, &keys[i])) {
+				added += 1;
+			}
+		}
+		uint64_t addMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		tableBytes = liveBytes;
+		tablePeakBytes = peakBytes;
+
+		startTime = omrtime_hires_clock();
+		hits = findKeys(table, lookupKeys, count);
+		uint64_t hitMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		startTime = omrtime_hires_clock();
+		misses = (LOOKUP_PASSES * count) - findKeys(table, absentKeys, count);
+		uint64_t missMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		hashTableFree(table);
+		portLibrary->mem_allocate_memory = originalAllocateMemory;
+		portLibrary->mem_free_memory = originalFreeMemory;
+
+		if ((added != count) || (hits != (LOOKUP_PASSES * count)) || (misses != (LOOKUP_PASSES * count))) {
+			omrtty_printf("%-5s %9d lookup verification failed: added=%zu hits=%zu misses=%zu\n", tableKindNames[kind], (int)count, added, hits, misses);
+			return;
+		}
+		omrtty_printf("%-5s %9d %14.0f %14.0f %14.0f %12zu %12zu %8.1f\n",
+				tableKindNames[kind], (int)count,
+				operationsPerSecond(count, addMicros),
+				operationsPerSecond(LOOKUP_PASSES * count, hitMicros),
+				operationsPerSecond(LOOKUP_PASSES * count, missMicros),
+				tableBytes, tablePeakBytes, (double)tableBytes / (double)count);
+	} else {
+		portLibrary->mem_allocate_memory = originalAllocateMemory;
+		portLibrary->mem_free_memory = originalFreeMemory;
+		omrtty_printf("%-5s %9d failed to allocate the table\n", tableKindNames[kind], (int)count);
+	}
+}
+
+int
+main(void)
+{
+	OMRPortLibrary portLibrary;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	const uintptr_t counts[] = { 1024 * 1024, 4 * 1024 * 1024 };
+	const uintptr_t maxCount = counts[(sizeof(counts) / sizeof(counts[0])) - 1];
+	uintptr_t *keys = (uintptr_t *)omrmem_allocate_memory(3 * maxCount * sizeof(uintptr_t), OMRMEM_CATEGORY_VM);
+	if (NULL == keys) {
+		omrtty_printf("Failed to allocate benchmark keys\n");
+		return -1;
+	}
+
+	/* multiplying by an odd constant is a bijection, so the keys are distinct and scattered */
+	uintptr_t *lookupKeys = keys + maxCount;
+	uintptr_t *absentKeys = lookupKeys + maxCount;
+	for (uintptr_t i = 0; i < maxCount; i++) {
+		keys[i] = (i + 1) * KEY_MULTIPLIER;
+		absentKeys[i] = (maxCount + i + 1) * KEY_MULTIPLIER;
+	}
+
+	omrtty_printf("%-5s %9s %14s %14s %14s %12s %12s %8s\n", "table", "entries", "adds/s", "hits/s", "misses/s", "bytes", "peak bytes", "B/entry");
+	for (uintptr_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+		/* shuffle the keys present in the table for the lookups */
+		uint32_t seed = 1;
+		memcpy(lookupKeys, keys, counts[c] * sizeof(uintptr_t));
+		for (uintptr_t i = counts[c] - 1; i > 0; i--) {
+			seed = (seed * 1103515245) + 12345;
+			uintptr_t j = (((uintptr_t)seed << 15) ^ (seed >> 8)) % (i + 1);
+			uintptr_t key = lookupKeys[i];
+			lookupKeys[i] = lookupKeys[j];
+			lookupKeys[j] = key;
+		}
+		for (uintptr_t kind = LIST_TABLE; kind <= OPEN_ADDRESSING_TABLE; kind++) {
+			runBenchmark(&portLibrary, (TableKind)kind, keys, lookupKeys, absentKeys, counts[c]);
+		}
+	}
+
+	omrmem_free_memory(keys);
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return 0;
+}
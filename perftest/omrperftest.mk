@@ -1,5 +1,5 @@
 ###############################################################################
-# Copyright (c) 2016, 2016 IBM Corp. and others
+# Copyright (c) 2016, 2026 IBM Corp. and others
 # 
 # This program and the accompanying materials are made available under
 # the terms of the Eclipse Public License 2.0 which accompanies this
@@ -45,5 +45,6 @@ all: test
 omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
+	./omrperfallocationtest
 
 .PHONY: all test omr_perfgctest 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -57,6 +57,26 @@
 #define HASH_TABLE_SIZE_MIN 17
 #define HASH_TABLE_SIZE_MAX 2200103
 
+#if defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define HASHTABLE_SSE2_GROUP_PROBE
+#include <emmintrin.h>
+#endif /* defined(OMR_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) */
+
+/**
+ * Open addressing tables keep one control byte per slot, in groups of OPEN_ADDRESSING_GROUP_WIDTH.
+ * A full slot's control byte holds the low 7 bits of the entry's hash, empty and deleted slots have the top bit set.
+ * Groups are aligned and probed triangularly, so a lookup only leaves a group that has no empty slot.
+ */
+#define OPEN_ADDRESSING_GROUP_WIDTH 16
+#define OPEN_ADDRESSING_CONTROL_EMPTY ((uint8_t)0x80)
+#define OPEN_ADDRESSING_CONTROL_DELETED ((uint8_t)0xFE)
+#define OPEN_ADDRESSING_CONTROL_IS_FULL(control) (0 == ((control) & 0x80))
+#define OPEN_ADDRESSING_NOT_FOUND U_32_MAX
+#define OPEN_ADDRESSING_SIZE_MAX ((uint32_t)1 << 30)
+/* Grow when more than 7/8 of the slots are full or deleted */
+#define OPEN_ADDRESSING_MAX_LOAD(capacity) ((capacity) - ((capacity) >> 3))
+#define OPEN_ADDRESSING_SLOT(table, index) ((void *)((uint8_t *)(table)->nodes + ((uintptr_t)(index) * (table)->listNodeSize)))
+
 /**
  * Node macros
  */
@@ -92,6 +112,19 @@ static void rebuildFromPools(J9HashTable *table, uint32_t newSize, void **newNod
 static uintptr_t hashTableGrowSpaceOpt(J9HashTable *, uint32_t newSize);
 static uintptr_t hashTableGrowListNodes(J9HashTable *table, uint32_t newSize);
 static uintptr_t collisionResilientHashTableGrow(J9HashTable *table, uint32_t newSize);
+static uintptr_t openAddressingHash(J9HashTable *table, void *entry);
+static uint32_t openAddressingMatch(const uint8_t *group, uint8_t hashBits);
+static uint32_t openAddressingMatchEmpty(const uint8_t *group);
+static uint32_t openAddressingMatchEmptyOrDeleted(const uint8_t *group);
+static uint32_t openAddressingLowestBit(uint32_t mask);
+static uint32_t openAddressingFindIndex(J9HashTable *table, void *entry, uintptr_t hash);
+static uint32_t openAddressingFindInsertIndex(const uint8_t *controlBytes, uint32_t capacity, uintptr_t hash);
+static uint32_t openAddressingNextFullIndex(J9HashTable *table, uint32_t index);
+static uintptr_t openAddressingAllocate(J9HashTable *table, uint32_t capacity);
+static void *openAddressingAdd(J9HashTable *table, void *entry);
+static void openAddressingRemoveIndex(J9HashTable *table, uint32_t index);
+static uintptr_t openAddressingResize(J9HashTable *table, uint32_t newCapacity);
+static void openAddressingRehashInPlace(J9HashTable *table);
 
 static const uint32_t primesTable[] = {
 	17,
@@ -235,6 +268,14 @@ collisionResilientHashTableNew(
  *  	hashTableRehash()
  *  	hashTableDoRemove()
  *
+ *  When J9HASH_TABLE_OPEN_ADDRESSING is defined, entries are stored inline in a power of two
+ *  sized array of slots, next to one control byte per slot holding 7 bits of the entry's hash.
+ *  Lookups compare a group of 16 control bytes at once (using SSE2 where available) and only
+ *  call hashEqualFn for slots whose control byte matches. All hash table functions are supported.
+ *  Entry pointers are invalidated when the table grows or is rehashed, as for the space optimized
+ *  table, and entries are aligned to at most sizeof(uintptr_t). This flag is ignored together
+ *  with J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32.
+ *
  */
 J9HashTable *
 hashTableNew(
@@ -273,6 +314,15 @@ hashTableNewImpl(
 	BOOLEAN spaceOpt = FALSE;
 	HASHTABLE_DEBUG_PORT(portLibrary);
 
+	if ((J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT))
+#if defined(OMR_ENV_DATA64)
+		|| (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32))
+#endif /* OMR_ENV_DATA64 */
+	) {
+		/* entries are not stored inline in a collision resilient or malloc32 table */
+		flags &= ~(uint32_t)J9HASH_TABLE_OPEN_ADDRESSING;
+	}
+
 	hashTable = portLibrary->mem_allocate_memory(portLibrary, sizeof(J9HashTable), tableName, memoryCategory);
 	hashTable_printf("hashTableNew <%s>: tableSize=%d, table=%p\n", tableName, tableSize, hashTable);
 	if (NULL == hashTable) {
@@ -311,6 +361,28 @@ hashTableNewImpl(
 	}
 	hashTable->nodeAlignment = entryAlignment;
 
+	if (hashTableIsOpenAddressing(hashTable)) {
+		uint32_t capacity = OPEN_ADDRESSING_GROUP_WIDTH;
+
+		/* listNodeSize is the slot stride, there is no next-pointer */
+		hashTable->listNodeSize = ROUND_TO_SIZEOF_UDATA(entrySize);
+		if (entryAlignment > 1) {
+			hashTable->listNodeSize = ((hashTable->listNodeSize + entryAlignment - 1) / entryAlignment) * entryAlignment;
+		}
+		hashTable->treeNodeSize = 0;
+		hashTable->equalFnUserData = functionUserData;
+		hashTable->hashEqualFn = hashEqualFn;
+
+		/* room for tableSize entries without growing */
+		while ((OPEN_ADDRESSING_MAX_LOAD(capacity) < tableSize) && (capacity < OPEN_ADDRESSING_SIZE_MAX)) {
+			capacity <<= 1;
+		}
+		if (0 != openAddressingAllocate(hashTable, capacity)) {
+			goto error;
+		}
+		return hashTable;
+	}
+
 	if (J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION == ((flags & J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION))
 		&& (hashTable->listNodeSize == (2 * sizeof(uintptr_t)))
 		&& (hashTable->tableSize <= SPACE_OPT_LIMIT)
@@ -441,13 +513,20 @@ hashTableFree(J9HashTable *hashTable)
 void *
 hashTableFind(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	void *findNode = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableFind <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		uint32_t index = openAddressingFindIndex(table, entry, openAddressingHash(table, entry));
+		return (OPEN_ADDRESSING_NOT_FOUND != index) ? OPEN_ADDRESSING_SLOT(table, index) : NULL;
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
 	if (NULL == table->listNodePool) {
 		void **node = hashTableFindNodeSpaceOpt(table, entry, head);
 		findNode = (NULL != *node) ? node : NULL;
@@ -516,14 +595,21 @@ hashTableFindNodeInTree(J9HashTable *table, void *entry, void **head)
 void *
 hashTableAdd(J9HashTable *table, void *entry)
 {
-	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
-	void **head = &table->nodes[hashCode % table->tableSize];
+	uintptr_t hashCode = 0;
+	void **head = NULL;
 	void *addNode = NULL;
 	BOOLEAN growFailure = FALSE;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableAdd <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingAdd(table, entry);
+	}
+
+	hashCode = table->hashFn(entry, table->hashFnUserData);
+	head = &table->nodes[hashCode % table->tableSize];
+
 	if ((table->numberOfNodes + 1) == table->tableSize) {
 		if (!hashTableCanGrow(table)) {
 			goto done;
@@ -702,13 +788,24 @@ listToTree(J9HashTable *table, void **head, uintptr_t listLength)
 uint32_t
 hashTableRemove(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	uint32_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableRemove <%s>: table=%p, entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		uint32_t index = openAddressingFindIndex(table, entry, openAddressingHash(table, entry));
+		if (OPEN_ADDRESSING_NOT_FOUND != index) {
+			openAddressingRemoveIndex(table, index);
+			rc = 0;
+		}
+		return rc;
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
 	if (NULL == table->listNodePool) {
 		rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
 	} else if (NULL == *head) {
@@ -821,7 +918,7 @@ hashTableForEachDo(J9HashTable *table, J9HashTableDoFn doFn, void *opaque)
 
 	hashTable_printf("hashTableForEachDo <%s>: table=%p\n", table->tableName, table);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsSpaceOptimized(table)) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
 	}
@@ -854,6 +951,11 @@ hashTableRehash(J9HashTable *table)
 	void  *tail = NULL;
 	uintptr_t tableSize = table->tableSize;
 
+	if (hashTableIsOpenAddressing(table)) {
+		openAddressingRehashInPlace(table);
+		return;
+	}
+
 	if (NULL == table->listNodePool) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
@@ -1012,7 +1114,15 @@ hashTableStartDo(J9HashTable *table,  J9HashTableState *handle)
 	handle->didDeleteCurrentNode = FALSE;
 	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		/* bucketIndex is the index of the current slot */
+		handle->bucketIndex = openAddressingNextFullIndex(table, 0);
+		if (handle->bucketIndex < table->tableSize) {
+			result = OPEN_ADDRESSING_SLOT(table, handle->bucketIndex);
+		} else {
+			handle->iterateState = J9HASH_TABLE_ITERATE_STATE_FINISHED;
+		}
+	} else if (NULL == table->listNodePool) {
 		/* find the first non-empty bucket */
 		while (handle->bucketIndex < table->tableSize) {
 			void **node = &table->nodes[handle->bucketIndex];
@@ -1071,7 +1181,17 @@ hashTableNextDo(J9HashTableState *handle)
 	void *result = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		/* removing the current slot does not move other entries, so always advance */
+		if (J9HASH_TABLE_ITERATE_STATE_FINISHED != handle->iterateState) {
+			handle->bucketIndex = openAddressingNextFullIndex(table, handle->bucketIndex + 1);
+			if (handle->bucketIndex < table->tableSize) {
+				result = OPEN_ADDRESSING_SLOT(table, handle->bucketIndex);
+			} else {
+				handle->iterateState = J9HASH_TABLE_ITERATE_STATE_FINISHED;
+			}
+		}
+	} else if (NULL == table->listNodePool) {
 		/* space optimized hashTable - advance to the next bucket */
 		handle->bucketIndex += 1;
 		while (handle->bucketIndex < table->tableSize) {
@@ -1158,8 +1278,15 @@ hashTableDoRemove(J9HashTableState *handle)
 	uintptr_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	/* operation not supported on a space optimized hashTable */
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		if ((J9HASH_TABLE_ITERATE_STATE_FINISHED != handle->iterateState)
+			&& OPEN_ADDRESSING_CONTROL_IS_FULL(table->controlBytes[handle->bucketIndex])
+		) {
+			openAddressingRemoveIndex(table, handle->bucketIndex);
+			rc = 0;
+		}
+	} else if (NULL == table->listNodePool) {
+		/* operation not supported on a space optimized hashTable */
 		Assert_hashTable_unreachable();
 	} else {
 		void *currentNode = NULL;
@@ -1361,3 +1488,341 @@ hashTableNextSize(uint32_t size)
 
 	return 0;
 }
+
+/**
+ * Mix the user hash so that both the control byte (low 7 bits) and the probe start (remaining bits)
+ * are well distributed, even for identity hashes of aligned pointers or small integers.
+ */
+static uintptr_t
+openAddressingHash(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = table->hashFn(entry, table->hashFnUserData);
+#if defined(OMR_ENV_DATA64)
+	hash ^= hash >> 33;
+	hash *= J9CONST64(0xff51afd7ed558ccd);
+	hash ^= hash >> 33;
+#else /* OMR_ENV_DATA64 */
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+#endif /* OMR_ENV_DATA64 */
+	return hash;
+}
+
+/**
+ * Return a bit mask with bit i set if control byte i of the group is full and holds hashBits.
+ */
+static uint32_t
+openAddressingMatch(const uint8_t *group, uint8_t hashBits)
+{
+#if defined(HASHTABLE_SSE2_GROUP_PROBE)
+	__m128i control = _mm_loadu_si128((const __m128i *)group);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)hashBits)));
+#else /* defined(HASHTABLE_SSE2_GROUP_PROBE) */
+	uint32_t mask = 0;
+	uint32_t i = 0;
+	for (i = 0; i < OPEN_ADDRESSING_GROUP_WIDTH; i++) {
+		if (hashBits == group[i]) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif /* defined(HASHTABLE_SSE2_GROUP_PROBE) */
+}
+
+/**
+ * Return a bit mask with bit i set if control byte i of the group is empty.
+ */
+static uint32_t
+openAddressingMatchEmpty(const uint8_t *group)
+{
+#if defined(HASHTABLE_SSE2_GROUP_PROBE)
+	__m128i control = _mm_loadu_si128((const __m128i *)group);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)OPEN_ADDRESSING_CONTROL_EMPTY)));
+#else /* defined(HASHTABLE_SSE2_GROUP_PROBE) */
+	return openAddressingMatch(group, OPEN_ADDRESSING_CONTROL_EMPTY);
+#endif /* defined(HASHTABLE_SSE2_GROUP_PROBE) */
+}
+
+/**
+ * Return a bit mask with bit i set if control byte i of the group is empty or deleted.
+ */
+static uint32_t
+openAddressingMatchEmptyOrDeleted(const uint8_t *group)
+{
+#if defined(HASHTABLE_SSE2_GROUP_PROBE)
+	/* only empty and deleted control bytes have the top bit set */
+	return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else /* defined(HASHTABLE_SSE2_GROUP_PROBE) */
+	uint32_t mask = 0;
+	uint32_t i = 0;
+	for (i = 0; i < OPEN_ADDRESSING_GROUP_WIDTH; i++) {
+		if (!OPEN_ADDRESSING_CONTROL_IS_FULL(group[i])) {
+			mask |= (uint32_t)1 << i;
+		}
+	}
+	return mask;
+#endif /* defined(HASHTABLE_SSE2_GROUP_PROBE) */
+}
+
+static uint32_t
+openAddressingLowestBit(uint32_t mask)
+{
+#if defined(__GNUC__)
+	return (uint32_t)__builtin_ctz(mask);
+#else /* defined(__GNUC__) */
+	uint32_t bit = 0;
+	while (0 == (mask & 1)) {
+		mask >>= 1;
+		bit += 1;
+	}
+	return bit;
+#endif /* defined(__GNUC__) */
+}
+
+/**
+ * Return the index of the slot holding an entry equal to entry, or OPEN_ADDRESSING_NOT_FOUND.
+ */
+static uint32_t
+openAddressingFindIndex(J9HashTable *table, void *entry, uintptr_t hash)
+{
+	uint32_t groupMask = (table->tableSize / OPEN_ADDRESSING_GROUP_WIDTH) - 1;
+	uint32_t group = (uint32_t)(hash >> 7) & groupMask;
+	uint8_t hashBits = (uint8_t)(hash & 0x7F);
+	uint32_t probe = 0;
+
+	for (probe = 0; probe <= groupMask; probe++) {
+		const uint8_t *control = table->controlBytes + (group * OPEN_ADDRESSING_GROUP_WIDTH);
+		uint32_t match = openAddressingMatch(control, hashBits);
+		while (0 != match) {
+			uint32_t index = (group * OPEN_ADDRESSING_GROUP_WIDTH) + openAddressingLowestBit(match);
+			if (0 != table->hashEqualFn(OPEN_ADDRESSING_SLOT(table, index), entry, table->equalFnUserData)) {
+				return index;
+			}
+			match &= match - 1;
+		}
+		if (0 != openAddressingMatchEmpty(control)) {
+			/* an entry is never placed past a group with an empty slot */
+			break;
+		}
+		/* triangular probing visits every group of a power of two sized table */
+		group = (group + probe + 1) & groupMask;
+	}
+	return OPEN_ADDRESSING_NOT_FOUND;
+}
+
+/**
+ * Return the index of the first empty or deleted slot in the probe sequence of hash, or OPEN_ADDRESSING_NOT_FOUND if all slots are full.
+ */
+static uint32_t
+openAddressingFindInsertIndex(const uint8_t *controlBytes, uint32_t capacity, uintptr_t hash)
+{
+	uint32_t groupMask = (capacity / OPEN_ADDRESSING_GROUP_WIDTH) - 1;
+	uint32_t group = (uint32_t)(hash >> 7) & groupMask;
+	uint32_t probe = 0;
+
+	for (probe = 0; probe <= groupMask; probe++) {
+		uint32_t match = openAddressingMatchEmptyOrDeleted(controlBytes + (group * OPEN_ADDRESSING_GROUP_WIDTH));
+		if (0 != match) {
+			return (group * OPEN_ADDRESSING_GROUP_WIDTH) + openAddressingLowestBit(match);
+		}
+		group = (group + probe + 1) & groupMask;
+	}
+	return OPEN_ADDRESSING_NOT_FOUND;
+}
+
+/**
+ * Return the index of the first full slot at or after index, or tableSize if there is none.
+ */
+static uint32_t
+openAddressingNextFullIndex(J9HashTable *table, uint32_t index)
+{
+	while ((index < table->tableSize) && !OPEN_ADDRESSING_CONTROL_IS_FULL(table->controlBytes[index])) {
+		index += 1;
+	}
+	return index;
+}
+
+/**
+ * Allocate empty slots and control bytes for capacity entries, and install them in the table.
+ * The control bytes follow the slots in the same allocation.
+ * Returns 0 on success, 1 on failure (the table is unchanged).
+ */
+static uintptr_t
+openAddressingAllocate(J9HashTable *table, uint32_t capacity)
+{
+	uintptr_t slotsSize = (uintptr_t)capacity * table->listNodeSize;
+	uint8_t *newNodes = NULL;
+
+	if ((slotsSize / table->listNodeSize) != capacity) {
+		return 1;
+	}
+	newNodes = table->portLibrary->mem_allocate_memory(table->portLibrary, slotsSize + capacity, table->tableName, table->memoryCategory);
+	if (NULL == newNodes) {
+		return 1;
+	}
+	memset(newNodes + slotsSize, OPEN_ADDRESSING_CONTROL_EMPTY, capacity);
+
+	table->nodes = (void **)newNodes;
+	table->controlBytes = newNodes + slotsSize;
+	table->tableSize = capacity;
+	table->numberOfNodes = 0;
+	table->numberOfDeletedNodes = 0;
+	return 0;
+}
+
+static void *
+openAddressingAdd(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = openAddressingHash(table, entry);
+	uint32_t index = openAddressingFindIndex(table, entry, hash);
+	void *slot = NULL;
+
+	if (OPEN_ADDRESSING_NOT_FOUND != index) {
+		/* found the entry in the table */
+		return OPEN_ADDRESSING_SLOT(table, index);
+	}
+
+	index = openAddressingFindInsertIndex(table->controlBytes, table->tableSize, hash);
+	if (((OPEN_ADDRESSING_NOT_FOUND == index) || (OPEN_ADDRESSING_CONTROL_EMPTY == table->controlBytes[index]))
+		&& ((table->numberOfNodes + table->numberOfDeletedNodes) >= OPEN_ADDRESSING_MAX_LOAD(table->tableSize))
+		&& hashTableCanGrow(table)
+		&& (0 != hashTableCanRehash(table))
+	) {
+		/* Out of growth room. Reclaim deleted slots if that leaves the table no more than 25/32 full,
+		 * otherwise double the table.  If growing fails, any free slot is still usable.
+		 */
+		uintptr_t rc = 1;
+		if ((((uintptr_t)table->numberOfNodes + 1) * 32) > ((uintptr_t)table->tableSize * 25)) {
+			rc = openAddressingResize(table, table->tableSize * 2);
+		}
+		if ((0 != rc) && (0 != table->numberOfDeletedNodes)) {
+			openAddressingRehashInPlace(table);
+			rc = 0;
+		}
+		if (0 == rc) {
+			index = openAddressingFindInsertIndex(table->controlBytes, table->tableSize, hash);
+		}
+	}
+
+	if (OPEN_ADDRESSING_NOT_FOUND != index) {
+		slot = OPEN_ADDRESSING_SLOT(table, index);
+		memcpy(slot, entry, table->entrySize);
+		if (OPEN_ADDRESSING_CONTROL_DELETED == table->controlBytes[index]) {
+			table->numberOfDeletedNodes -= 1;
+		}
+		if (!hashTableCanGrow(table)) {
+			issueWriteBarrier();
+		}
+		table->controlBytes[index] = (uint8_t)(hash & 0x7F);
+		table->numberOfNodes += 1;
+	}
+	return slot;
+}
+
+static void
+openAddressingRemoveIndex(J9HashTable *table, uint32_t index)
+{
+	const uint8_t *group = table->controlBytes + (index & ~(uint32_t)(OPEN_ADDRESSING_GROUP_WIDTH - 1));
+
+	/* A group that still has an empty slot has never been full since it was last rehashed, so no
+	 * probe sequence continues past it and the slot can be emptied rather than marked deleted.
+	 */
+	if (0 != openAddressingMatchEmpty(group)) {
+		table->controlBytes[index] = OPEN_ADDRESSING_CONTROL_EMPTY;
+	} else {
+		table->controlBytes[index] = OPEN_ADDRESSING_CONTROL_DELETED;
+		table->numberOfDeletedNodes += 1;
+	}
+	table->numberOfNodes -= 1;
+}
+
+/**
+ * Move all entries into a new table of newCapacity slots.
+ * Returns 0 on success, 1 on failure (the table is unchanged).
+ */
+static uintptr_t
+openAddressingResize(J9HashTable *table, uint32_t newCapacity)
+{
+	void **oldNodes = table->nodes;
+	uint8_t *oldControlBytes = table->controlBytes;
+	uint32_t oldCapacity = table->tableSize;
+	uint32_t numberOfNodes = table->numberOfNodes;
+	uint32_t i = 0;
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+	if ((newCapacity > OPEN_ADDRESSING_SIZE_MAX) || (0 != openAddressingAllocate(table, newCapacity))) {
+		return 1;
+	}
+
+	for (i = 0; i < oldCapacity; i++) {
+		if (OPEN_ADDRESSING_CONTROL_IS_FULL(oldControlBytes[i])) {
+			void *oldSlot = (uint8_t *)oldNodes + ((uintptr_t)i * table->listNodeSize);
+			uintptr_t hash = openAddressingHash(table, oldSlot);
+			uint32_t index = openAddressingFindInsertIndex(table->controlBytes, newCapacity, hash);
+
+			memcpy(OPEN_ADDRESSING_SLOT(table, index), oldSlot, table->listNodeSize);
+			table->controlBytes[index] = (uint8_t)(hash & 0x7F);
+			table->numberOfNodes += 1;
+		}
+	}
+	/* Sanity check to make sure that the old hash table had calculated the right number of nodes */
+	HASHTABLE_ASSERT(numberOfNodes == table->numberOfNodes);
+	omrmem_free_memory(oldNodes);
+	return 0;
+}
+
+/**
+ * Re-place every entry of the table without allocating, dropping all deleted slots.
+ * Used to reclaim deleted slots and by hashTableRehash().
+ */
+static void
+openAddressingRehashInPlace(J9HashTable *table)
+{
+	uint8_t *controlBytes = table->controlBytes;
+	uint32_t capacity = table->tableSize;
+	uint32_t i = 0;
+
+	/* Mark every entry deleted to note it still has to be placed, and every free slot empty */
+	for (i = 0; i < capacity; i++) {
+		controlBytes[i] = OPEN_ADDRESSING_CONTROL_IS_FULL(controlBytes[i]) ? OPEN_ADDRESSING_CONTROL_DELETED : OPEN_ADDRESSING_CONTROL_EMPTY;
+	}
+
+	for (i = 0; i < capacity; i++) {
+		void *slot = NULL;
+		uintptr_t hash = 0;
+		uint32_t index = 0;
+
+		if (OPEN_ADDRESSING_CONTROL_DELETED != controlBytes[i]) {
+			continue;
+		}
+		slot = OPEN_ADDRESSING_SLOT(table, i);
+		hash = openAddressingHash(table, slot);
+		/* cannot fail, slot i itself is deleted */
+		index = openAddressingFindInsertIndex(controlBytes, capacity, hash);
+
+		if ((index / OPEN_ADDRESSING_GROUP_WIDTH) == (i / OPEN_ADDRESSING_GROUP_WIDTH)) {
+			/* already in the first group a lookup reaches with room to spare */
+			controlBytes[i] = (uint8_t)(hash & 0x7F);
+		} else if (OPEN_ADDRESSING_CONTROL_EMPTY == controlBytes[index]) {
+			memcpy(OPEN_ADDRESSING_SLOT(table, index), slot, table->listNodeSize);
+			controlBytes[index] = (uint8_t)(hash & 0x7F);
+			controlBytes[i] = OPEN_ADDRESSING_CONTROL_EMPTY;
+		} else {
+			/* the target holds an entry not placed yet: swap it into slot i and place it next */
+			uintptr_t *left = (uintptr_t *)slot;
+			uintptr_t *right = (uintptr_t *)OPEN_ADDRESSING_SLOT(table, index);
+			uintptr_t words = table->listNodeSize / sizeof(uintptr_t);
+			uintptr_t word = 0;
+
+			for (word = 0; word < words; word++) {
+				uintptr_t temp = left[word];
+				left[word] = right[word];
+				right[word] = temp;
+			}
+			controlBytes[index] = (uint8_t)(hash & 0x7F);
+			i -= 1;
+		}
+	}
+	table->numberOfDeletedNodes = 0;
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -22,7 +22,6 @@
 
 #include <string.h>
 #include <stdarg.h>
-#include "pool_api.h"
 #include "omrthread.h"
 #include "omrhookable.h"
 #include "omrmemcategories.h"
@@ -43,6 +42,7 @@ static void J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t tag
 static intptr_t J9HookReserve(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum);
 static uintptr_t J9HookAllocateAgentID(struct J9HookInterface **hookInterface);
 static void J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentID);
+static void J9HookAggregateEventCounts(struct J9HookInterface **hookInterface);
 
 static const J9HookInterface hookFunctionTable = {
 	J9HookDispatch,
@@ -55,12 +55,13 @@ static const J9HookInterface hookFunctionTable = {
 	J9HookIsEnabled,
 	J9HookAllocateAgentID,
 	J9HookDeallocateAgentID,
+	J9HookAggregateEventCounts,
 };
 
 /* flags are stored at the beginning of the interface just after the common interface fields in ascending order */
 #define HOOK_FLAGS(interface, event) (((uint8_t*)((interface) + 1))[event])
 
-/* records are stored at the END of the interface in descending order */
+/* the published record array of each event is stored at the END of the interface in descending order */
 #define HOOK_RECORD(interface, event) (((J9HookRecord**)( (uint8_t*)(interface) + (interface)->size ))[ -1 - (event)])
 
 /* e.g.
@@ -77,15 +78,263 @@ static const J9HookInterface hookFunctionTable = {
 1C: record[0]
 */
 
-/* each record has an ID which is used to detect inconsistent records without resorting to monitors */
-/* even IDs are valid. Odd IDs are invalid */
-/* a record is consistent if the same ID is in the record before all the fields are read and after all the fields are read */
-/* read and write barriers must be used to ensure that reads and writes occur in the correct order */
+/*
+ * The records of an event are published as an immutable array, which follows a J9HookRecordArray header.
+ * Registration copies the array, and the replaced array is reclaimed once no dispatch can still be reading it.
+ * The only change ever made to a published record is to invalidate it when it is unregistered, so that
+ * dispatches already walking the array skip it. Even IDs are valid. Odd IDs are invalid.
+ */
 #define HOOK_INITIAL_ID (0)
 #define HOOK_IS_VALID_ID(id) ( ((id) & 1) == 0)
 #define HOOK_INVALID_ID(id) ((id) | 1)
-#define HOOK_VALID_ID(id) ( (((id) | 1) + 1) )
+#define HOOK_RECORD_ARRAY(records) (((J9HookRecordArray *)(records)) - 1)
+
+/* dispatch counts are sharded by thread, so that threads reporting the same hot event do not all update one cache line */
+#define HOOK_COUNT_SHARD_BITS 4
+#define HOOK_COUNT_SHARDS ((uintptr_t)1 << HOOK_COUNT_SHARD_BITS)
+#define HOOK_COUNT_CACHE_LINE_SIZE 64
+/* each shard holds the count of every event, then the dispatches in progress in each of the two epochs */
+#define HOOK_COUNT_SHARD_SLOTS(eventSize) ((eventSize) + 2)
+/* the counters of each shard are followed by at least one cache line of padding, so shards never share a line */
+#define HOOK_COUNT_SHARD_STRIDE(eventSize) \
+	((((((HOOK_COUNT_SHARD_SLOTS(eventSize)) * sizeof(uintptr_t)) + HOOK_COUNT_CACHE_LINE_SIZE - 1) / HOOK_COUNT_CACHE_LINE_SIZE) + 1) * HOOK_COUNT_CACHE_LINE_SIZE / sizeof(uintptr_t))
+
+/* the counts of dispatches in progress order the reads of the records; locked instructions are already full barriers on x86 */
+#if defined(J9HAMMER) || defined(J9X86)
+#define HOOK_DISPATCH_BARRIER()
+/* loads are not reordered with later stores on x86, so only the compiler must keep the records read before the count drops */
+#define HOOK_DISPATCH_EXIT_BARRIER() VM_AtomicSupport::compilerReorderingBarrier()
+#else /* defined(J9HAMMER) || defined(J9X86) */
+#define HOOK_DISPATCH_BARRIER() VM_AtomicSupport::readWriteBarrier()
+#define HOOK_DISPATCH_EXIT_BARRIER() VM_AtomicSupport::readWriteBarrier()
+#endif /* defined(J9HAMMER) || defined(J9X86) */
+
+/* spread the threads over the shards by the (Fibonacci) hash of their omrthread_t */
+#define HOOK_COUNT_SHARD(thread) ((uintptr_t)(((uint32_t)((uintptr_t)(thread) >> 4) * (uint32_t)2654435769U) >> (32 - HOOK_COUNT_SHARD_BITS)))
+/* a shard folds the counts of all shards into OMREventInfo4Dump::count each time its own count of an event passes a multiple of this */
+#define HOOK_COUNT_FOLD_INTERVAL ((uintptr_t)256)
+
+
+/*
+ * Allocate an unpublished array of length records, which are linked in order once they are filled in.
+ * Returns NULL on failure.
+ */
+static J9HookRecord *
+hookAllocateRecords(J9CommonHookInterface *commonInterface, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	J9HookRecordArray *array = (J9HookRecordArray *)omrmem_allocate_memory(sizeof(J9HookRecordArray) + (length * sizeof(J9HookRecord)), OMRMEM_CATEGORY_VM);
+	if (NULL == array) {
+		return NULL;
+	}
+	array->nextRetired = NULL;
+	array->length = length;
+	return (J9HookRecord *)(array + 1);
+}
+
+/*
+ * Chain the records of an array through their next fields, for code which walks the records as a list.
+ */
+static void
+hookLinkRecords(J9HookRecord *records, uintptr_t length)
+{
+	for (uintptr_t i = 0; i < length; i++) {
+		records[i].next = ((i + 1) < length) ? &records[i + 1] : NULL;
+	}
+}
+
+static void
+hookFreeRecordArrays(J9CommonHookInterface *commonInterface, J9HookRecordArray *arrays)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	while (NULL != arrays) {
+		J9HookRecordArray *next = arrays->nextRetired;
+		omrmem_free_memory(arrays);
+		arrays = next;
+	}
+}
+
+/*
+ * Unlink and free the counts of the dispatches in progress on a thread which is detaching or terminating.
+ * This is the finalizer of threadDispatchesKey.
+ */
+static void J9THREAD_PROC
+hookFreeThreadDispatches(void *entry)
+{
+	J9HookThreadDispatches *threadDispatches = (J9HookThreadDispatches *)entry;
+	J9CommonHookInterface *commonInterface = threadDispatches->commonInterface;
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+
+	omrthread_monitor_enter(commonInterface->lock);
+	if (NULL != threadDispatches->previous) {
+		threadDispatches->previous->next = threadDispatches->next;
+	} else {
+		commonInterface->threadDispatches = threadDispatches->next;
+	}
+	if (NULL != threadDispatches->next) {
+		threadDispatches->next->previous = threadDispatches->previous;
+	}
+	omrthread_monitor_exit(commonInterface->lock);
+
+	omrmem_free_memory(threadDispatches);
+}
+
+/*
+ * Find the counts of the dispatches in progress on the calling thread, allocating them on its first dispatch.
+ * Returns NULL if the thread is not attached or the counts could not be allocated, in which case its
+ * dispatches are counted in the shard of the thread instead.
+ */
+static J9HookThreadDispatches *
+hookThreadDispatches(J9CommonHookInterface *commonInterface, omrthread_t self)
+{
+	if ((NULL == self) || (0 == commonInterface->threadDispatchesKey)) {
+		return NULL;
+	}
+
+	J9HookThreadDispatches *threadDispatches = (J9HookThreadDispatches *)omrthread_tls_get(self, commonInterface->threadDispatchesKey);
+	if (NULL == threadDispatches) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		/* followed by a cache line of padding, so the counts of two threads never share a line */
+		threadDispatches = (J9HookThreadDispatches *)omrmem_allocate_memory(sizeof(J9HookThreadDispatches) + HOOK_COUNT_CACHE_LINE_SIZE, OMRMEM_CATEGORY_VM);
+		if (NULL != threadDispatches) {
+			if (0 == omrthread_tls_set(self, commonInterface->threadDispatchesKey, threadDispatches)) {
+				threadDispatches->dispatching[0] = 0;
+				threadDispatches->dispatching[1] = 0;
+				threadDispatches->commonInterface = commonInterface;
+				threadDispatches->previous = NULL;
+
+				omrthread_monitor_enter(commonInterface->lock);
+				threadDispatches->next = commonInterface->threadDispatches;
+				if (NULL != threadDispatches->next) {
+					threadDispatches->next->previous = threadDispatches;
+				}
+				commonInterface->threadDispatches = threadDispatches;
+				omrthread_monitor_exit(commonInterface->lock);
+			} else {
+				omrmem_free_memory(threadDispatches);
+				threadDispatches = NULL;
+			}
+		}
+	}
+	return threadDispatches;
+}
+
+/*
+ * Count a dispatch as in progress in the current epoch, in the counts of the calling thread if it has
+ * its own, or else in the shared counts of its shard. Returns the epoch, which must be passed to
+ * hookExitDispatch().
+ */
+static uintptr_t
+hookEnterDispatch(J9CommonHookInterface *commonInterface, volatile uintptr_t *dispatching)
+{
+	for (;;) {
+		uintptr_t epoch = commonInterface->dispatchEpoch;
+		/* even the counts of a thread of its own are incremented atomically, as the cheapest full barrier on x86 */
+		VM_AtomicSupport::add(&dispatching[epoch], 1);
+		HOOK_DISPATCH_BARRIER();
+		/* only the epoch which was still current once the count was visible is counted, see hookReclaimRecords() */
+		if (epoch == commonInterface->dispatchEpoch) {
+			/* the records must not be read before the epoch was */
+			VM_AtomicSupport::readBarrier();
+			return epoch;
+		}
+		VM_AtomicSupport::subtract(&dispatching[epoch], 1);
+	}
+}
 
+/*
+ * Stop counting a dispatch as in progress. Only the calling thread updates counts of its own, so they are
+ * decremented without a locked instruction.
+ */
+static void
+hookExitDispatch(volatile uintptr_t *dispatching, bool shared, uintptr_t epoch)
+{
+	/* the records must have been read before the dispatch stops being counted */
+	if (shared) {
+		HOOK_DISPATCH_BARRIER();
+		VM_AtomicSupport::subtract(&dispatching[epoch], 1);
+	} else {
+		HOOK_DISPATCH_EXIT_BARRIER();
+		dispatching[epoch] -= 1;
+	}
+}
+
+static bool
+hookEpochDrained(J9CommonHookInterface *commonInterface, uintptr_t epoch)
+{
+	uintptr_t dispatchingIndex = commonInterface->eventSize + epoch;
+	for (uintptr_t shard = 0; shard < HOOK_COUNT_SHARDS; shard++) {
+		if (0 != commonInterface->eventCounts[(shard * commonInterface->eventCountsStride) + dispatchingIndex]) {
+			return false;
+		}
+	}
+	for (J9HookThreadDispatches *threadDispatches = commonInterface->threadDispatches; NULL != threadDispatches; threadDispatches = threadDispatches->next) {
+		if (0 != threadDispatches->dispatching[epoch]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+ * Free the replaced record arrays which no dispatch can still be reading.
+ *
+ * Arrays replaced since the last epoch change wait for the next change. After it, a dispatch which could
+ * have read them is counted in the previous epoch (or in the one before, which had drained before the
+ * change was allowed), so they are freed as soon as no dispatch is in progress in the previous epoch.
+ * This never waits, so listeners may register and unregister from within a dispatch; arrays still in
+ * use are reclaimed by a later registration change, or when the interface is shut down.
+ *
+ * Must be called with the interface lock held.
+ */
+static void
+hookReclaimRecords(J9CommonHookInterface *commonInterface)
+{
+	uintptr_t previousEpoch = 1 - commonInterface->dispatchEpoch;
+
+	if ((NULL != commonInterface->reclaimableRecords) && hookEpochDrained(commonInterface, previousEpoch)) {
+		hookFreeRecordArrays(commonInterface, commonInterface->reclaimableRecords);
+		commonInterface->reclaimableRecords = NULL;
+	}
+
+	if ((NULL == commonInterface->reclaimableRecords) && (NULL != commonInterface->retiredRecords)) {
+		commonInterface->reclaimableRecords = commonInterface->retiredRecords;
+		commonInterface->retiredRecords = NULL;
+		/* the arrays must have been replaced before a dispatch can see the new epoch */
+		VM_AtomicSupport::writeBarrier();
+		commonInterface->dispatchEpoch = previousEpoch;
+		/* and the epoch must be visible before the dispatches in progress in the old one are read */
+		VM_AtomicSupport::readWriteBarrier();
+
+		/* usually no dispatch is in progress, and the arrays can be freed straight away */
+		if (hookEpochDrained(commonInterface, 1 - previousEpoch)) {
+			hookFreeRecordArrays(commonInterface, commonInterface->reclaimableRecords);
+			commonInterface->reclaimableRecords = NULL;
+		}
+	}
+}
+
+/*
+ * Replace the records of an event with a filled in array, or NULL if the event has no listeners left.
+ *
+ * Must be called with the interface lock held.
+ */
+static void
+hookPublishRecords(J9CommonHookInterface *commonInterface, uintptr_t eventNum, J9HookRecord *records)
+{
+	J9HookRecord *oldRecords = HOOK_RECORD(commonInterface, eventNum);
+
+	/* the records must be visible before the array is */
+	VM_AtomicSupport::writeBarrier();
+	HOOK_RECORD(commonInterface, eventNum) = records;
+
+	if (NULL != oldRecords) {
+		J9HookRecordArray *array = HOOK_RECORD_ARRAY(oldRecords);
+		array->nextRetired = commonInterface->retiredRecords;
+		commonInterface->retiredRecords = array;
+	}
+	hookReclaimRecords(commonInterface);
+}
 
 intptr_t
 omrhook_lib_control(const char *key, uintptr_t value)
@@ -127,23 +376,32 @@ J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary
 	commonInterface->hookInterface = (J9HookInterface *)GLOBAL_TABLE(hookFunctionTable);
 
 	commonInterface->size = interfaceSize;
+	commonInterface->portLib = portLib;
 
 	if (omrthread_monitor_init_with_name(&commonInterface->lock, 0, "Hook Interface")) {
 		J9HookShutdownInterface(hookInterface);
 		return J9HOOK_ERR_NOMEM;
 	}
 
-	commonInterface->pool = pool_new(sizeof(J9HookRecord), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT((OMRPortLibrary *)portLib));
-	if (commonInterface->pool == NULL) {
-		J9HookShutdownInterface(hookInterface);
-		return J9HOOK_ERR_NOMEM;
+	/* without a key of its own, every dispatch is counted in the shared counts of the shards */
+	if (0 != omrthread_tls_alloc_with_finalizer(&commonInterface->threadDispatchesKey, hookFreeThreadDispatches)) {
+		commonInterface->threadDispatchesKey = 0;
 	}
 
 	commonInterface->nextAgentID = J9HOOK_AGENTID_DEFAULT + 1;
-	commonInterface->portLib = portLib;
 	commonInterface->threshold4Trace = OMRHOOK_DEFAULT_THRESHOLD_IN_MICROSECONDS_WARNING_CALLBACK_ELAPSED_TIME;
 
 	commonInterface->eventSize = (interfaceSize - sizeof(J9CommonHookInterface)) / (sizeof(U_8) + sizeof(OMREventInfo4Dump) + sizeof(J9HookRecord*));
+
+	commonInterface->eventCountsStride = HOOK_COUNT_SHARD_STRIDE(commonInterface->eventSize);
+	uintptr_t eventCountsSize = HOOK_COUNT_SHARDS * commonInterface->eventCountsStride * sizeof(uintptr_t);
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	commonInterface->eventCounts = (volatile uintptr_t *)omrmem_allocate_memory(eventCountsSize, OMRMEM_CATEGORY_VM);
+	if (NULL == commonInterface->eventCounts) {
+		J9HookShutdownInterface(hookInterface);
+		return J9HOOK_ERR_NOMEM;
+	}
+	memset((void *)commonInterface->eventCounts, 0, eventCountsSize);
 	return 0;
 }
 
@@ -157,16 +415,67 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 {
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
 
+	if (0 != commonInterface->threadDispatchesKey) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		/* clears the key in every thread, so the counts of threads still attached are not finalized later */
+		omrthread_tls_free(commonInterface->threadDispatchesKey);
+		commonInterface->threadDispatchesKey = 0;
+		while (NULL != commonInterface->threadDispatches) {
+			J9HookThreadDispatches *next = commonInterface->threadDispatches->next;
+			omrmem_free_memory(commonInterface->threadDispatches);
+			commonInterface->threadDispatches = next;
+		}
+	}
+
 	if (commonInterface->lock) {
 		omrthread_monitor_destroy(commonInterface->lock);
 	}
 
-	if (commonInterface->pool) {
-		pool_kill(commonInterface->pool);
+	if (NULL != commonInterface->eventCounts) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		omrmem_free_memory((void *)commonInterface->eventCounts);
+		commonInterface->eventCounts = NULL;
+
+		/* no dispatch can be in progress any more, so every array can be freed */
+		for (uintptr_t eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+			J9HookRecord *records = HOOK_RECORD(commonInterface, eventNum);
+			if (NULL != records) {
+				hookFreeRecordArrays(commonInterface, HOOK_RECORD_ARRAY(records));
+				HOOK_RECORD(commonInterface, eventNum) = NULL;
+			}
+		}
+		hookFreeRecordArrays(commonInterface, commonInterface->retiredRecords);
+		commonInterface->retiredRecords = NULL;
+		hookFreeRecordArrays(commonInterface, commonInterface->reclaimableRecords);
+		commonInterface->reclaimableRecords = NULL;
 	}
 }
 
 
+/*
+ * Store the sum of the shards of the listener call counts of eventNum in OMREventInfo4Dump::count.
+ * Threads may fold the same event at once, so the count is only ever raised, never set back to an older sum.
+ */
+static void
+hookFoldEventCount(J9CommonHookInterface *commonInterface, uintptr_t eventNum)
+{
+	volatile uintptr_t *dumpCount = &J9HOOK_DUMPINFO(commonInterface, eventNum)->count;
+	uintptr_t count = 0;
+
+	for (uintptr_t shard = 0; shard < HOOK_COUNT_SHARDS; shard++) {
+		count += commonInterface->eventCounts[(shard * commonInterface->eventCountsStride) + eventNum];
+	}
+
+	uintptr_t oldCount = *dumpCount;
+	while (oldCount < count) {
+		uintptr_t foundCount = VM_AtomicSupport::lockCompareExchange(dumpCount, oldCount, count);
+		if (foundCount == oldCount) {
+			break;
+		}
+		oldCount = foundCount;
+	}
+}
+
 /*
  * Inform all registered listeners that the specified event has occurred. Details about the
  * event should be available through eventData.
@@ -183,10 +492,10 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 {
 	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
-	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
 	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
 	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
-	bool sampling = false;
+	/* sampling intervals above 100 turn the timing of listeners off */
+	bool timed = (100 >= samplingInterval);
 
 	if (taggedEventNum & J9HOOK_TAG_ONCE) {
 		uint8_t oldFlags;
@@ -203,73 +512,101 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 		}
 	}
 
-	while (record) {
-		J9HookFunction function;
-		void *userData;
-		uintptr_t id;
+	if (NULL == HOOK_RECORD(commonInterface, eventNum)) {
+		/* no listeners */
+		return;
+	}
 
-		/* ensure that the id is read before any other fields */
-		id = record->id;
-		if (HOOK_IS_VALID_ID(id)) {
-			VM_AtomicSupport::readBarrier();
+	omrthread_t self = omrthread_self();
+	volatile uintptr_t *shardCounts = &commonInterface->eventCounts[HOOK_COUNT_SHARD(self) * commonInterface->eventCountsStride];
+	J9HookThreadDispatches *threadDispatches = hookThreadDispatches(commonInterface, self);
+	bool shared = (NULL == threadDispatches);
+	volatile uintptr_t *dispatching = shared ? &shardCounts[commonInterface->eventSize] : threadDispatches->dispatching;
+	uintptr_t epoch = hookEnterDispatch(commonInterface, dispatching);
+
+	/* the array is not reclaimed before this dispatch exits, and its records do not change except to be invalidated */
+	J9HookRecord *records = HOOK_RECORD(commonInterface, eventNum);
+	uintptr_t length = (NULL == records) ? 0 : HOOK_RECORD_ARRAY(records)->length;
+
+	/* every listener call is counted, but in one update of the shard. The dispatch is timed or not as a whole */
+	uintptr_t calls = 0;
+	for (uintptr_t i = 0; i < length; i++) {
+		if (HOOK_IS_VALID_ID(records[i].id)) {
+			calls += 1;
+		}
+	}
+	uintptr_t count = VM_AtomicSupport::add(&shardCounts[eventNum], calls);
+	uintptr_t previousCount = count - calls;
+	/* each shard samples the dispatch that makes its calls pass a multiple of samplingInterval */
+	bool sampling = timed && ((1 >= samplingInterval) || ((count / samplingInterval) != (previousCount / samplingInterval)));
+	if (sampling || ((count / HOOK_COUNT_FOLD_INTERVAL) != (previousCount / HOOK_COUNT_FOLD_INTERVAL))) {
+		hookFoldEventCount(commonInterface, eventNum);
+	}
 
-			function = record->function;
-			userData = record->userData;
+	for (uintptr_t i = 0; i < length; i++) {
+		J9HookRecord *record = &records[i];
 
-			/* now read the id again to make sure that nothing has changed */
-			VM_AtomicSupport::readBarrier();
-			if (record->id == id) {
-				uint64_t startTime = 0;
-				uintptr_t count = 0;
-				if (NULL != eventDump) {
-					count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
-					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
-				} else {
-					sampling =  false;
-				}
+		if (HOOK_IS_VALID_ID(record->id)) {
+			if (!sampling) {
+				record->function(hookInterface, eventNum, eventData, record->userData);
+			} else {
 				OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
-				if (sampling) {
-					startTime = omrtime_usec_clock(); 
-				}
+				uint64_t startTime = omrtime_usec_clock();
 
-				function(hookInterface, eventNum, eventData, userData);
+				record->function(hookInterface, eventNum, eventData, record->userData);
 
-				if (sampling) {
-					uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+				uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
-					eventDump->lastHook.startTime = startTime;
-					eventDump->lastHook.callsite = record->callsite;
-					eventDump->lastHook.func_ptr = (void *)record->function;
-					eventDump->lastHook.duration = timeDelta;
-					VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
+				eventDump->lastHook.startTime = startTime;
+				eventDump->lastHook.callsite = record->callsite;
+				eventDump->lastHook.func_ptr = (void *)record->function;
+				eventDump->lastHook.duration = timeDelta;
+				VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
 
-					if ((eventDump->longestHook.duration < timeDelta) ||
-						(0 == eventDump->longestHook.startTime)) {
-							eventDump->longestHook.startTime = startTime;
-							eventDump->longestHook.callsite = record->callsite;
-							eventDump->longestHook.func_ptr = (void *)record->function;
-							eventDump->longestHook.duration = timeDelta;
-					}
+				if ((eventDump->longestHook.duration < timeDelta) ||
+					(0 == eventDump->longestHook.startTime)) {
+						eventDump->longestHook.startTime = startTime;
+						eventDump->longestHook.callsite = record->callsite;
+						eventDump->longestHook.func_ptr = (void *)record->function;
+						eventDump->longestHook.duration = timeDelta;
+				}
 
-					if (commonInterface->threshold4Trace <= timeDelta) {
-						const char *callsite = "UNKNOWN";
-						char buffer[32];
-						if (NULL != record->callsite) {
-							callsite = record->callsite;
-						} else {
-							/* if the callsite info can not be retrieved, use callback function pointer instead  */
-							omrstr_printf(buffer, sizeof(buffer), "0x%p", record->function);
-							callsite = buffer;
-						}
-						Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
+				if (commonInterface->threshold4Trace <= timeDelta) {
+					const char *callsite = "UNKNOWN";
+					char buffer[32];
+					if (NULL != record->callsite) {
+						callsite = record->callsite;
+					} else {
+						/* if the callsite info can not be retrieved, use callback function pointer instead  */
+						omrstr_printf(buffer, sizeof(buffer), "0x%p", record->function);
+						callsite = buffer;
 					}
+					Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
 				}
-			} else {
-				/* this record has been updated while we were reading it. Skip it. */
 			}
+		} else {
+			/* this record has been unregistered since the array was published. Skip it. */
 		}
+	}
+
+	hookExitDispatch(dispatching, shared, epoch);
+}
 
-		record = record->next;
+/*
+ * Fold the per thread shards of the listener call counts of every event into OMREventInfo4Dump::count.
+ * Dispatch already folds the counts of an event whenever it records a sample, and at least every
+ * HOOK_COUNT_FOLD_INTERVAL calls in each shard, so readers of the count see it at most that far behind.
+ * Call this first when the count must be exact, e.g. once the threads reporting the event have stopped.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ */
+static void
+J9HookAggregateEventCounts(struct J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+
+	for (uintptr_t eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+		hookFoldEventCount(commonInterface, eventNum);
 	}
 }
 
@@ -358,76 +695,55 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
 	if (HOOK_FLAGS(commonInterface, eventNum) & J9HOOK_FLAG_DISABLED) {
 		rc = -1;
 	} else {
-		J9HookRecord *insertionPoint = NULL;
-		J9HookRecord *emptyRecord = NULL;
-		J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
-		/* at the end of the loop, insertionPoint will point to the last record which should be triggered before the one we're adding */
-		while (record) {
-			if ((taggedEventNum & J9HOOK_TAG_REVERSE_ORDER) ? record->agentID >= agentID : record->agentID <= agentID) {
-				insertionPoint = record;
-			}
+		J9HookRecord *records = HOOK_RECORD(commonInterface, eventNum);
+		uintptr_t length = (NULL == records) ? 0 : HOOK_RECORD_ARRAY(records)->length;
+		uintptr_t validLength = 0;
+		uintptr_t insertionIndex = 0;
+		/* at the end of the loop, insertionIndex will follow the last record which should be triggered before the one we're adding */
+		for (uintptr_t i = 0; i < length; i++) {
+			J9HookRecord *record = &records[i];
 			if (!HOOK_IS_VALID_ID(record->id)) {
-				if ((taggedEventNum & J9HOOK_TAG_REVERSE_ORDER) ? record->agentID >= agentID : record->agentID <= agentID) {
-					emptyRecord = record;
-				}
-			} else if ((record->function == function) && (record->userData == userData)) {
+				continue;
+			}
+			if ((record->function == function) && (record->userData == userData)) {
 				/* this listener is already registered */
 				++(record->count);
 				omrthread_monitor_exit(commonInterface->lock);
 				return 0;
 			}
-			record = record->next;
+			validLength += 1;
+			if ((taggedEventNum & J9HOOK_TAG_REVERSE_ORDER) ? record->agentID >= agentID : record->agentID <= agentID) {
+				insertionIndex = validLength;
+			}
 		}
 
-		/*
-		 * Re-use the empty record if it is in a legitimate position for the requested agent.
-		 * (It is a legitimate position if all records before this position have the same or lower agent IDs (tested previously)
-		 * and all records after this position have the same or higher IDs)
-		 */
-		if ((emptyRecord != NULL)
-			&& ((emptyRecord->next == NULL)
-				|| ((taggedEventNum & J9HOOK_TAG_REVERSE_ORDER) ?
-					(emptyRecord->next->agentID <= agentID) :
-					(emptyRecord->next->agentID >= agentID)))
-		) {
-			emptyRecord->function = function;
-			emptyRecord->callsite = callsite;
-			emptyRecord->userData = userData;
-			emptyRecord->count = 1;
-			emptyRecord->agentID = agentID;
-
-			VM_AtomicSupport::writeBarrier();
-
-			emptyRecord->id = HOOK_VALID_ID(emptyRecord->id);
-
-			HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
+		/* dispatch keeps reading the current array until the copy including the new record is published */
+		J9HookRecord *newRecords = hookAllocateRecords(commonInterface, validLength + 1);
+		if (newRecords == NULL) {
+			rc = -1;
 		} else {
-			record = (J9HookRecord *)pool_newElement(commonInterface->pool);
-			if (record == NULL) {
-				rc = -1;
-			} else {
-				if (insertionPoint == NULL) {
-					record->next = HOOK_RECORD(commonInterface, eventNum);
-				} else {
-					record->next = insertionPoint->next;
-				}
-				record->function = function;
-				record->callsite = callsite;
-				record->userData = userData;
-				record->count = 1;
-				record->id = HOOK_INITIAL_ID;
-				record->agentID = agentID;
-
-				VM_AtomicSupport::writeBarrier();
-
-				if (insertionPoint == NULL) {
-					HOOK_RECORD(commonInterface, eventNum) = record;
-				} else {
-					insertionPoint->next = record;
+			uintptr_t newIndex = 0;
+			for (uintptr_t i = 0; i < length; i++) {
+				if (HOOK_IS_VALID_ID(records[i].id)) {
+					if (newIndex == insertionIndex) {
+						newIndex += 1;
+					}
+					newRecords[newIndex++] = records[i];
 				}
-
-				HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
 			}
+
+			J9HookRecord *record = &newRecords[insertionIndex];
+			record->function = function;
+			record->callsite = callsite;
+			record->userData = userData;
+			record->count = 1;
+			record->id = HOOK_INITIAL_ID;
+			record->agentID = agentID;
+			hookLinkRecords(newRecords, validLength + 1);
+
+			hookPublishRecords(commonInterface, eventNum, newRecords);
+
+			HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
 		}
 	}
 
@@ -507,10 +823,12 @@ static void
 J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookFunction function, void *userData)
 {
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
-	J9HookRecord *record;
+	J9HookRecord *records = NULL;
+	uintptr_t length = 0;
 	J9HookRegistrationEvent eventStruct;
 	uintptr_t hooksRemaining = 0;
 	uintptr_t hooksRemoved = 0;
+	bool stillCounted = false;
 	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
 
 	eventStruct.eventNum = eventNum;
@@ -521,14 +839,19 @@ J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNu
 
 	omrthread_monitor_enter(commonInterface->lock);
 
-	record = HOOK_RECORD(commonInterface, eventNum);
-	while (record) {
+	records = HOOK_RECORD(commonInterface, eventNum);
+	length = (NULL == records) ? 0 : HOOK_RECORD_ARRAY(records)->length;
+	for (uintptr_t i = 0; i < length; i++) {
+		J9HookRecord *record = &records[i];
+		if (!HOOK_IS_VALID_ID(record->id)) {
+			continue;
+		}
 		if (record->function == function) {
 			if ((userData == NULL) || (record->userData == userData)) {
 				if (taggedEventNum & J9HOOK_TAG_COUNTED) {
 					if (--(record->count) != 0) {
-						omrthread_monitor_exit(commonInterface->lock);
-						return;
+						stillCounted = true;
+						break;
 					}
 				}
 
@@ -538,15 +861,37 @@ J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNu
 					eventStruct.agentID = record->agentID;
 				}
 
-				/* mark the record as invalid so that it can be recycled */
+				/* invalidate the record, so that dispatches already reading the array skip it */
 				record->id = HOOK_INVALID_ID(record->id);
 				hooksRemoved++;
 			}
 		}
-		if (HOOK_IS_VALID_ID(record->id)) {
+	}
+	for (uintptr_t i = 0; i < length; i++) {
+		if (HOOK_IS_VALID_ID(records[i].id)) {
 			hooksRemaining++;
 		}
-		record = record->next;
+	}
+
+	if (hooksRemoved != 0) {
+		J9HookRecord *newRecords = NULL;
+		if (0 != hooksRemaining) {
+			newRecords = hookAllocateRecords(commonInterface, hooksRemaining);
+		}
+		if (NULL != newRecords) {
+			uintptr_t newIndex = 0;
+			for (uintptr_t i = 0; i < length; i++) {
+				if (HOOK_IS_VALID_ID(records[i].id)) {
+					newRecords[newIndex++] = records[i];
+				}
+			}
+			hookLinkRecords(newRecords, hooksRemaining);
+			hookPublishRecords(commonInterface, eventNum, newRecords);
+		} else if (0 == hooksRemaining) {
+			hookPublishRecords(commonInterface, eventNum, NULL);
+		} else {
+			/* keep the current array, whose invalidated records are skipped, until the next change can copy it */
+		}
 	}
 
 	if (hooksRemaining == 0) {
@@ -555,6 +900,10 @@ J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNu
 
 	omrthread_monitor_exit(commonInterface->lock);
 
+	if (stillCounted) {
+		return;
+	}
+
 	if (hooksRemoved != 0) {
 		/* report the unregistration event */
 		(*hookInterface)->J9HookDispatch(hookInterface, J9HOOK_REGISTRATION_EVENT, &eventStruct);